@@ -0,0 +1,24 @@
+#include "Asset_archive.hpp"
+
+#include <exception>
+#include <iostream>
+
+// packs a resources directory into the archive the game maps at start,
+// asset_packer "walking around/resources" "walking around/resources.pak"
+int wmain(int argc, wchar_t *argv[]) {
+    if (argc != 3) {
+        std::wcerr << L"usage: " << argv[0] << L" <directory> <archive>\n";
+        return 1;
+    }
+
+    try {
+        Asset_archive::pack_report_t report = Asset_archive::pack(argv[1], argv[2]);
+        std::cout << report.entries << " files, " << report.compressed_entries
+                  << " compressed, " << report.bytes / 1024 << " KB packed into "
+                  << report.archive_bytes / 1024 << " KB\n";
+    } catch (const std::exception &exception) {
+        std::cerr << exception.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,658 @@
+#include "Aabb_tree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+Aabb_tree::box_t combine(const Aabb_tree::box_t &a, const Aabb_tree::box_t &b) {
+    return {{(std::min)(a.min.x, b.min.x), (std::min)(a.min.y, b.min.y),
+             (std::min)(a.min.z, b.min.z)},
+            {(std::max)(a.max.x, b.max.x), (std::max)(a.max.y, b.max.y),
+             (std::max)(a.max.z, b.max.z)}};
+}
+
+// half the surface area, only ever compared
+float area(const Aabb_tree::box_t &box) {
+    float x = box.max.x - box.min.x, y = box.max.y - box.min.y, z = box.max.z - box.min.z;
+    return x * y + y * z + z * x;
+}
+
+bool contains(const Aabb_tree::box_t &outer, const Aabb_tree::box_t &inner) {
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y
+           && outer.min.z <= inner.min.z && inner.max.x <= outer.max.x
+           && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+Aabb_tree::box_t grow(const Aabb_tree::box_t &box, float margin) {
+    return {{box.min.x - margin, box.min.y - margin, box.min.z - margin},
+            {box.max.x + margin, box.max.y + margin, box.max.z + margin}};
+}
+
+// a zero direction would make 0 * infinity, a huge one keeps the slabs' products ordered
+float inverse(float d) {
+    constexpr float huge = 1e30f;
+    return d == 0 ? huge : 1 / d;
+}
+
+struct ray_t {
+    public:
+        float origin[3], inverse_direction[3];
+};
+
+// the lanes of node whose boxes are at least partly inside, as bits
+unsigned int lanes_in_frustum(const Aabb_tree::frustum_t &frustum, const float *min_x,
+                              const float *min_y, const float *min_z, const float *max_x,
+                              const float *max_y, const float *max_z) {
+    // a box is outside a plane when its corner furthest along the plane's normal is
+#ifdef MATH_SSE
+    __m128 outside = _mm_setzero_ps();
+    for (const math::float4 &plane : frustum.planes) {
+        __m128 x = _mm_load_ps(plane.x >= 0 ? max_x : min_x);
+        __m128 y = _mm_load_ps(plane.y >= 0 ? max_y : min_y);
+        __m128 z = _mm_load_ps(plane.z >= 0 ? max_z : min_z);
+        __m128 distance = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x)), _mm_mul_ps(y, _mm_set1_ps(plane.y))),
+            _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane.z)), _mm_set1_ps(plane.w)));
+        outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_setzero_ps()));
+    }
+    return ~static_cast<unsigned int>(_mm_movemask_ps(outside)) & 15;
+#else
+    unsigned int inside = 0;
+    for (unsigned int lane = 0; lane < 4; lane++) {
+        bool outside = false;
+        for (const math::float4 &plane : frustum.planes) {
+            float x = plane.x >= 0 ? max_x[lane] : min_x[lane];
+            float y = plane.y >= 0 ? max_y[lane] : min_y[lane];
+            float z = plane.z >= 0 ? max_z[lane] : min_z[lane];
+            outside |= (x * plane.x + y * plane.y) + (z * plane.z + plane.w) < 0;
+        }
+        inside |= !outside << lane;
+    }
+    return inside;
+#endif
+}
+
+unsigned int lanes_overlapping(const Aabb_tree::box_t &box, const float *min_x,
+                               const float *min_y, const float *min_z, const float *max_x,
+                               const float *max_y, const float *max_z) {
+#ifdef MATH_SSE
+    __m128 apart = _mm_or_ps(
+        _mm_or_ps(_mm_cmpgt_ps(_mm_load_ps(min_x), _mm_set1_ps(box.max.x)),
+                  _mm_cmpgt_ps(_mm_load_ps(min_y), _mm_set1_ps(box.max.y))),
+        _mm_cmpgt_ps(_mm_load_ps(min_z), _mm_set1_ps(box.max.z)));
+    apart = _mm_or_ps(
+        apart, _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(_mm_load_ps(max_x), _mm_set1_ps(box.min.x)),
+                                   _mm_cmplt_ps(_mm_load_ps(max_y), _mm_set1_ps(box.min.y))),
+                         _mm_cmplt_ps(_mm_load_ps(max_z), _mm_set1_ps(box.min.z))));
+    return ~static_cast<unsigned int>(_mm_movemask_ps(apart)) & 15;
+#else
+    unsigned int overlapping = 0;
+    for (unsigned int lane = 0; lane < 4; lane++) {
+        bool apart = min_x[lane] > box.max.x || min_y[lane] > box.max.y
+                     || min_z[lane] > box.max.z || max_x[lane] < box.min.x
+                     || max_y[lane] < box.min.y || max_z[lane] < box.min.z;
+        overlapping |= !apart << lane;
+    }
+    return overlapping;
+#endif
+}
+
+// the lanes the ray enters before max_distance, with where it enters them in distances
+unsigned int lanes_hit(const ray_t &ray, float max_distance, const float *min_x,
+                       const float *min_y, const float *min_z, const float *max_x,
+                       const float *max_y, const float *max_z, float (&distances)[4]) {
+    const float *mins[] = {min_x, min_y, min_z}, *maxes[] = {max_x, max_y, max_z};
+#ifdef MATH_SSE
+    __m128 enter = _mm_setzero_ps(), leave = _mm_set1_ps(max_distance);
+    for (unsigned int axis = 0; axis < 3; axis++) {
+        __m128 origin = _mm_set1_ps(ray.origin[axis]);
+        __m128 inverse_direction = _mm_set1_ps(ray.inverse_direction[axis]);
+        __m128 to_min =
+            _mm_mul_ps(_mm_sub_ps(_mm_load_ps(mins[axis]), origin), inverse_direction);
+        __m128 to_max =
+            _mm_mul_ps(_mm_sub_ps(_mm_load_ps(maxes[axis]), origin), inverse_direction);
+        enter = _mm_max_ps(enter, _mm_min_ps(to_min, to_max));
+        leave = _mm_min_ps(leave, _mm_max_ps(to_min, to_max));
+    }
+    _mm_storeu_ps(distances, enter);
+    return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmple_ps(enter, leave)));
+#else
+    unsigned int hit = 0;
+    for (unsigned int lane = 0; lane < 4; lane++) {
+        float enter = 0, leave = max_distance;
+        for (unsigned int axis = 0; axis < 3; axis++) {
+            float inverse_direction = ray.inverse_direction[axis];
+            float to_min = (mins[axis][lane] - ray.origin[axis]) * inverse_direction;
+            float to_max = (maxes[axis][lane] - ray.origin[axis]) * inverse_direction;
+            // in the operand order of _mm_min_ps() and _mm_max_ps()
+            enter = (std::max)((std::min)(to_max, to_min), enter);
+            leave = (std::min)((std::max)(to_max, to_min), leave);
+        }
+        distances[lane] = enter;
+        hit |= (enter <= leave) << lane;
+    }
+    return hit;
+#endif
+}
+
+} // namespace
+
+unsigned int Aabb_tree::allocate_node() {
+    if (!free_nodes.empty()) {
+        unsigned int node = free_nodes.back();
+        free_nodes.pop_back();
+        return node;
+    }
+    nodes.emplace_back();
+    return static_cast<unsigned int>(nodes.size()) - 1;
+}
+
+void Aabb_tree::free_node(unsigned int node) {
+    free_nodes.push_back(node);
+}
+
+void Aabb_tree::insert_leaf(unsigned int leaf) {
+    flattened = false;
+    if (root == no_node) {
+        root = leaf;
+        nodes[leaf].parent = no_node;
+        return;
+    }
+
+    // down to where the leaf costs least: a new parent there has the area of both, and every
+    // node above grows by as much as it takes to hold the leaf
+    const box_t &leaf_box = nodes[leaf].box;
+    unsigned int sibling = root;
+    while (nodes[sibling].height > 0) {
+        const node_t &node = nodes[sibling];
+        float node_area = area(node.box);
+        float combined_area = area(combine(node.box, leaf_box));
+        float here = 2 * combined_area;
+        float inherited = 2 * (combined_area - node_area);
+
+        float child_costs[2];
+        for (unsigned int i = 0; i < 2; i++) {
+            const node_t &child = nodes[node.children[i]];
+            float grown = area(combine(child.box, leaf_box));
+            child_costs[i] =
+                (child.height == 0 ? grown : grown - area(child.box)) + inherited;
+        }
+        if (here < child_costs[0] && here < child_costs[1]) {
+            break;
+        }
+        sibling = node.children[child_costs[0] < child_costs[1] ? 0 : 1];
+    }
+
+    unsigned int old_parent = nodes[sibling].parent;
+    unsigned int new_parent = allocate_node();
+    node_t &parent = nodes[new_parent];
+    parent.parent = old_parent;
+    parent.children[0] = sibling;
+    parent.children[1] = leaf;
+    parent.item = no_item;
+    nodes[sibling].parent = new_parent;
+    nodes[leaf].parent = new_parent;
+    if (old_parent == no_node) {
+        root = new_parent;
+    } else {
+        node_t &above = nodes[old_parent];
+        above.children[above.children[0] == sibling ? 0 : 1] = new_parent;
+    }
+    refit_up(new_parent);
+}
+
+void Aabb_tree::remove_leaf(unsigned int leaf) {
+    flattened = false;
+    if (leaf == root) {
+        root = no_node;
+        return;
+    }
+    unsigned int parent = nodes[leaf].parent;
+    unsigned int grandparent = nodes[parent].parent;
+    unsigned int sibling = nodes[parent].children[nodes[parent].children[0] == leaf ? 1 : 0];
+    free_node(parent);
+
+    nodes[sibling].parent = grandparent;
+    if (grandparent == no_node) {
+        root = sibling;
+        return;
+    }
+    node_t &above = nodes[grandparent];
+    above.children[above.children[0] == parent ? 0 : 1] = sibling;
+    refit_up(grandparent);
+}
+
+void Aabb_tree::refit_up(unsigned int node) {
+    while (node != no_node) {
+        node_t &refitted = nodes[node];
+        const node_t &first = nodes[refitted.children[0]], &second = nodes[refitted.children[1]];
+        refitted.box = combine(first.box, second.box);
+        refitted.height = 1 + (std::max)(first.height, second.height);
+        rotate(node);
+        node = refitted.parent;
+    }
+}
+
+void Aabb_tree::rotate(unsigned int node) {
+    // a child swapped with one of its sibling's children leaves node's box as it is and only
+    // changes the sibling's, the swap that shrinks it the most is made
+    node_t &a = nodes[node];
+    if (a.height < 2) {
+        return;
+    }
+    float best_gain = 0;
+    unsigned int best_child = 0, best_grandchild = 0;
+    for (unsigned int c = 0; c < 2; c++) {
+        const node_t &moved = nodes[a.children[c]];
+        const node_t &sibling = nodes[a.children[1 - c]];
+        if (sibling.height == 0) {
+            continue;
+        }
+        float sibling_area = area(sibling.box);
+        for (unsigned int g = 0; g < 2; g++) {
+            // moved takes grandchild g's place next to the other one
+            const node_t &kept = nodes[sibling.children[1 - g]];
+            float gain = sibling_area - area(combine(moved.box, kept.box));
+            if (gain > best_gain) {
+                best_gain = gain;
+                best_child = c;
+                best_grandchild = g;
+            }
+        }
+    }
+    if (best_gain <= 0) {
+        return;
+    }
+
+    unsigned int moved = a.children[best_child];
+    unsigned int sibling = a.children[1 - best_child];
+    node_t &sibling_node = nodes[sibling];
+    unsigned int grandchild = sibling_node.children[best_grandchild];
+    a.children[best_child] = grandchild;
+    nodes[grandchild].parent = node;
+    sibling_node.children[best_grandchild] = moved;
+    nodes[moved].parent = sibling;
+
+    const node_t &first = nodes[sibling_node.children[0]];
+    const node_t &second = nodes[sibling_node.children[1]];
+    sibling_node.box = combine(first.box, second.box);
+    sibling_node.height = 1 + (std::max)(first.height, second.height);
+    a.height = 1 + (std::max)(nodes[a.children[0]].height, nodes[a.children[1]].height);
+}
+
+void Aabb_tree::check_flattened() const {
+    if (!flattened) {
+        throw std::runtime_error("the aabb tree changed since flatten()");
+    }
+}
+
+void Aabb_tree::init(float _margin) {
+    margin = _margin;
+    nodes.clear();
+    free_nodes.clear();
+    root = no_node;
+    items.clear();
+    free_items.clear();
+    count = 0;
+    wide_nodes.clear();
+    flattened = true;
+}
+
+unsigned int Aabb_tree::insert(const box_t &box) {
+    unsigned int item;
+    if (!free_items.empty()) {
+        item = free_items.back();
+        free_items.pop_back();
+    } else {
+        item = static_cast<unsigned int>(items.size());
+        items.emplace_back();
+    }
+    unsigned int leaf = allocate_node();
+    node_t &node = nodes[leaf];
+    node.box = grow(box, margin);
+    node.children[0] = no_node;
+    node.children[1] = no_node;
+    node.item = item;
+    node.height = 0;
+    items[item] = {box, leaf};
+    insert_leaf(leaf);
+    count++;
+    return item;
+}
+
+bool Aabb_tree::move(unsigned int item, const box_t &box) {
+    item_t &moved = items[item];
+    moved.box = box;
+    flattened = false;
+    if (contains(nodes[moved.node].box, box)) {
+        return false;
+    }
+    remove_leaf(moved.node);
+    nodes[moved.node].box = grow(box, margin);
+    insert_leaf(moved.node);
+    return true;
+}
+
+void Aabb_tree::remove(unsigned int item) {
+    if (item >= items.size() || items[item].node == no_node) {
+        throw std::runtime_error("the aabb tree has no such item");
+    }
+    remove_leaf(items[item].node);
+    free_node(items[item].node);
+    items[item].node = no_node;
+    free_items.push_back(item);
+    count--;
+}
+
+void Aabb_tree::set_box(unsigned int item, const box_t &box) {
+    item_t &moved = items[item];
+    moved.box = box;
+    flattened = false;
+    box_t &leaf_box = nodes[moved.node].box;
+    if (!contains(leaf_box, box)) {
+        leaf_box = grow(box, margin);
+    }
+}
+
+void Aabb_tree::refit() {
+    if (root == no_node) {
+        return;
+    }
+    // children before their parents, from the order the nodes are first reached in reversed
+    std::vector<unsigned int> order;
+    order.reserve(nodes.size());
+    order.push_back(root);
+    for (std::size_t i = 0; i < order.size(); i++) {
+        const node_t &node = nodes[order[i]];
+        if (node.height > 0) {
+            order.push_back(node.children[0]);
+            order.push_back(node.children[1]);
+        }
+    }
+    for (auto it = order.rbegin(); it != order.rend(); it++) {
+        node_t &node = nodes[*it];
+        if (node.height > 0) {
+            node.box = combine(nodes[node.children[0]].box, nodes[node.children[1]].box);
+        }
+    }
+}
+
+void Aabb_tree::flatten() {
+    wide_nodes.clear();
+    flattened = true;
+    if (root == no_node) {
+        return;
+    }
+
+    // every wide node takes a binary node's children, then keeps opening its largest internal
+    // child in place of it while it has room
+    struct pending_t {
+        public:
+            unsigned int node, wide_node;
+    };
+    std::vector<pending_t> pending = {{root, 0}};
+    wide_nodes.emplace_back();
+    while (!pending.empty()) {
+        pending_t current = pending.back();
+        pending.pop_back();
+
+        unsigned int children[4];
+        unsigned int child_count = 0;
+        const node_t &node = nodes[current.node];
+        if (node.height == 0) {
+            children[child_count++] = current.node;
+        } else {
+            children[child_count++] = node.children[0];
+            children[child_count++] = node.children[1];
+        }
+        while (child_count < 4) {
+            unsigned int largest = 4;
+            float largest_area = -1;
+            for (unsigned int i = 0; i < child_count; i++) {
+                const node_t &child = nodes[children[i]];
+                if (child.height > 0 && area(child.box) > largest_area) {
+                    largest = i;
+                    largest_area = area(child.box);
+                }
+            }
+            if (largest == 4) {
+                break;
+            }
+            const node_t &opened = nodes[children[largest]];
+            children[largest] = opened.children[0];
+            children[child_count++] = opened.children[1];
+        }
+
+        for (unsigned int lane = 0; lane < 4; lane++) {
+            // the empty lanes hold a box inside out, the queries skip them by count anyway
+            box_t box = {{1, 1, 1}, {-1, -1, -1}};
+            unsigned int child = no_item;
+            if (lane < child_count) {
+                const node_t &child_node = nodes[children[lane]];
+                if (child_node.height == 0) {
+                    box = items[child_node.item].box;
+                    child = child_node.item | leaf_bit;
+                } else {
+                    box = child_node.box;
+                    child = static_cast<unsigned int>(wide_nodes.size());
+                    wide_nodes.emplace_back();
+                    pending.push_back({children[lane], child});
+                }
+            }
+            wide_node_t &wide_node = wide_nodes[current.wide_node];
+            wide_node.min_x[lane] = box.min.x;
+            wide_node.min_y[lane] = box.min.y;
+            wide_node.min_z[lane] = box.min.z;
+            wide_node.max_x[lane] = box.max.x;
+            wide_node.max_y[lane] = box.max.y;
+            wide_node.max_z[lane] = box.max.z;
+            wide_node.children[lane] = child;
+        }
+        wide_nodes[current.wide_node].count = child_count;
+    }
+}
+
+void Aabb_tree::query_frustum(const frustum_t &frustum, std::vector<unsigned int> &out) const {
+    check_flattened();
+    if (wide_nodes.empty()) {
+        return;
+    }
+    std::vector<unsigned int> stack = {0};
+    while (!stack.empty()) {
+        const wide_node_t &node = wide_nodes[stack.back()];
+        stack.pop_back();
+        unsigned int lanes = lanes_in_frustum(frustum, node.min_x, node.min_y, node.min_z,
+                                              node.max_x, node.max_y, node.max_z)
+                             & ((1u << node.count) - 1);
+        for (unsigned int lane = 0; lane < node.count; lane++) {
+            if (!(lanes & (1u << lane))) {
+                continue;
+            }
+            unsigned int child = node.children[lane];
+            if (child & leaf_bit) {
+                out.push_back(child & ~leaf_bit);
+            } else {
+                stack.push_back(child);
+            }
+        }
+    }
+}
+
+void Aabb_tree::query_box(const box_t &box, std::vector<unsigned int> &out) const {
+    check_flattened();
+    if (wide_nodes.empty()) {
+        return;
+    }
+    std::vector<unsigned int> stack = {0};
+    while (!stack.empty()) {
+        const wide_node_t &node = wide_nodes[stack.back()];
+        stack.pop_back();
+        unsigned int lanes = lanes_overlapping(box, node.min_x, node.min_y, node.min_z,
+                                               node.max_x, node.max_y, node.max_z)
+                             & ((1u << node.count) - 1);
+        for (unsigned int lane = 0; lane < node.count; lane++) {
+            if (!(lanes & (1u << lane))) {
+                continue;
+            }
+            unsigned int child = node.children[lane];
+            if (child & leaf_bit) {
+                out.push_back(child & ~leaf_bit);
+            } else {
+                stack.push_back(child);
+            }
+        }
+    }
+}
+
+bool Aabb_tree::raycast(const math::float3 &origin, const math::float3 &direction,
+                        float max_distance, unsigned int &item, float &distance) const {
+    check_flattened();
+    if (wide_nodes.empty()) {
+        return false;
+    }
+    ray_t ray = {{origin.x, origin.y, origin.z},
+                 {inverse(direction.x), inverse(direction.y), inverse(direction.z)}};
+
+    // nodes with where the ray enters them, the nearest children are pushed last so they are
+    // opened first and the later ones are mostly skipped
+    struct entered_t {
+        public:
+            unsigned int wide_node;
+            float distance;
+    };
+    std::vector<entered_t> stack = {{0, 0}};
+    bool found = false;
+    float closest = max_distance;
+    while (!stack.empty()) {
+        entered_t current = stack.back();
+        stack.pop_back();
+        if (current.distance > closest) {
+            continue;
+        }
+        const wide_node_t &node = wide_nodes[current.wide_node];
+        float distances[4];
+        unsigned int lanes = lanes_hit(ray, closest, node.min_x, node.min_y, node.min_z,
+                                       node.max_x, node.max_y, node.max_z, distances)
+                             & ((1u << node.count) - 1);
+
+        entered_t children[4];
+        unsigned int child_count = 0;
+        for (unsigned int lane = 0; lane < node.count; lane++) {
+            if (!(lanes & (1u << lane))) {
+                continue;
+            }
+            unsigned int child = node.children[lane];
+            if (!(child & leaf_bit)) {
+                // kept farthest first
+                unsigned int i = child_count++;
+                for (; i > 0 && children[i - 1].distance < distances[lane]; i--) {
+                    children[i] = children[i - 1];
+                }
+                children[i] = {child, distances[lane]};
+            } else if (!found || distances[lane] < closest) {
+                found = true;
+                closest = distances[lane];
+                item = child & ~leaf_bit;
+            }
+        }
+        stack.insert(stack.end(), children, children + child_count);
+    }
+    if (found) {
+        distance = closest;
+    }
+    return found;
+}
+
+const Aabb_tree::box_t &Aabb_tree::get_box(unsigned int item) const {
+    if (item >= items.size() || items[item].node == no_node) {
+        throw std::runtime_error("the aabb tree has no such item");
+    }
+    return items[item].box;
+}
+
+unsigned int Aabb_tree::get_count() const {
+    return count;
+}
+
+unsigned int Aabb_tree::get_height() const {
+    return root == no_node ? 0 : nodes[root].height;
+}
+
+float Aabb_tree::get_area_ratio() const {
+    if (root == no_node || nodes[root].height == 0) {
+        return 0;
+    }
+    double total = 0;
+    std::vector<unsigned int> stack = {root};
+    while (!stack.empty()) {
+        const node_t &node = nodes[stack.back()];
+        stack.pop_back();
+        if (node.height > 0) {
+            total += area(node.box);
+            stack.push_back(node.children[0]);
+            stack.push_back(node.children[1]);
+        }
+    }
+    return static_cast<float>(total / area(nodes[root].box));
+}
+
+Aabb_tree::box_t Aabb_tree::transform(const box_t &box, const math::affine &transform) {
+    // every row adds the smaller of its products with min and max to the new min, the larger
+    // to the new max
+    const float mins[] = {box.min.x, box.min.y, box.min.z};
+    const float maxes[] = {box.max.x, box.max.y, box.max.z};
+    float new_min[3], new_max[3];
+    for (unsigned int j = 0; j < 3; j++) {
+        new_min[j] = transform.m[3][j];
+        new_max[j] = transform.m[3][j];
+        for (unsigned int i = 0; i < 3; i++) {
+            float a = transform.m[i][j] * mins[i], b = transform.m[i][j] * maxes[i];
+            new_min[j] += (std::min)(a, b);
+            new_max[j] += (std::max)(a, b);
+        }
+    }
+    return {{new_min[0], new_min[1], new_min[2]}, {new_max[0], new_max[1], new_max[2]}};
+}
+
+Aabb_tree::frustum_t Aabb_tree::get_frustum(const math::matrix &view_proj) {
+    // a point's clip coordinates are its dot products with view_proj's columns, inside is
+    // -w <= x <= w, -w <= y <= w and 0 <= z <= w
+    math::matrix columns = math::transpose(view_proj);
+    math::vector x = columns.r[0], y = columns.r[1], z = columns.r[2], w = columns.r[3];
+    math::vector planes[] = {math::add(w, x),      math::subtract(w, x), math::add(w, y),
+                             math::subtract(w, y), z,                    math::subtract(w, z)};
+    frustum_t frustum;
+    for (unsigned int i = 0; i < 6; i++) {
+        math::store(frustum.planes[i], planes[i]);
+    }
+    return frustum;
+}
+
+bool Aabb_tree::intersects(const frustum_t &frustum, const box_t &box) {
+    for (const math::float4 &plane : frustum.planes) {
+        float x = plane.x >= 0 ? box.max.x : box.min.x;
+        float y = plane.y >= 0 ? box.max.y : box.min.y;
+        float z = plane.z >= 0 ? box.max.z : box.min.z;
+        if (x * plane.x + y * plane.y + z * plane.z + plane.w < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+float Aabb_tree::get_near_depth(const box_t &box, const math::matrix &view) {
+    math::float3 extent = {box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z};
+    math::vector center = math::set((box.min.x + box.max.x) / 2, (box.min.y + box.max.y) / 2,
+                                    (box.min.z + box.max.z) / 2, 1);
+    float radius = std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z) / 2;
+    return math::get_z(math::transform3(center, view)) - radius;
+}
+
+float Aabb_tree::get_distance(const box_t &box, const math::float3 &point) {
+    float dx = (std::max)({box.min.x - point.x, point.x - box.max.x, 0.0f});
+    float dy = (std::max)({box.min.y - point.y, point.y - box.max.y, 0.0f});
+    float dz = (std::max)({box.min.z - point.z, point.z - box.max.z, 0.0f});
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include "Affine.hpp"
+
+#include <vector>
+
+// boxes in a binary tree of boxes that is changed as they come, move and go instead of being
+// built again: a box goes next to the node where it adds the least surface area, the ancestors
+// are refitted on the way back up and rotated where swapping a child with a grandchild shrinks
+// them, as in Box2D's dynamic tree
+//
+// the tree keeps every box grown by a margin, so a box moving less than that changes nothing,
+// flatten() then collapses it into nodes of four children side by side, which the queries walk
+// testing the four at once
+class Aabb_tree {
+    public:
+        constexpr static unsigned int no_item = ~0u;
+
+        struct box_t {
+            public:
+                math::float3 min, max;
+        };
+
+        // a point p is inside when x * p.x + y * p.y + z * p.z + w >= 0 for every plane
+        struct frustum_t {
+            public:
+                math::float4 planes[6];
+        };
+
+    private:
+        constexpr static unsigned int no_node = ~0u;
+        // marks the items among a wide node's children
+        constexpr static unsigned int leaf_bit = 1u << 31;
+
+        struct node_t {
+            public:
+                box_t box;
+                unsigned int parent;
+                unsigned int children[2]; // no_node for leaves
+                unsigned int item;        // the leaves' item
+                unsigned int height;      // 0 for leaves
+        };
+
+        struct wide_node_t {
+            public:
+                // the children's boxes, lane by lane, the items' own boxes without the margin
+                alignas(16) float min_x[4], min_y[4], min_z[4], max_x[4], max_y[4], max_z[4];
+                unsigned int children[4]; // wide nodes, or items with leaf_bit
+                unsigned int count;
+        };
+
+        struct item_t {
+            public:
+                box_t box;
+                unsigned int node = no_node; // no_node once removed
+        };
+
+        float margin = 0;
+        std::vector<node_t> nodes;
+        std::vector<unsigned int> free_nodes;
+        unsigned int root = no_node;
+        std::vector<item_t> items;
+        std::vector<unsigned int> free_items;
+        unsigned int count = 0;
+
+        std::vector<wide_node_t> wide_nodes;
+        // false from any change until flatten()
+        bool flattened = true;
+
+        unsigned int allocate_node();
+
+        void free_node(unsigned int node);
+
+        void insert_leaf(unsigned int leaf);
+
+        void remove_leaf(unsigned int leaf);
+
+        // refits and rotates node and every ancestor
+        void refit_up(unsigned int node);
+
+        void rotate(unsigned int node);
+
+        void check_flattened() const;
+
+    public:
+        // margin is how far a box may move before it is placed again
+        void init(float _margin);
+
+        // returns the item's id, ids of removed items are given out again
+        unsigned int insert(const box_t &box);
+
+        // the item is placed again only when box leaves its grown box, returns whether it was
+        bool move(unsigned int item, const box_t &box);
+
+        void remove(unsigned int item);
+
+        // for moving many items at once: grows the item's box in place without touching the
+        // rest of the tree, refit() then fixes every node's box in one pass
+        void set_box(unsigned int item, const box_t &box);
+
+        void refit();
+
+        // builds the wide nodes the queries walk, needed after every change
+        void flatten();
+
+        // the ids of the items whose boxes are at least partly inside, appended to out
+        void query_frustum(const frustum_t &frustum, std::vector<unsigned int> &out) const;
+
+        void query_box(const box_t &box, std::vector<unsigned int> &out) const;
+
+        // the closest item whose box the ray from origin along direction enters before
+        // max_distance lengths of direction, distance is in those lengths and 0 from inside
+        bool raycast(const math::float3 &origin, const math::float3 &direction,
+                     float max_distance, unsigned int &item, float &distance) const;
+
+        // the item's own box, without the margin
+        const box_t &get_box(unsigned int item) const;
+
+        unsigned int get_count() const;
+
+        // the longest path from the root to a leaf, 0 for a single item
+        unsigned int get_height() const;
+
+        // the internal nodes' surface area over the root's, what the insertions keep low
+        float get_area_ratio() const;
+
+        // the box around box transformed
+        static box_t transform(const box_t &box, const math::affine &transform);
+
+        // of a row-vector view_proj with the depth from 0 to 1, like math::perspective_fov_lh()
+        static frustum_t get_frustum(const math::matrix &view_proj);
+
+        // from the box's closest point to point, 0 inside
+        static float get_distance(const box_t &box, const math::float3 &point);
+
+        // false only when the box is wholly outside one of the planes
+        static bool intersects(const frustum_t &frustum, const box_t &box);
+
+        // the view space depth of the sphere around the box's front, its center's less its half
+        // diagonal, for ordering draws like the objects' spheres, view is untransposed
+        static float get_near_depth(const box_t &box, const math::matrix &view);
+};
@@ -0,0 +1,245 @@
+#include "Aabb_tree_benchmark.hpp"
+#include "Aabb_tree.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int move_steps = 10;
+constexpr unsigned int query_count = 1'000;
+constexpr unsigned int checked_queries = 50;
+constexpr float margin = 0.5f;
+// the boxes' density, square units per box
+constexpr float area_per_box = 16;
+constexpr float max_ray_distance = 100;
+
+using box_t = Aabb_tree::box_t;
+
+double milliseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+           / 1'000'000.0;
+}
+
+// what the tree's queries test, one box at a time
+bool in_frustum(const Aabb_tree::frustum_t &frustum, const box_t &box) {
+    for (const math::float4 &plane : frustum.planes) {
+        float x = plane.x >= 0 ? box.max.x : box.min.x;
+        float y = plane.y >= 0 ? box.max.y : box.min.y;
+        float z = plane.z >= 0 ? box.max.z : box.min.z;
+        if ((x * plane.x + y * plane.y) + (z * plane.z + plane.w) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool overlaps(const box_t &a, const box_t &b) {
+    return a.min.x <= b.max.x && a.min.y <= b.max.y && a.min.z <= b.max.z
+           && b.min.x <= a.max.x && b.min.y <= a.max.y && b.min.z <= a.max.z;
+}
+
+bool hits(const math::float3 &origin, const math::float3 &direction, const box_t &box,
+          float max_distance, float &distance) {
+    const float origins[] = {origin.x, origin.y, origin.z};
+    const float directions[] = {direction.x, direction.y, direction.z};
+    const float mins[] = {box.min.x, box.min.y, box.min.z};
+    const float maxes[] = {box.max.x, box.max.y, box.max.z};
+    float enter = 0, leave = max_distance;
+    for (unsigned int axis = 0; axis < 3; axis++) {
+        float inverse_direction = directions[axis] == 0 ? 1e30f : 1 / directions[axis];
+        float to_min = (mins[axis] - origins[axis]) * inverse_direction;
+        float to_max = (maxes[axis] - origins[axis]) * inverse_direction;
+        enter = (std::max)((std::min)(to_max, to_min), enter);
+        leave = (std::min)((std::max)(to_max, to_min), leave);
+    }
+    distance = enter;
+    return enter <= leave;
+}
+} // namespace
+
+std::string benchmark_aabb_tree(unsigned int box_count) {
+    float side = std::sqrt(box_count * area_per_box);
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> position(0, side), height(0, 10), size(0.5f, 3),
+        velocity(-1, 1), turn(-3.2f, 3.2f);
+
+    std::vector<box_t> boxes(box_count);
+    std::vector<float> velocity_x(box_count), velocity_z(box_count);
+    for (unsigned int i = 0; i < box_count; i++) {
+        float x = position(generator), y = height(generator), z = position(generator);
+        float extent = size(generator);
+        boxes[i] = {{x, y, z}, {x + extent, y + extent, z + extent}};
+        velocity_x[i] = velocity(generator);
+        velocity_z[i] = velocity(generator);
+    }
+    // a tenth of a second of moving, bouncing off the square's edges
+    auto step = [&] {
+        for (unsigned int i = 0; i < box_count; i++) {
+            box_t &box = boxes[i];
+            float dx = velocity_x[i] * 0.1f, dz = velocity_z[i] * 0.1f;
+            box.min.x += dx;
+            box.max.x += dx;
+            box.min.z += dz;
+            box.max.z += dz;
+            if (box.min.x < 0 || box.max.x > side) {
+                velocity_x[i] = -velocity_x[i];
+            }
+            if (box.min.z < 0 || box.max.z > side) {
+                velocity_z[i] = -velocity_z[i];
+            }
+        }
+    };
+
+    Aabb_tree tree;
+    tree.init(margin);
+    std::stringstream s;
+    s << "aabb tree: " << box_count << " boxes, math backend " << math::backend << "\n";
+
+    auto start_point = std::chrono::high_resolution_clock::now();
+    for (const box_t &box : boxes) {
+        tree.insert(box);
+    }
+    double build_time = milliseconds_since(start_point);
+    start_point = std::chrono::high_resolution_clock::now();
+    tree.flatten();
+    s << "build: " << build_time << " ms inserting, " << milliseconds_since(start_point)
+      << " ms flattening, height " << tree.get_height() << ", area ratio "
+      << tree.get_area_ratio() << "\n";
+
+    double move_time = 0;
+    unsigned int reinserted = 0;
+    for (unsigned int i = 0; i < move_steps; i++) {
+        step();
+        start_point = std::chrono::high_resolution_clock::now();
+        for (unsigned int j = 0; j < box_count; j++) {
+            reinserted += tree.move(j, boxes[j]);
+        }
+        move_time += milliseconds_since(start_point);
+    }
+    s << "move: " << move_time / move_steps << " ms for every box, "
+      << reinserted / move_steps << " placed again, area ratio " << tree.get_area_ratio()
+      << "\n";
+
+    double refit_time = 0;
+    for (unsigned int i = 0; i < move_steps; i++) {
+        step();
+        start_point = std::chrono::high_resolution_clock::now();
+        for (unsigned int j = 0; j < box_count; j++) {
+            tree.set_box(j, boxes[j]);
+        }
+        tree.refit();
+        refit_time += milliseconds_since(start_point);
+    }
+    start_point = std::chrono::high_resolution_clock::now();
+    tree.flatten();
+    s << "refit: " << refit_time / move_steps << " ms for every box, area ratio "
+      << tree.get_area_ratio() << ", flattening " << milliseconds_since(start_point) << " ms\n";
+
+    // cameras standing in the square looking about, boxes about as large as a person, rays
+    // along the ground
+    std::vector<Aabb_tree::frustum_t> frustums;
+    std::vector<box_t> query_boxes;
+    std::vector<math::float3> origins, directions;
+    for (unsigned int i = 0; i < query_count; i++) {
+        math::matrix view = math::multiply(
+            math::translation(-position(generator), -5, -position(generator)),
+            math::rotation_y(turn(generator)));
+        frustums.push_back(Aabb_tree::get_frustum(
+            math::multiply(view, math::perspective_fov_lh(0.8f, 1.5f, 0.1f, 50))));
+        float x = position(generator), z = position(generator);
+        query_boxes.push_back({{x, 0, z}, {x + 1, 2, z + 1}});
+        float angle = turn(generator);
+        origins.push_back({position(generator), height(generator), position(generator)});
+        directions.push_back({std::cos(angle), 0, std::sin(angle)});
+    }
+
+    std::vector<unsigned int> results, expected;
+    std::size_t result_count = 0;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (const Aabb_tree::frustum_t &frustum : frustums) {
+        results.clear();
+        tree.query_frustum(frustum, results);
+        result_count += results.size();
+    }
+    double query_time = milliseconds_since(start_point);
+    unsigned int mismatches = 0;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int q = 0; q < checked_queries; q++) {
+        expected.clear();
+        for (unsigned int i = 0; i < box_count; i++) {
+            if (in_frustum(frustums[q], boxes[i])) {
+                expected.push_back(i);
+            }
+        }
+        results.clear();
+        tree.query_frustum(frustums[q], results);
+        std::sort(results.begin(), results.end());
+        mismatches += results != expected;
+    }
+    s << "frustum queries: " << query_time * 1000 / query_count << " us each, "
+      << static_cast<double>(result_count) / query_count << " found on average, brute force "
+      << milliseconds_since(start_point) * 1000 / checked_queries << " us each, " << mismatches
+      << " of " << checked_queries << " differ\n";
+
+    result_count = 0;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (const box_t &query_box : query_boxes) {
+        results.clear();
+        tree.query_box(query_box, results);
+        result_count += results.size();
+    }
+    query_time = milliseconds_since(start_point);
+    mismatches = 0;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int q = 0; q < checked_queries; q++) {
+        expected.clear();
+        for (unsigned int i = 0; i < box_count; i++) {
+            if (overlaps(query_boxes[q], boxes[i])) {
+                expected.push_back(i);
+            }
+        }
+        results.clear();
+        tree.query_box(query_boxes[q], results);
+        std::sort(results.begin(), results.end());
+        mismatches += results != expected;
+    }
+    s << "box queries: " << query_time * 1000 / query_count << " us each, "
+      << static_cast<double>(result_count) / query_count << " found on average, brute force "
+      << milliseconds_since(start_point) * 1000 / checked_queries << " us each, " << mismatches
+      << " of " << checked_queries << " differ\n";
+
+    unsigned int hit_count = 0, item;
+    float distance;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int q = 0; q < query_count; q++) {
+        hit_count += tree.raycast(origins[q], directions[q], max_ray_distance, item, distance);
+    }
+    query_time = milliseconds_since(start_point);
+    // the closest distance is compared, the item may differ between boxes entered at once
+    mismatches = 0;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int q = 0; q < checked_queries; q++) {
+        bool found = false;
+        float closest = max_ray_distance, box_distance;
+        for (const box_t &box : boxes) {
+            if (hits(origins[q], directions[q], box, closest, box_distance)
+                && (!found || box_distance < closest)) {
+                found = true;
+                closest = box_distance;
+            }
+        }
+        bool tree_found = tree.raycast(origins[q], directions[q], max_ray_distance, item,
+                                       distance);
+        mismatches += tree_found != found || (found && distance != closest);
+    }
+    s << "raycasts: " << query_time * 1000 / query_count << " us each, " << hit_count
+      << " of " << query_count << " hit, brute force "
+      << milliseconds_since(start_point) * 1000 / checked_queries << " us each, " << mismatches
+      << " of " << checked_queries << " differ\n";
+    return s.str();
+}
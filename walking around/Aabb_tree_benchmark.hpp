@@ -0,0 +1,7 @@
+#pragma once
+#include <string>
+
+// box_count boxes scattered over a square: building the tree by insertions, moving them all
+// one by one and by refitting, then frustum, box and ray queries against testing every box,
+// one line each
+std::string benchmark_aabb_tree(unsigned int box_count);
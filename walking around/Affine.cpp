@@ -0,0 +1,17 @@
+#include "Affine.hpp"
+
+namespace math {
+
+void then(const affine *a, std::size_t count, const affine &b, affine *out) {
+    for (std::size_t i = 0; i < count; i++) {
+        out[i] = then(a[i], b);
+    }
+}
+
+void store_column_major(const affine *transforms, std::size_t count, float4x4 *out) {
+    for (std::size_t i = 0; i < count; i++) {
+        store_column_major(out[i], transforms[i]);
+    }
+}
+
+} // namespace math
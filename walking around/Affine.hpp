@@ -0,0 +1,140 @@
+#pragma once
+#include "Math.hpp"
+
+// transforms whose last column is 0, 0, 0, 1, which every object, limb and view transform is,
+// built step by step in closed form instead of multiplying 4x4 matrices, a rotation about one
+// axis touches two columns and a translation three floats, then written to the shaders'
+// column-major layout without a transpose
+//
+// the products and sums are those of the 4x4 chains minus the ones with the constant zeros and
+// ones, in the same order, so the results have the same bits
+namespace math {
+
+struct affine {
+    public:
+        // v * the first three rows, then the last row added
+        float m[4][3];
+};
+
+inline affine affine_identity() {
+    return {{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {0, 0, 0}}};
+}
+
+inline affine affine_translation(float x, float y, float z) {
+    return {{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {x, y, z}}};
+}
+
+// scaled, rotated by the normalized q, then translated, the order of XMMatrixAffineTransformation
+inline affine affine_trs(const float3 &scale, quaternion q, const float3 &translation) {
+    float x = get_x(q), y = get_y(q), z = get_z(q), w = get_w(q);
+    return {{{scale.x * (1 - 2 * (y * y + z * z)), scale.x * 2 * (x * y + z * w),
+              scale.x * 2 * (x * z - y * w)},
+             {scale.y * 2 * (x * y - z * w), scale.y * (1 - 2 * (x * x + z * z)),
+              scale.y * 2 * (y * z + x * w)},
+             {scale.z * 2 * (x * z + y * w), scale.z * 2 * (y * z - x * w),
+              scale.z * (1 - 2 * (x * x + y * y))},
+             {translation.x, translation.y, translation.z}}};
+}
+
+// a, then a translation
+inline affine then_translation(affine a, float x, float y, float z) {
+    a.m[3][0] += x;
+    a.m[3][1] += y;
+    a.m[3][2] += z;
+    return a;
+}
+
+inline affine then_scaling(affine a, float x, float y, float z) {
+    for (float(&row)[3] : a.m) {
+        row[0] *= x;
+        row[1] *= y;
+        row[2] *= z;
+    }
+    return a;
+}
+
+// the rotations are rotation_x(), rotation_y() and rotation_z() applied to every row
+inline affine then_rotation_x(affine a, float angle) {
+    float sin, cos;
+    sin_cos(angle, sin, cos);
+    for (float(&row)[3] : a.m) {
+        float y = row[1], z = row[2];
+        row[1] = y * cos - z * sin;
+        row[2] = y * sin + z * cos;
+    }
+    return a;
+}
+
+inline affine then_rotation_y(affine a, float angle) {
+    float sin, cos;
+    sin_cos(angle, sin, cos);
+    for (float(&row)[3] : a.m) {
+        float x = row[0], z = row[2];
+        row[0] = x * cos + z * sin;
+        row[2] = z * cos - x * sin;
+    }
+    return a;
+}
+
+inline affine then_rotation_z(affine a, float angle) {
+    float sin, cos;
+    sin_cos(angle, sin, cos);
+    for (float(&row)[3] : a.m) {
+        float x = row[0], y = row[1];
+        row[0] = x * cos - y * sin;
+        row[1] = x * sin + y * cos;
+    }
+    return a;
+}
+
+// a rotation about the x axis through height pivot_y, like translation(0, -pivot_y, 0), then
+// rotation_x(), then translation(0, pivot_y, 0)
+inline affine affine_pivot_rotation_x(float pivot_y, float angle) {
+    float sin, cos;
+    sin_cos(angle, sin, cos);
+    return {{{1, 0, 0},
+             {0, cos, sin},
+             {0, -sin, cos},
+             {0, pivot_y - pivot_y * cos, -pivot_y * sin}}};
+}
+
+// a, then b, summed in the order of multiply()
+inline affine then(const affine &a, const affine &b) {
+    affine result;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            result.m[i][j] =
+                (a.m[i][0] * b.m[0][j] + a.m[i][2] * b.m[2][j]) + a.m[i][1] * b.m[1][j];
+        }
+    }
+    for (int j = 0; j < 3; j++) {
+        result.m[3][j] = (a.m[3][0] * b.m[0][j] + a.m[3][2] * b.m[2][j])
+                         + (a.m[3][1] * b.m[1][j] + b.m[3][j]);
+    }
+    return result;
+}
+
+inline matrix to_matrix(const affine &a) {
+    return {{set(a.m[0][0], a.m[0][1], a.m[0][2], 0), set(a.m[1][0], a.m[1][1], a.m[1][2], 0),
+             set(a.m[2][0], a.m[2][1], a.m[2][2], 0), set(a.m[3][0], a.m[3][1], a.m[3][2], 1)}};
+}
+
+// every float written once and in order, so f can be mapped write-combined memory
+inline void store_column_major(float4x4 &f, const affine &a) {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 4; j++) {
+            f.m[i][j] = a.m[j][i];
+        }
+    }
+    f.m[3][0] = 0;
+    f.m[3][1] = 0;
+    f.m[3][2] = 0;
+    f.m[3][3] = 1;
+}
+
+// the batch versions, out may be the input array itself
+void then(const affine *a, std::size_t count, const affine &b, affine *out);
+
+void store_column_major(const affine *transforms, std::size_t count, float4x4 *out);
+
+} // namespace math
@@ -0,0 +1,347 @@
+#include "Asset_archive.hpp"
+#include "Lz4.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+std::uint64_t align_up(std::uint64_t offset, std::uint64_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+std::string Asset_archive::get_name(const std::filesystem::path &path) {
+    return path.lexically_normal().generic_string();
+}
+
+const Asset_archive::entry_t &Asset_archive::find(const std::filesystem::path &path) {
+    auto it = entries.find(get_name(path));
+    if (it == entries.end()) {
+        throw std::runtime_error(path.string() + " isn't in the archive");
+    }
+    return it->second;
+}
+
+void Asset_archive::map(const std::filesystem::path &archive_path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(archive_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("can't open " + archive_path.string());
+    }
+    LARGE_INTEGER file_size = {};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        throw std::runtime_error(archive_path.string() + " is empty");
+    }
+    // the view keeps the file and the mapping open
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        throw std::runtime_error("can't map " + archive_path.string());
+    }
+    data = static_cast<const unsigned char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (!data) {
+        throw std::runtime_error("can't map " + archive_path.string());
+    }
+    size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+    int descriptor = open(archive_path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("can't open " + archive_path.string());
+    }
+    struct stat file_stat = {};
+    if (fstat(descriptor, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(descriptor);
+        throw std::runtime_error(archive_path.string() + " is empty");
+    }
+    void *mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("can't map " + archive_path.string());
+    }
+    data = static_cast<const unsigned char *>(mapping);
+    size = static_cast<std::size_t>(file_stat.st_size);
+#endif
+}
+
+void Asset_archive::read_index() {
+    header_t header;
+    if (size < sizeof(header)) {
+        throw std::runtime_error("the archive has no header");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version) {
+        throw std::runtime_error("the archive isn't of a known version");
+    }
+    if (header.index_size > size - sizeof(header)) {
+        throw std::runtime_error("the archive's index is cut off");
+    }
+
+    const unsigned char *in = data + sizeof(header), *in_end = in + header.index_size;
+    auto take = [&](void *destination, std::size_t bytes) {
+        if (bytes > std::size_t(in_end - in)) {
+            throw std::runtime_error("the archive's index is cut off");
+        }
+        if (bytes == 0) {
+            return;
+        }
+        std::memcpy(destination, in, bytes);
+        in += bytes;
+    };
+
+    for (std::uint32_t i = 0; i < header.entry_count; i++) {
+        entry_t entry;
+        take(&entry.header, sizeof(entry.header));
+        std::string name(entry.header.name_length, '\0');
+        take(name.data(), name.size());
+        entry.block_sizes.resize(entry.header.block_count);
+        take(entry.block_sizes.data(), entry.block_sizes.size() * sizeof(std::uint32_t));
+
+        const index_entry_t &index = entry.header;
+        if (index.offset > size || index.stored_size > size - index.offset) {
+            throw std::runtime_error(name + " runs past the end of the archive");
+        }
+        bool blocks_match;
+        if (index.mode == stored) {
+            blocks_match = index.block_count == 0 && index.stored_size == index.size;
+        } else {
+            std::uint64_t offset = index.offset;
+            for (std::uint32_t block_size_flags : entry.block_sizes) {
+                entry.block_offsets.push_back(offset);
+                offset += block_size_flags & ~stored_block;
+            }
+            blocks_match = index.mode == lz4_blocks && offset == index.offset + index.stored_size
+                           && index.block_count == (index.size + block_size - 1) / block_size;
+        }
+        if (!blocks_match) {
+            throw std::runtime_error(name + " has broken blocks");
+        }
+        entries.emplace(std::move(name), std::move(entry));
+    }
+}
+
+void Asset_archive::decompress_block(const entry_t &entry, unsigned int block,
+                                     char *destination) {
+    std::uint32_t stored_size = entry.block_sizes[block] & ~stored_block;
+    std::size_t bytes = (std::min)(std::uint64_t(block_size),
+                                   entry.header.size - std::uint64_t(block) * block_size);
+    const unsigned char *source = data + entry.block_offsets[block];
+    unsigned char *out = reinterpret_cast<unsigned char *>(destination);
+
+    if (entry.block_sizes[block] & stored_block) {
+        if (stored_size != bytes) {
+            throw std::runtime_error("a stored block of the archive has the wrong size");
+        }
+        std::memcpy(out, source, bytes);
+    } else if (!lz4::decompress(source, stored_size, out, bytes)) {
+        throw std::runtime_error("a block of the archive doesn't decompress");
+    }
+}
+
+Asset_archive::~Asset_archive() {
+    release();
+}
+
+Asset_archive::pack_report_t Asset_archive::pack(const std::filesystem::path &directory,
+                                                 const std::filesystem::path &archive_path) {
+    struct packed_t {
+        public:
+            std::string name;
+            index_entry_t header;
+            std::vector<std::uint32_t> block_sizes;
+            std::vector<char> stored;
+    };
+
+    std::filesystem::path root = std::filesystem::absolute(directory).lexically_normal();
+    if (!root.has_filename()) {
+        root = root.parent_path();
+    }
+    std::vector<std::filesystem::path> files;
+    for (const auto &file : std::filesystem::recursive_directory_iterator(root)) {
+        if (file.is_regular_file()) {
+            files.push_back(file.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    pack_report_t report;
+    Loose_files loose_files;
+    std::vector<packed_t> packed;
+    std::uint64_t index_size = 0;
+    for (const std::filesystem::path &file : files) {
+        std::vector<char> contents = loose_files.read(file);
+        packed_t entry;
+        entry.name = get_name(root.filename() / std::filesystem::relative(file, root));
+        entry.header = {.offset = 0,
+                        .size = contents.size(),
+                        .stored_size = 0,
+                        .hash = hash(contents.data(), contents.size()),
+                        .mode = lz4_blocks,
+                        .block_count = 0,
+                        .name_length = static_cast<std::uint32_t>(entry.name.size()),
+                        .padding = 0};
+
+        const unsigned char *source = reinterpret_cast<const unsigned char *>(contents.data());
+        for (std::size_t first = 0; first < contents.size(); first += block_size) {
+            std::size_t bytes = (std::min)(std::size_t(block_size), contents.size() - first);
+            std::size_t at = entry.stored.size();
+            entry.stored.resize(at + lz4::get_max_compressed_size(bytes));
+            unsigned char *out = reinterpret_cast<unsigned char *>(entry.stored.data() + at);
+            std::size_t stored_size = lz4::compress(source + first, bytes, out);
+            if (stored_size >= bytes) {
+                std::memcpy(out, source + first, bytes);
+                entry.block_sizes.push_back(static_cast<std::uint32_t>(bytes) | stored_block);
+                stored_size = bytes;
+            } else {
+                entry.block_sizes.push_back(static_cast<std::uint32_t>(stored_size));
+            }
+            entry.stored.resize(at + stored_size);
+        }
+
+        if (entry.stored.size() > contents.size() * max_compressed_ratio) {
+            entry.header.mode = stored;
+            entry.block_sizes.clear();
+            entry.stored = std::move(contents);
+        } else {
+            report.compressed_entries++;
+        }
+        entry.header.block_count = static_cast<std::uint32_t>(entry.block_sizes.size());
+        entry.header.stored_size = entry.stored.size();
+
+        index_size += sizeof(index_entry_t) + entry.name.size()
+                      + entry.block_sizes.size() * sizeof(std::uint32_t);
+        report.entries++;
+        report.bytes += entry.header.size;
+        packed.push_back(std::move(entry));
+    }
+    if (index_size > UINT32_MAX || packed.size() > UINT32_MAX) {
+        throw std::runtime_error("too many files for one archive");
+    }
+
+    std::uint64_t offset = align_up(sizeof(header_t) + index_size, alignment);
+    for (packed_t &entry : packed) {
+        entry.header.offset = offset;
+        offset = align_up(offset + entry.header.stored_size, alignment);
+    }
+
+    std::ofstream archive(archive_path, std::ios::binary | std::ios::trunc);
+    if (!archive) {
+        throw std::runtime_error("can't create " + archive_path.string());
+    }
+    header_t header = {.magic = {},
+                       .version = version,
+                       .entry_count = static_cast<std::uint32_t>(packed.size()),
+                       .index_size = static_cast<std::uint32_t>(index_size)};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    archive.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const packed_t &entry : packed) {
+        archive.write(reinterpret_cast<const char *>(&entry.header), sizeof(entry.header));
+        archive.write(entry.name.data(), entry.name.size());
+        archive.write(reinterpret_cast<const char *>(entry.block_sizes.data()),
+                      entry.block_sizes.size() * sizeof(std::uint32_t));
+    }
+    std::uint64_t written = sizeof(header_t) + index_size;
+    for (const packed_t &entry : packed) {
+        std::vector<char> padding(entry.header.offset - written, 0);
+        archive.write(padding.data(), padding.size());
+        archive.write(entry.stored.data(), entry.stored.size());
+        written = entry.header.offset + entry.header.stored_size;
+    }
+    if (!archive) {
+        throw std::runtime_error("can't write " + archive_path.string());
+    }
+    report.archive_bytes = written;
+    return report;
+}
+
+void Asset_archive::init(const std::filesystem::path &archive_path, Job_system *_job_system) {
+    release();
+    job_system = _job_system;
+    map(archive_path);
+    try {
+        read_index();
+    } catch (...) {
+        release();
+        throw;
+    }
+    statistics = {};
+    statistics.files_opened = 1;
+}
+
+bool Asset_archive::contains(const std::filesystem::path &path) {
+    return entries.contains(get_name(path));
+}
+
+std::uint64_t Asset_archive::get_stamp(const std::filesystem::path &path) {
+    return find(path).header.hash;
+}
+
+std::vector<char> Asset_archive::read(const std::filesystem::path &path) {
+    const entry_t &entry = find(path);
+    auto start_point = std::chrono::high_resolution_clock::now();
+
+    std::vector<char> contents(entry.header.size);
+    unsigned int block_count = entry.header.block_count;
+    if (entry.header.mode == stored) {
+        std::memcpy(contents.data(), data + entry.header.offset, contents.size());
+    } else if (job_system && block_count > 1) {
+        job_system->parallel_for(0, block_count, 1, [&](unsigned int first, unsigned int end) {
+            for (unsigned int block = first; block < end; block++) {
+                decompress_block(entry, block, contents.data() + std::size_t(block) * block_size);
+            }
+        });
+    } else {
+        for (unsigned int block = 0; block < block_count; block++) {
+            decompress_block(entry, block, contents.data() + std::size_t(block) * block_size);
+        }
+    }
+    auto end_point = std::chrono::high_resolution_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    statistics.reads++;
+    statistics.bytes_read += entry.header.stored_size;
+    statistics.bytes += contents.size();
+    statistics.milliseconds +=
+        std::chrono::duration<double, std::milli>(end_point - start_point).count();
+    return contents;
+}
+
+Asset_source::statistics_t Asset_archive::get_statistics() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return statistics;
+}
+
+unsigned int Asset_archive::get_entry_count() {
+    return static_cast<unsigned int>(entries.size());
+}
+
+void Asset_archive::release() {
+    entries.clear();
+    if (!data) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<unsigned char *>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+}
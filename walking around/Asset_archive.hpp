@@ -0,0 +1,108 @@
+#pragma once
+#include "Asset_source.hpp"
+#include "Job_system.hpp"
+
+#include <string>
+#include <unordered_map>
+
+// every file of a directory in one memory mapped file, opened once instead of a file per
+// asset, entries are stored or LZ4 compressed in blocks that decompress in parallel
+//
+// layout: header_t, then per entry an index_entry_t, its name and its block sizes, the
+// entries start on 4 KB boundaries after the index, their blocks one after the other
+class Asset_archive : public Asset_source {
+    public:
+        struct pack_report_t {
+            public:
+                unsigned int entries = 0;
+                unsigned int compressed_entries = 0;
+                std::uint64_t bytes = 0;
+                std::uint64_t archive_bytes = 0;
+        };
+
+    private:
+        constexpr static char magic[4] = {'W', 'A', 'P', 'K'};
+        constexpr static std::uint32_t version = 1;
+        constexpr static std::uint64_t alignment = 4096;
+        constexpr static std::uint32_t block_size = 64 * 1024;
+        // blocks LZ4 can't shrink are kept as they are
+        constexpr static std::uint32_t stored_block = 0x80000000;
+        // entries that don't compress better than this are stored
+        constexpr static float max_compressed_ratio = 0.9f;
+
+        enum storage_t : std::uint32_t { stored, lz4_blocks };
+
+        struct header_t {
+            public:
+                char magic[4];
+                std::uint32_t version;
+                std::uint32_t entry_count;
+                std::uint32_t index_size;
+        };
+
+        struct index_entry_t {
+            public:
+                std::uint64_t offset;
+                std::uint64_t size;
+                std::uint64_t stored_size;
+                std::uint64_t hash; // of the contents, the stamp
+                std::uint32_t mode;
+                std::uint32_t block_count;
+                std::uint32_t name_length;
+                std::uint32_t padding;
+        };
+
+        struct entry_t {
+            public:
+                index_entry_t header;
+                // where each block starts in the mapping
+                std::vector<std::uint64_t> block_offsets;
+                // with the stored_block flag
+                std::vector<std::uint32_t> block_sizes;
+        };
+
+        const unsigned char *data = nullptr;
+        std::size_t size = 0;
+        Job_system *job_system = nullptr;
+        std::unordered_map<std::string, entry_t> entries;
+
+        std::mutex mutex;
+        statistics_t statistics;
+
+        // the name a path has in the archive
+        static std::string get_name(const std::filesystem::path &path);
+
+        const entry_t &find(const std::filesystem::path &path);
+
+        void map(const std::filesystem::path &archive_path);
+
+        void read_index();
+
+        void decompress_block(const entry_t &entry, unsigned int block, char *destination);
+
+    public:
+        Asset_archive() = default;
+        Asset_archive(const Asset_archive &) = delete;
+        Asset_archive &operator=(const Asset_archive &) = delete;
+        ~Asset_archive();
+
+        // packs every file under directory, named directory's name / their relative path,
+        // so the archive of resources/ holds what the game asks for as resources/...
+        static pack_report_t pack(const std::filesystem::path &directory,
+                                  const std::filesystem::path &archive_path);
+
+        // _job_system decompresses the blocks of an entry in parallel, null for one thread
+        void init(const std::filesystem::path &archive_path, Job_system *_job_system);
+
+        bool contains(const std::filesystem::path &path);
+
+        std::uint64_t get_stamp(const std::filesystem::path &path) override;
+
+        std::vector<char> read(const std::filesystem::path &path) override;
+
+        statistics_t get_statistics() override;
+
+        unsigned int get_entry_count();
+
+        void release();
+};
@@ -0,0 +1,175 @@
+#pragma once
+#include "Asset_source.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// shares assets loaded from files between everyone using them, keyed by the file's content
+// hash, so a file reached by several paths or several requests at once is loaded once,
+// the cache only holds weak references and an asset goes away with its last handle
+template <typename T>
+class Asset_cache {
+    public:
+        using handle_t = std::shared_ptr<T>;
+        // fills a default constructed asset from the file's contents, runs on the thread
+        // of the first request
+        using load_function = std::function<void(T &asset, const std::vector<char> &contents)>;
+        // CPU and GPU memory the asset holds
+        using size_function = std::function<std::size_t(const T &asset)>;
+
+        struct report_entry_t {
+            public:
+                std::string path; // the one it was first loaded from
+                std::uint64_t key;
+                std::size_t bytes;
+                long handles;
+        };
+
+        struct statistics_t {
+            public:
+                unsigned int requests = 0;
+                unsigned int loads = 0;
+                // requests that waited for a load another thread had started
+                unsigned int coalesced = 0;
+        };
+
+    private:
+        struct entry_t {
+            public:
+                std::string path;
+                std::weak_ptr<T> asset;
+                // valid while the asset is being loaded
+                std::shared_future<handle_t> loading;
+                std::size_t bytes = 0;
+        };
+
+        // what a path held when it was last read, to skip reading it again
+        struct path_entry_t {
+            public:
+                std::uint64_t stamp;
+                std::uint64_t key;
+        };
+
+        size_function get_size;
+        Loose_files loose_files;
+        Asset_source *source = &loose_files;
+        std::mutex mutex;
+        std::unordered_map<std::uint64_t, entry_t> entries;
+        std::map<std::pair<std::string, std::uint64_t>, path_entry_t> paths;
+        statistics_t statistics;
+
+    public:
+        // FNV-1a, seed tells apart assets built differently from the same contents
+        static std::uint64_t hash(const void *data, std::size_t size,
+                                  std::uint64_t seed = 0) {
+            return Asset_source::hash(data, size, seed);
+        }
+
+        // files are read from _source, loose files when it is null
+        void init(const size_function &_get_size, Asset_source *_source = nullptr) {
+            get_size = _get_size;
+            source = _source ? _source : &loose_files;
+        }
+
+        // variant goes into the key with the contents, the load function must build the
+        // same asset for the same contents and variant
+        handle_t get(const std::filesystem::path &path, std::uint64_t variant,
+                     const load_function &load) {
+            std::string path_string = path.string();
+            std::uint64_t stamp = source->get_stamp(path);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                statistics.requests++;
+                auto known = paths.find({path_string, variant});
+                if (known != paths.end() && known->second.stamp == stamp) {
+                    auto entry = entries.find(known->second.key);
+                    handle_t asset = entry != entries.end() ? entry->second.asset.lock() : nullptr;
+                    if (asset) {
+                        return asset;
+                    }
+                }
+            }
+
+            std::vector<char> contents = source->read(path);
+            std::uint64_t key = hash(contents.data(), contents.size(), variant);
+
+            std::promise<handle_t> promise;
+            std::shared_future<handle_t> loading;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                paths[{path_string, variant}] = {stamp, key};
+                entry_t &entry = entries[key];
+                if (handle_t asset = entry.asset.lock()) {
+                    return asset;
+                }
+                if (entry.loading.valid()) {
+                    loading = entry.loading;
+                    statistics.coalesced++;
+                } else {
+                    entry.path = path_string;
+                    entry.loading = promise.get_future().share();
+                    statistics.loads++;
+                }
+            }
+            if (loading.valid()) {
+                // rethrows when the other request's load failed
+                return loading.get();
+            }
+
+            try {
+                handle_t asset = std::make_shared<T>();
+                load(*asset, contents);
+                std::size_t bytes = get_size(*asset);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    entry_t &entry = entries[key];
+                    entry.asset = asset;
+                    entry.bytes = bytes;
+                    entry.loading = {};
+                }
+                promise.set_value(asset);
+                return asset;
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    entries.erase(key);
+                }
+                promise.set_exception(std::current_exception());
+                throw;
+            }
+        }
+
+        // the assets that still have handles, forgets the others
+        std::vector<report_entry_t> get_report() {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<report_entry_t> report;
+            for (auto it = entries.begin(); it != entries.end();) {
+                long handles = it->second.asset.use_count();
+                if (handles == 0 && !it->second.loading.valid()) {
+                    it = entries.erase(it);
+                    continue;
+                }
+                if (handles > 0) {
+                    report.push_back({it->second.path, it->first, it->second.bytes, handles});
+                }
+                ++it;
+            }
+            return report;
+        }
+
+        statistics_t get_statistics() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return statistics;
+        }
+};
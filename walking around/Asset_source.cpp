@@ -0,0 +1,48 @@
+#include "Asset_source.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+
+std::uint64_t Asset_source::hash(const void *data, std::size_t size, std::uint64_t seed) {
+    std::uint64_t result = 14695981039346656037ull ^ seed;
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < size; i++) {
+        result = (result ^ bytes[i]) * 1099511628211ull;
+    }
+    return result;
+}
+
+std::uint64_t Loose_files::get_stamp(const std::filesystem::path &path) {
+    return std::filesystem::last_write_time(path).time_since_epoch().count()
+           ^ std::filesystem::file_size(path);
+}
+
+std::vector<char> Loose_files::read(const std::filesystem::path &path) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("can't open " + path.string());
+    }
+    std::vector<char> contents(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(contents.data(), contents.size());
+    if (!file) {
+        throw std::runtime_error("can't read " + path.string());
+    }
+    auto end_point = std::chrono::high_resolution_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    statistics.files_opened++;
+    statistics.reads++;
+    statistics.bytes_read += contents.size();
+    statistics.bytes += contents.size();
+    statistics.milliseconds +=
+        std::chrono::duration<double, std::milli>(end_point - start_point).count();
+    return contents;
+}
+
+Asset_source::statistics_t Loose_files::get_statistics() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return statistics;
+}
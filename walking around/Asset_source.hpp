@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+// where asset files are read from, may be called from several threads at once
+class Asset_source {
+    public:
+        struct statistics_t {
+            public:
+                unsigned int files_opened = 0;
+                unsigned int reads = 0;
+                // what came off the disk and what it turned into
+                std::uint64_t bytes_read = 0;
+                std::uint64_t bytes = 0;
+                double milliseconds = 0;
+        };
+
+        virtual ~Asset_source() = default;
+
+        // FNV-1a, seed tells apart assets built differently from the same contents
+        static std::uint64_t hash(const void *data, std::size_t size, std::uint64_t seed = 0);
+
+        // changes whenever the file's contents do, cheaper than reading it
+        virtual std::uint64_t get_stamp(const std::filesystem::path &path) = 0;
+
+        virtual std::vector<char> read(const std::filesystem::path &path) = 0;
+
+        virtual statistics_t get_statistics() = 0;
+};
+
+// the files as they are on disk
+class Loose_files : public Asset_source {
+    private:
+        std::mutex mutex;
+        statistics_t statistics;
+
+    public:
+        std::uint64_t get_stamp(const std::filesystem::path &path) override;
+
+        std::vector<char> read(const std::filesystem::path &path) override;
+
+        statistics_t get_statistics() override;
+};
@@ -0,0 +1,168 @@
+#include "Cell_residency.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+struct wanted_t {
+    public:
+        Cell_residency::cell_t cell;
+        float distance;
+};
+
+} // namespace
+
+float Cell_residency::get_distance(const cell_t &cell, float x, float z) const {
+    float min_x = cell.x * cell_size, min_z = cell.z * cell_size;
+    float dx = (std::max)({min_x - x, x - (min_x + cell_size), 0.0f});
+    float dz = (std::max)({min_z - z, z - (min_z + cell_size), 0.0f});
+    return std::sqrt(dx * dx + dz * dz);
+}
+
+std::uint64_t Cell_residency::get_expected_size(const cell_t &cell) const {
+    auto known = known_sizes.find(get_id(cell));
+    if (known != known_sizes.end()) {
+        return known->second.size;
+    }
+    std::size_t resident = cells.size() - statistics.loads_in_flight;
+    return resident > 0 ? statistics.usage / resident : 0;
+}
+
+void Cell_residency::unload(std::unordered_map<std::uint64_t, entry_t>::iterator entry,
+                            std::vector<cell_t> &unloads) {
+    statistics.usage -= entry->second.size;
+    known_sizes[entry->first] = entry->second;
+    statistics.unloads++;
+    unloads.push_back(entry->second.cell);
+    cells.erase(entry);
+}
+
+bool Cell_residency::unload_farthest(float distance, std::vector<cell_t> &unloads) {
+    auto farthest = cells.end();
+    for (auto entry = cells.begin(); entry != cells.end(); ++entry) {
+        if (!entry->second.loading && entry->second.distance > distance
+            && (farthest == cells.end() || entry->second.distance > farthest->second.distance)) {
+            farthest = entry;
+        }
+    }
+    if (farthest == cells.end()) {
+        return false;
+    }
+    unload(farthest, unloads);
+    return true;
+}
+
+void Cell_residency::init(float _cell_size, float _load_radius, float _unload_radius,
+                          std::uint64_t budget, unsigned int _max_loads_in_flight) {
+    if (_unload_radius < _load_radius) {
+        throw std::runtime_error("cells would be unloaded within the load radius");
+    }
+    cell_size = _cell_size;
+    load_radius = _load_radius;
+    unload_radius = _unload_radius;
+    max_loads_in_flight = _max_loads_in_flight;
+    cells.clear();
+    known_sizes.clear();
+    statistics = {};
+    statistics.budget = budget;
+}
+
+Cell_residency::changes_t Cell_residency::update(float x, float z) {
+    changes_t changes;
+    std::vector<std::uint64_t> out_of_range;
+    for (auto &[id, entry] : cells) {
+        entry.distance = get_distance(entry.cell, x, z);
+        if (!entry.loading && entry.distance > unload_radius) {
+            out_of_range.push_back(id);
+        }
+    }
+    for (std::uint64_t id : out_of_range) {
+        unload(cells.find(id), changes.unloads);
+    }
+    std::erase_if(known_sizes, [this, x, z](const auto &known) {
+        return get_distance(known.second.cell, x, z) > unload_radius;
+    });
+
+    std::vector<wanted_t> wanted;
+    cell_t low = get_cell(x - load_radius, z - load_radius);
+    cell_t high = get_cell(x + load_radius, z + load_radius);
+    for (int cell_z = low.z; cell_z <= high.z; cell_z++) {
+        for (int cell_x = low.x; cell_x <= high.x; cell_x++) {
+            cell_t cell = {cell_x, cell_z};
+            float distance = get_distance(cell, x, z);
+            if (distance <= load_radius && !cells.contains(get_id(cell))) {
+                wanted.push_back({cell, distance});
+            }
+        }
+    }
+    std::stable_sort(wanted.begin(), wanted.end(), [](const wanted_t &a, const wanted_t &b) {
+        return a.distance < b.distance;
+    });
+
+    for (const wanted_t &cell : wanted) {
+        if (statistics.loads_in_flight >= max_loads_in_flight) {
+            break;
+        }
+        std::uint64_t expected_size = get_expected_size(cell.cell);
+        bool fits = true;
+        while (fits && statistics.usage + statistics.reserved + expected_size
+                           > statistics.budget) {
+            fits = unload_farthest(cell.distance, changes.unloads);
+        }
+        if (!fits) {
+            break;
+        }
+        cells[get_id(cell.cell)] = {cell.cell, true, expected_size, cell.distance};
+        statistics.reserved += expected_size;
+        statistics.loads_in_flight++;
+        changes.loads.push_back(cell.cell);
+    }
+    return changes;
+}
+
+void Cell_residency::finish_load(const cell_t &cell, std::uint64_t size,
+                                 std::vector<cell_t> &unloads) {
+    auto entry = cells.find(get_id(cell));
+    if (entry == cells.end() || !entry->second.loading) {
+        throw std::runtime_error("the cell isn't loading");
+    }
+    statistics.reserved -= entry->second.size;
+    entry->second.loading = false;
+    entry->second.size = size;
+    statistics.usage += size;
+    statistics.loads_in_flight--;
+    statistics.loads++;
+    // farthest first, down to the new cell itself
+    std::size_t first_unload = unloads.size();
+    while (statistics.usage > statistics.budget && unload_farthest(-1, unloads)) {
+    }
+    for (std::size_t i = first_unload; i < unloads.size(); i++) {
+        statistics.refused += unloads[i] == cell;
+    }
+}
+
+bool Cell_residency::is_resident(const cell_t &cell) const {
+    auto entry = cells.find(get_id(cell));
+    return entry != cells.end() && !entry->second.loading;
+}
+
+Cell_residency::cell_t Cell_residency::get_cell(float x, float z) const {
+    return {static_cast<int>(std::floor(x / cell_size)),
+            static_cast<int>(std::floor(z / cell_size))};
+}
+
+float Cell_residency::get_cell_size() const {
+    return cell_size;
+}
+
+const Cell_residency::statistics_t &Cell_residency::get_statistics() {
+    statistics.resident = static_cast<unsigned int>(cells.size()) - statistics.loads_in_flight;
+    return statistics;
+}
+
+std::uint64_t Cell_residency::get_id(const cell_t &cell) {
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.x)) << 32
+           | static_cast<std::uint32_t>(cell.z);
+}
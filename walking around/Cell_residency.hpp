@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// decides which cells of an endless grid on the ground are resident around a point: cells
+// closer than the load radius are loaded nearest first, resident ones are unloaded only once
+// they are farther than the larger unload radius, so walking along a cell's border doesn't load
+// and unload it over and over
+//
+// a cell's size is only known once it is loaded, a load in flight holds the size the cell had
+// when it was last resident or else the resident cells' average, out of the budget's headroom,
+// the farthest resident cells make room for nearer ones and nothing more is loaded when there
+// are none
+//
+// when a load comes in bigger than it held, the farthest resident cells are unloaded until the
+// usage is within the budget again, the new cell too when it is the farthest, so the usage never
+// goes over the budget
+class Cell_residency {
+    public:
+        struct cell_t {
+            public:
+                int x, z;
+
+                bool operator==(const cell_t &) const = default;
+        };
+
+        struct changes_t {
+            public:
+                // counted as loading, finish_load() makes them resident
+                std::vector<cell_t> loads;
+                // no longer resident, their contents must be dropped
+                std::vector<cell_t> unloads;
+        };
+
+        struct statistics_t {
+            public:
+                unsigned int resident = 0;
+                unsigned int loads_in_flight = 0;
+                unsigned int loads = 0;
+                unsigned int unloads = 0;
+                // loads unloaded as they came in, for want of room
+                unsigned int refused = 0;
+                std::uint64_t usage = 0;
+                // held by the loads in flight
+                std::uint64_t reserved = 0;
+                std::uint64_t budget = 0;
+        };
+
+    private:
+        struct entry_t {
+            public:
+                cell_t cell;
+                bool loading = true;
+                // held while loading
+                std::uint64_t size = 0;
+                // from the last update()
+                float distance = 0;
+        };
+
+        float cell_size = 0;
+        float load_radius = 0, unload_radius = 0;
+        unsigned int max_loads_in_flight = 0;
+        std::unordered_map<std::uint64_t, entry_t> cells;
+        // the sizes of cells unloaded within the unload radius, which are likely wanted again
+        std::unordered_map<std::uint64_t, entry_t> known_sizes;
+        statistics_t statistics;
+
+        // from x, z to the closest point of the cell's square
+        float get_distance(const cell_t &cell, float x, float z) const;
+
+        // what a load of cell is expected to take
+        std::uint64_t get_expected_size(const cell_t &cell) const;
+
+        void unload(std::unordered_map<std::uint64_t, entry_t>::iterator entry,
+                    std::vector<cell_t> &unloads);
+
+        // unloads the farthest resident cell farther than distance, false when there is none
+        bool unload_farthest(float distance, std::vector<cell_t> &unloads);
+
+    public:
+        // throws when _unload_radius is below _load_radius
+        void init(float _cell_size, float _load_radius, float _unload_radius,
+                  std::uint64_t budget, unsigned int _max_loads_in_flight);
+
+        // once a frame with where the cells are wanted around
+        changes_t update(float x, float z);
+
+        // the load update() asked for is done, a cell that has gone out of range since is
+        // unloaded by the next update(), the cells unloaded to keep within the budget are
+        // appended to unloads, cell among them when it was refused
+        void finish_load(const cell_t &cell, std::uint64_t size, std::vector<cell_t> &unloads);
+
+        bool is_resident(const cell_t &cell) const;
+
+        cell_t get_cell(float x, float z) const;
+
+        float get_cell_size() const;
+
+        const statistics_t &get_statistics();
+
+        // unique for every cell, to keep them in maps
+        static std::uint64_t get_id(const cell_t &cell);
+};
@@ -0,0 +1,407 @@
+#include "Cell_streamer.hpp"
+#include "Shader_const_buffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+math::vector load_array(const FLOAT(&a)[3]) {
+    return math::set(a[0], a[1], a[2], 1);
+}
+
+double get_microseconds(std::chrono::high_resolution_clock::time_point start_point) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::high_resolution_clock::now() - start_point)
+               .count()
+           / 1000.0;
+}
+
+} // namespace
+
+Cell_streamer::prepared_t Cell_streamer::prepare(const Cell_residency::cell_t &key) {
+    prepared_t prepared;
+    world_cells::get_placements(key, exclusions, prepared.placements);
+    constexpr float no_extent = std::numeric_limits<float>::max();
+    prepared.box = {{no_extent, no_extent, no_extent}, {-no_extent, -no_extent, -no_extent}};
+
+    std::vector<math::float3> wall_positions;
+    for (unsigned int kind = 0; kind < world_cells::kind_count; kind++) {
+        const Mesh &mesh = *meshes[kind];
+        const std::vector<vertex_t> &vertices = mesh.get_cpu_vertices();
+        // the full detail triangles, over the same vertices
+        const std::vector<UINT> &indices = mesh.get_collision_mesh().indices;
+        for (const math::affine &transform : prepared.placements.transforms[kind]) {
+            math::matrix world = math::to_matrix(transform);
+            float ground_y = transform.m[3][1];
+            prepared.max_scales[kind] =
+                (std::max)(prepared.max_scales[kind], world_cells::get_scale(transform));
+
+            wall_positions.resize(vertices.size());
+            for (std::size_t i = 0; i < vertices.size(); i++) {
+                math::float3 position;
+                math::store(position, math::transform3(load_array(vertices[i].position), world));
+                wall_positions[i] = {position.x, position.y - ground_y, position.z};
+                prepared.box.min = {(std::min)(prepared.box.min.x, position.x),
+                                    (std::min)(prepared.box.min.y, position.y),
+                                    (std::min)(prepared.box.min.z, position.z)};
+                prepared.box.max = {(std::max)(prepared.box.max.x, position.x),
+                                    (std::max)(prepared.box.max.y, position.y),
+                                    (std::max)(prepared.box.max.z, position.z)};
+            }
+            Collision_world::cut_walls(wall_low_y, wall_high_y, wall_positions.data(),
+                                       indices.data(), indices.size(), prepared.walls);
+        }
+    }
+    return prepared;
+}
+
+std::shared_ptr<Cell_streamer::cell_t> Cell_streamer::create(prepared_t &prepared) {
+    auto cell = std::make_shared<cell_t>();
+    cell->box = prepared.box;
+    cell->placements = std::move(prepared.placements);
+    std::copy(std::begin(prepared.max_scales), std::end(prepared.max_scales),
+              cell->max_scales);
+    cell->walls = std::move(prepared.walls);
+    cell->size = world_cells::get_count(cell->placements) * sizeof(math::affine)
+                 + cell->walls.size() * sizeof(Collision_world::segment_t);
+
+    std::vector<math::affine> transforms;
+    for (const std::vector<math::affine> &placed : cell->placements.transforms) {
+        transforms.insert(transforms.end(), placed.begin(), placed.end());
+    }
+    if (transforms.empty()) {
+        return cell;
+    }
+    cell->instance_buffer.init(m_device, upload_batch, transforms);
+    const D3D12_VERTEX_BUFFER_VIEW &view = cell->instance_buffer.get_view();
+    UINT first = 0;
+    for (unsigned int kind = 0; kind < world_cells::kind_count; kind++) {
+        UINT count = static_cast<UINT>(cell->placements.transforms[kind].size());
+        cell->instance_views[kind] = {
+            .BufferLocation = view.BufferLocation + first * sizeof(math::affine),
+            .SizeInBytes = static_cast<UINT>(count * sizeof(math::affine)),
+            .StrideInBytes = sizeof(math::affine)};
+        first += count;
+    }
+    cell->size += view.SizeInBytes;
+    return cell;
+}
+
+void Cell_streamer::create_kind_vertices() {
+    kind_vertices.clear();
+    for (const Asset_cache<Mesh>::handle_t &mesh : meshes) {
+        std::vector<vertex_t> vertices = mesh->get_cpu_vertices();
+        // the group's id gives way to the cells' own, the slice stays
+        for (vertex_t &vertex : vertices) {
+            vertex.mat_index = mat_id | (vertex.mat_index & ~((1u << MAT_INDEX_BITS) - 1));
+        }
+        auto vertex_buffer = std::make_shared<Vertex_buffer>();
+#ifdef PACKED_VERTICES
+        vertex_buffer->init(m_device, upload_batch, pack_vertices(vertices, mesh->get_bounds()));
+#else
+        vertex_buffer->init(m_device, upload_batch, vertices);
+#endif
+        kind_vertices.push_back(std::move(vertex_buffer));
+    }
+    upload_batch.flush();
+}
+
+void Cell_streamer::start_batch(Job_system &job_system) {
+    batch = std::make_unique<batch_t>();
+    unsigned int count = (std::min)(static_cast<unsigned int>(pending.size()), MaxBatchCells);
+    batch->keys.assign(pending.begin(), pending.begin() + count);
+    pending.erase(pending.begin(), pending.begin() + count);
+    batch->start(
+        job_system, upload_batch,
+        [this](const Cell_residency::cell_t &key) { return prepare(key); },
+        [this](prepared_t &prepared) { return create(prepared); });
+}
+
+bool Cell_streamer::apply_transitions(std::chrono::high_resolution_clock::time_point start_point,
+                                      Collision_world &collision_world,
+                                      Retired_resources &retired_resources,
+                                      ComPtr<ID3D12CommandQueue> &command_queue) {
+    // at least one a frame, or a slow cell would never get in
+    unsigned int applied = 0;
+    for (; !transitions.empty(); transitions.pop_front(), applied++) {
+        if (!deterministic && applied > 0
+            && get_microseconds(start_point) >= TransitionBudgetMicroseconds) {
+            break;
+        }
+        transition_t &transition = transitions.front();
+        std::uint64_t id = Cell_residency::get_id(transition.key);
+        if (!transition.cell) {
+            take_out(id, collision_world, retired_resources, command_queue);
+            continue;
+        }
+        // the cells that make room for it, or the cell itself when it is the farthest
+        std::vector<Cell_residency::cell_t> unloads;
+        residency.finish_load(transition.key, transition.cell->size, unloads);
+        bool refused = false;
+        for (const Cell_residency::cell_t &key : unloads) {
+            if (key == transition.key) {
+                refused = true;
+            } else {
+                take_out(Cell_residency::get_id(key), collision_world, retired_resources,
+                         command_queue);
+            }
+        }
+        if (refused) {
+            retired_resources.retire(command_queue, std::move(transition.cell));
+        } else {
+            collision_world.add_walls(transition.cell->walls, transition.cell->wall_ids);
+            cells[id] = std::move(transition.cell);
+        }
+    }
+    if (applied > 0) {
+        collision_world.build();
+    }
+    return !transitions.empty();
+}
+
+void Cell_streamer::take_out(std::uint64_t id, Collision_world &collision_world,
+                             Retired_resources &retired_resources,
+                             ComPtr<ID3D12CommandQueue> &command_queue) {
+    auto cell = cells.find(id);
+    collision_world.remove_walls(cell->second->wall_ids);
+    retired_resources.retire(command_queue, std::move(cell->second));
+    cells.erase(cell);
+}
+
+void Cell_streamer::drop_cells(Job_system &job_system, Collision_world &collision_world,
+                               Retired_resources &retired_resources,
+                               ComPtr<ID3D12CommandQueue> &command_queue) {
+    // the batch's cells were made from the old meshes
+    if (batch) {
+        batch_t::wait(job_system, batch);
+        batch.reset();
+    }
+    for (auto &[id, cell] : cells) {
+        collision_world.remove_walls(cell->wall_ids);
+        retired_resources.retire(command_queue, std::move(cell));
+    }
+    cells.clear();
+    collision_world.build();
+    // the cells waiting to be taken in were never drawn
+    transitions.clear();
+    pending.clear();
+    residency.init(world_cells::cell_size, LoadRadius, UnloadRadius, Budget, MaxLoadsInFlight);
+}
+
+void Cell_streamer::init(ComPtr<ID3D12Device> &device,
+                         const std::vector<Asset_cache<Mesh>::handle_t> &_meshes,
+                         const D3D12_GPU_DESCRIPTOR_HANDLE &_texture_handle,
+                         unsigned int _mat_id, float _wall_low_y, float _wall_high_y,
+                         const std::vector<scatter::circle_t> &_exclusions) {
+    m_device = device;
+    meshes = _meshes;
+    texture_handle = _texture_handle;
+    mat_id = _mat_id;
+    wall_low_y = _wall_low_y;
+    wall_high_y = _wall_high_y;
+    exclusions = _exclusions;
+    if (meshes.size() != world_cells::kind_count) {
+        throw std::runtime_error("the cells need a mesh for every kind of prop");
+    }
+    if (mat_id >= WORLD_MATRIX_COUNT) {
+        throw std::runtime_error("the cells' group has no world matrix");
+    }
+    upload_batch.init(m_device);
+    create_kind_vertices();
+    residency.init(world_cells::cell_size, LoadRadius, UnloadRadius, Budget, MaxLoadsInFlight);
+}
+
+void Cell_streamer::set_meshes(Job_system &job_system,
+                               const std::vector<Asset_cache<Mesh>::handle_t> &_meshes,
+                               Collision_world &collision_world,
+                               Retired_resources &retired_resources,
+                               ComPtr<ID3D12CommandQueue> &command_queue) {
+    if (_meshes == meshes) {
+        return;
+    }
+    drop_cells(job_system, collision_world, retired_resources, command_queue);
+    for (std::shared_ptr<Vertex_buffer> &vertex_buffer : kind_vertices) {
+        retired_resources.retire(command_queue, std::move(vertex_buffer));
+    }
+    meshes = _meshes;
+    create_kind_vertices();
+}
+
+void Cell_streamer::set_deterministic(bool _deterministic) {
+    deterministic = _deterministic;
+}
+
+void Cell_streamer::update(Job_system &job_system, float x, float z,
+                           const math::float3 &_camera, const math::matrix &view_proj,
+                           float _pixels_per_unit, Collision_world &collision_world,
+                           Retired_resources &retired_resources,
+                           ComPtr<ID3D12CommandQueue> &command_queue) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    frustum = Aabb_tree::get_frustum(view_proj);
+    camera = _camera;
+    pixels_per_unit = _pixels_per_unit;
+    if (batch && (deterministic || batch->done())) {
+        batch_t::wait(job_system, batch);
+        for (unsigned int i = 0; i < batch->keys.size(); i++) {
+            transitions.push_back({batch->keys[i], std::move(batch->items[i])});
+        }
+        batch.reset();
+    }
+
+    Cell_residency::changes_t changes = residency.update(x, z);
+    for (const Cell_residency::cell_t &key : changes.unloads) {
+        transitions.push_back({key, nullptr});
+    }
+    pending.insert(pending.end(), changes.loads.begin(), changes.loads.end());
+    if (!batch && !pending.empty()) {
+        start_batch(job_system);
+    }
+
+    if (apply_transitions(start_point, collision_world, retired_resources, command_queue)) {
+        statistics.capped_frames++;
+    }
+    statistics.max_transition_microseconds =
+        (std::max)(statistics.max_transition_microseconds, get_microseconds(start_point));
+}
+
+void Cell_streamer::add_walls(Collision_world &collision_world) {
+    for (auto &[id, cell] : cells) {
+        cell->wall_ids.clear();
+        collision_world.add_walls(cell->walls, cell->wall_ids);
+    }
+}
+
+const Mesh::lod_t &Cell_streamer::select_lod(const cell_t &cell, unsigned int kind) {
+    float distance = (std::max)(Aabb_tree::get_distance(cell.box, camera), NearDistance);
+    float scaled_pixels = cell.max_scales[kind] * pixels_per_unit / distance;
+    const std::vector<Mesh::lod_t> &lods = meshes[kind]->get_lods();
+    unsigned int lod = 0;
+    for (unsigned int i = 1; i < lods.size(); i++) {
+        if (lods[i].error * scaled_pixels <= MaxLodErrorPixels) {
+            lod = i;
+        }
+    }
+    return lods[lod];
+}
+
+Render_queue::draw_t Cell_streamer::get_draw(const cell_t &cell, unsigned int kind,
+                                             ID3D12PipelineState *pipeline_state) {
+    const Mesh &mesh = *meshes[kind];
+    const Mesh::lod_t &lod = select_lod(cell, kind);
+    Render_queue::draw_t draw = {
+        .pipeline_state = pipeline_state,
+        .texture = texture_handle,
+        .vertex_buffer = &kind_vertices[kind]->get_view(),
+        .index_buffer = &mesh.get_index_buffer_view(),
+        .root_constants = nullptr,
+        .root_constant_count = 0,
+        .index_count = lod.index_count,
+        .first_index = lod.first_index,
+        .instance_buffer = &cell.instance_views[kind],
+        .instance_count = static_cast<UINT>(cell.placements.transforms[kind].size())};
+#ifdef PACKED_VERTICES
+    draw.root_constants = &mesh.get_bounds();
+    draw.root_constant_count = sizeof(mesh_bounds_t) / 4;
+#endif
+    return draw;
+}
+
+void Cell_streamer::submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                           const math::matrix &view, Occlusion_buffer &occlusion_buffer) {
+    statistics.drawn = 0;
+    statistics.drawn_props = 0;
+    for (auto &[id, cell] : cells) {
+        if (!Aabb_tree::intersects(frustum, cell->box)
+            || !occlusion_buffer.is_visible(cell->box)) {
+            continue;
+        }
+        float depth = Aabb_tree::get_near_depth(cell->box, view);
+        for (unsigned int kind = 0; kind < world_cells::kind_count; kind++) {
+            if (cell->placements.transforms[kind].empty()) {
+                continue;
+            }
+            if (statistics.drawn == MaxDraws) {
+                return;
+            }
+            Render_queue::draw_t draw = get_draw(*cell, kind, pipeline_state);
+            render_queue.submit(draw, depth);
+            statistics.drawn++;
+            statistics.drawn_props += draw.instance_count;
+        }
+    }
+}
+
+void Cell_streamer::submit_casters(Render_queue &render_queue,
+                                   ID3D12PipelineState *pipeline_state,
+                                   const Aabb_tree::frustum_t &casters) {
+    unsigned int submitted = 0;
+    for (const auto &[id, cell] : cells) {
+        if (!Aabb_tree::intersects(casters, cell->box)) {
+            continue;
+        }
+        for (unsigned int kind = 0; kind < world_cells::kind_count; kind++) {
+            if (cell->placements.transforms[kind].empty()) {
+                continue;
+            }
+            if (submitted == MaxDraws) {
+                return;
+            }
+            render_queue.submit(get_draw(*cell, kind, pipeline_state), 0);
+            submitted++;
+        }
+    }
+}
+
+void Cell_streamer::get_placements(unsigned int kind,
+                                   std::vector<math::affine> &transforms) const {
+    for (const auto &[id, cell] : cells) {
+        const std::vector<math::affine> &placed = cell->placements.transforms[kind];
+        transforms.insert(transforms.end(), placed.begin(), placed.end());
+    }
+}
+
+bool Cell_streamer::get_closest_prop(unsigned int kind, float x, float z, float &distance,
+                                     float &scale) {
+    bool found = false;
+    for (const auto &[id, cell] : cells) {
+        for (const math::affine &transform : cell->placements.transforms[kind]) {
+            math::float3 position = world_cells::get_position(transform);
+            float dx = position.x - x, dz = position.z - z;
+            float prop_distance = std::sqrt(dx * dx + dz * dz);
+            if (!found || prop_distance < distance) {
+                distance = prop_distance;
+                scale = world_cells::get_scale(transform);
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+Cell_streamer::statistics_t Cell_streamer::get_statistics() {
+    statistics.residency = residency.get_statistics();
+    statistics.props = 0;
+    for (const auto &[id, cell] : cells) {
+        statistics.props += static_cast<unsigned int>(world_cells::get_count(cell->placements));
+    }
+    statistics_t result = statistics;
+    statistics.max_transition_microseconds = 0;
+    statistics.capped_frames = 0;
+    return result;
+}
+
+void Cell_streamer::release(Job_system &job_system) {
+    if (!batch) {
+        return;
+    }
+    try {
+        batch_t::wait(job_system, batch);
+    } catch (const std::exception &) {
+        // nothing is taken in anymore
+    }
+    batch.reset();
+}
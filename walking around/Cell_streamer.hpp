@@ -0,0 +1,218 @@
+#pragma once
+#include "Windows_includes.hpp"
+#include "Asset_cache.hpp"
+#include "Cell_residency.hpp"
+#include "Collision_world.hpp"
+#include "Job_system.hpp"
+#include "Mesh.hpp"
+#include "Occlusion_buffer.hpp"
+#include "Render_queue.hpp"
+#include "Retired_resources.hpp"
+#include "Streaming_batch.hpp"
+#include "Upload_batch.hpp"
+#include "Vertex.hpp"
+#include "Vertex_buffer.hpp"
+#include "World_cells.hpp"
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// the world's cells around the player on the GPU: Cell_residency picks the cells, a batch of
+// them is made on the job system, every cell's props placed with the walls they add to the
+// collision world cut out beside them, and their transforms uploaded by the batch's last job,
+// every kind is drawn as instances of its mesh's vertices, copied once under the cells' group,
+// at the lod the kind's largest prop needs at the cell's closest point
+//
+// what the frame does to take cells in and drop them is timed, it stops once the frame's budget
+// is used and leaves the rest for the next frames, so crossing into new cells doesn't make a
+// long frame
+//
+// a replay can't have the walls the player collides with come in when the clock says, so there
+// every batch is waited for the frame after it started and taken in whole, the walls then
+// change on the same steps every run
+class Cell_streamer {
+    public:
+        // every cell within the unload radius, with room to spare
+        constexpr static unsigned int MaxCells = 128;
+        // a draw for every kind of a cell
+        constexpr static unsigned int MaxDraws = MaxCells * world_cells::kind_count;
+
+        struct statistics_t {
+            public:
+                Cell_residency::statistics_t residency;
+                unsigned int drawn = 0;
+                unsigned int drawn_props = 0;
+                // in the resident cells
+                unsigned int props = 0;
+                // the longest a frame took taking cells in and dropping them, and how many
+                // frames stopped at the budget, since the last get_statistics()
+                double max_transition_microseconds = 0;
+                unsigned int capped_frames = 0;
+        };
+
+    private:
+        constexpr static float LoadRadius = 80;
+        constexpr static float UnloadRadius = 112;
+        constexpr static UINT64 Budget = 48 << 20;
+        constexpr static unsigned int MaxBatchCells = 4;
+        // one batch being made and the next one waiting
+        constexpr static unsigned int MaxLoadsInFlight = 2 * MaxBatchCells;
+        constexpr static double TransitionBudgetMicroseconds = 500;
+        // like Object's
+        constexpr static float MaxLodErrorPixels = 1;
+        constexpr static float NearDistance = 0.1f;
+
+        struct cell_t {
+            public:
+                // every kind's transforms one after the other, empty cells have none
+                Vertex_buffer instance_buffer;
+                D3D12_VERTEX_BUFFER_VIEW instance_views[world_cells::kind_count] = {};
+                Aabb_tree::box_t box;
+                world_cells::placements_t placements;
+                // the largest scale of every kind, what its lod is picked for
+                float max_scales[world_cells::kind_count] = {};
+                std::vector<Collision_world::segment_t> walls;
+                // the walls' ids in the collision world while the cell is taken in
+                std::vector<unsigned int> wall_ids;
+                std::uint64_t size = 0;
+        };
+
+        // a cell's props placed on a worker, waiting for the upload
+        struct prepared_t {
+            public:
+                Aabb_tree::box_t box;
+                world_cells::placements_t placements;
+                float max_scales[world_cells::kind_count] = {};
+                std::vector<Collision_world::segment_t> walls;
+        };
+
+        using batch_t =
+            Streaming_batch<Cell_residency::cell_t, prepared_t, std::shared_ptr<cell_t>>;
+
+        // a cell to take in, or to drop when it has no contents, in the order residency
+        // decided them
+        struct transition_t {
+            public:
+                Cell_residency::cell_t key;
+                std::shared_ptr<cell_t> cell;
+        };
+
+        ComPtr<ID3D12Device> m_device;
+        // only used by one batch at a time
+        Upload_batch upload_batch;
+        D3D12_GPU_DESCRIPTOR_HANDLE texture_handle = {};
+        // by world_cells' kinds, read by the batch's jobs
+        std::vector<Asset_cache<Mesh>::handle_t> meshes;
+        // the meshes' vertices with the cells' group, by kind
+        std::vector<std::shared_ptr<Vertex_buffer>> kind_vertices;
+        unsigned int mat_id = 0;
+        // the circles around the hand placed scene the props keep off, read by the jobs
+        std::vector<scatter::circle_t> exclusions;
+        // the collision world's band, the props' walls are cut at their height above their
+        // ground
+        float wall_low_y = 0, wall_high_y = 0;
+
+        Cell_residency residency;
+        std::unordered_map<std::uint64_t, std::shared_ptr<cell_t>> cells;
+        // loads residency asked for that wait for a batch
+        std::deque<Cell_residency::cell_t> pending;
+        std::unique_ptr<batch_t> batch;
+        std::deque<transition_t> transitions;
+        // from the last update()
+        Aabb_tree::frustum_t frustum = {};
+        math::float3 camera = {};
+        float pixels_per_unit = 1;
+        bool deterministic = false;
+
+        statistics_t statistics;
+
+        // any thread
+        prepared_t prepare(const Cell_residency::cell_t &key);
+
+        // on the batch's upload job
+        std::shared_ptr<cell_t> create(prepared_t &prepared);
+
+        // copies the meshes' vertices and uploads them
+        void create_kind_vertices();
+
+        void start_batch(Job_system &job_system);
+
+        // takes in and drops cells until the frame's budget from start_point is used, or all
+        // of them when deterministic, true when some are left
+        bool apply_transitions(std::chrono::high_resolution_clock::time_point start_point,
+                               Collision_world &collision_world,
+                               Retired_resources &retired_resources,
+                               ComPtr<ID3D12CommandQueue> &command_queue);
+
+        // drops a taken in cell's walls and retires its buffers
+        void take_out(std::uint64_t id, Collision_world &collision_world,
+                      Retired_resources &retired_resources,
+                      ComPtr<ID3D12CommandQueue> &command_queue);
+
+        void drop_cells(Job_system &job_system, Collision_world &collision_world,
+                        Retired_resources &retired_resources,
+                        ComPtr<ID3D12CommandQueue> &command_queue);
+
+        // the coarsest of the kind's lods that stays within MaxLodErrorPixels
+        const Mesh::lod_t &select_lod(const cell_t &cell, unsigned int kind);
+
+        // the cell's props of kind, which it must have
+        Render_queue::draw_t get_draw(const cell_t &cell, unsigned int kind,
+                                      ID3D12PipelineState *pipeline_state);
+
+    public:
+        // _meshes are by world_cells' kinds, their vertices placed on the scene texture,
+        // the walls are cut for the collision world's band
+        void init(ComPtr<ID3D12Device> &device,
+                  const std::vector<Asset_cache<Mesh>::handle_t> &_meshes,
+                  const D3D12_GPU_DESCRIPTOR_HANDLE &_texture_handle, unsigned int _mat_id,
+                  float _wall_low_y, float _wall_high_y,
+                  const std::vector<scatter::circle_t> &_exclusions);
+
+        // the cells' walls and boxes are cut from the meshes, new meshes drop them all to be made
+        // again
+        void set_meshes(Job_system &job_system,
+                        const std::vector<Asset_cache<Mesh>::handle_t> &_meshes,
+                        Collision_world &collision_world, Retired_resources &retired_resources,
+                        ComPtr<ID3D12CommandQueue> &command_queue);
+
+        // the cells come in on the frames they would in any other run, not when their batch is
+        // done, and regardless of the frame's budget
+        void set_deterministic(bool _deterministic);
+
+        // loads and unloads around x, z, takes finished batches in and starts the next,
+        // view_proj is untransposed, the lods are picked for _camera and _pixels_per_unit, the
+        // size in pixels of one unit at distance 1, once a frame before submit()
+        void update(Job_system &job_system, float x, float z, const math::float3 &_camera,
+                    const math::matrix &view_proj, float _pixels_per_unit,
+                    Collision_world &collision_world, Retired_resources &retired_resources,
+                    ComPtr<ID3D12CommandQueue> &command_queue);
+
+        // the taken in cells' walls again, after the collision world was built anew
+        void add_walls(Collision_world &collision_world);
+
+        // the cells in update()'s view that occlusion_buffer doesn't hide, view is
+        // untransposed
+        void submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                    const math::matrix &view, Occlusion_buffer &occlusion_buffer);
+
+        // the cells inside casters, a shadow cascade's frustum, unsorted, hidden or not
+        void submit_casters(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                            const Aabb_tree::frustum_t &casters);
+
+        // every taken in prop of kind, appended to transforms
+        void get_placements(unsigned int kind, std::vector<math::affine> &transforms) const;
+
+        // how far the closest taken in prop of kind is from x, z and its scale, false when
+        // there is none
+        bool get_closest_prop(unsigned int kind, float x, float z, float &distance,
+                              float &scale);
+
+        statistics_t get_statistics();
+
+        // waits for the batch, before job_system is released
+        void release(Job_system &job_system);
+};
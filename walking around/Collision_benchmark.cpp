@@ -0,0 +1,125 @@
+#include "Collision_benchmark.hpp"
+#include "Collision_world.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int steps = 60;
+constexpr float step_time = 1.0f / steps;
+constexpr float agent_radius = 0.4f;
+// a house in the middle of every block, the streets between them are at least street_width
+constexpr float block_size = 10;
+constexpr float street_width = 1.5f;
+constexpr unsigned int agents_per_block = 4;
+constexpr float step_height = 0.3f, head_height = 2;
+
+struct house_t {
+    public:
+        float x, z, half_size, sin, cos;
+};
+
+// the house's walls, roof and floor, turned about its center
+void add_house(const house_t &house, float height, std::vector<math::float3> &positions,
+               std::vector<unsigned int> &indices) {
+    unsigned int first = static_cast<unsigned int>(positions.size());
+    for (unsigned int corner = 0; corner < 8; corner++) {
+        float local_x = corner & 1 ? house.half_size : -house.half_size;
+        float local_z = corner & 2 ? house.half_size : -house.half_size;
+        positions.push_back({house.x + local_x * house.cos - local_z * house.sin,
+                             corner & 4 ? height : 0,
+                             house.z + local_x * house.sin + local_z * house.cos});
+    }
+    const unsigned int faces[6][4] = {{0, 1, 3, 2}, {4, 6, 7, 5}, {0, 4, 5, 1},
+                                      {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 5, 7, 3}};
+    for (const unsigned int(&face)[4] : faces) {
+        for (unsigned int corner : {face[0], face[1], face[2], face[0], face[2], face[3]}) {
+            indices.push_back(first + corner);
+        }
+    }
+}
+
+bool inside(const house_t &house, float x, float z) {
+    float dx = x - house.x, dz = z - house.z;
+    float local_x = dx * house.cos + dz * house.sin, local_z = dz * house.cos - dx * house.sin;
+    return std::abs(local_x) < house.half_size && std::abs(local_z) < house.half_size;
+}
+} // namespace
+
+std::string benchmark_collision(unsigned int agent_count) {
+    unsigned int blocks_per_side = static_cast<unsigned int>(
+        std::ceil(std::sqrt(static_cast<float>(agent_count) / agents_per_block)));
+    std::mt19937 generator(1);
+    // the largest house still leaves the street when turned by 45 degrees
+    float largest_half_size = (block_size / 2 - street_width) / std::sqrt(2.0f);
+    std::uniform_real_distribution<float> half_size(1, largest_half_size), height(1, 6),
+        angle(0, 2 * math::pi), unit(0, 1), speed(2, 5);
+
+    std::vector<house_t> houses;
+    std::vector<math::float3> positions;
+    std::vector<unsigned int> indices;
+    for (unsigned int i = 0; i < blocks_per_side * blocks_per_side; i++) {
+        float turn = angle(generator);
+        house_t house = {(i % blocks_per_side + 0.5f) * block_size,
+                         (i / blocks_per_side + 0.5f) * block_size, half_size(generator),
+                         std::sin(turn), std::cos(turn)};
+        houses.push_back(house);
+        add_house(house, height(generator), positions, indices);
+    }
+
+    Collision_world world;
+    auto start_point = std::chrono::high_resolution_clock::now();
+    world.init(step_height, head_height);
+    world.add_triangles(positions.data(), indices.data(), indices.size());
+    world.build();
+    auto end_point = std::chrono::high_resolution_clock::now();
+    std::stringstream s;
+    s << "collision: " << houses.size() << " houses, " << indices.size() / 3 << " triangles, "
+      << world.get_segment_count() << " wall segments built in "
+      << std::chrono::duration_cast<std::chrono::microseconds>(end_point - start_point).count()
+      << " us\n";
+
+    // every agent starts in the middle of a street and walks one way
+    float town_size = blocks_per_side * block_size;
+    std::vector<float> x(agent_count), z(agent_count), velocity_x(agent_count),
+        velocity_z(agent_count);
+    for (unsigned int i = 0; i < agent_count; i++) {
+        float street = std::floor(unit(generator) * blocks_per_side) * block_size;
+        float along = unit(generator) * town_size;
+        x[i] = i % 2 ? street : along;
+        z[i] = i % 2 ? along : street;
+        float direction = angle(generator), agent_speed = speed(generator);
+        velocity_x[i] = std::cos(direction) * agent_speed;
+        velocity_z[i] = std::sin(direction) * agent_speed;
+    }
+
+    std::vector<unsigned int> nearby;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int step = 0; step < steps; step++) {
+        for (unsigned int i = 0; i < agent_count; i++) {
+            world.move_circle(x[i], z[i], agent_radius, velocity_x[i] * step_time,
+                              velocity_z[i] * step_time, nearby);
+        }
+    }
+    end_point = std::chrono::high_resolution_clock::now();
+    double microseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+        / 1000.0;
+
+    unsigned int in_walls = 0, in_houses = 0;
+    for (unsigned int i = 0; i < agent_count; i++) {
+        in_walls += world.overlaps(x[i], z[i], agent_radius, nearby);
+        unsigned int block_x = static_cast<unsigned int>((std::max)(x[i] / block_size, 0.0f));
+        unsigned int block_z = static_cast<unsigned int>((std::max)(z[i] / block_size, 0.0f));
+        if (block_x < blocks_per_side && block_z < blocks_per_side) {
+            in_houses += inside(houses[block_z * blocks_per_side + block_x], x[i], z[i]);
+        }
+    }
+    s << "collision: " << agent_count << " agents, " << steps << " steps, "
+      << microseconds / (static_cast<double>(agent_count) * steps) << " us per agent step, "
+      << in_walls << " ended in a wall, " << in_houses << " inside a house\n";
+    return s.str();
+}
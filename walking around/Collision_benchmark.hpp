@@ -0,0 +1,6 @@
+#pragma once
+#include <string>
+
+// agent_count agents walking the streets of a town of box houses for a second, with the time
+// every agent's step takes and how many ended up in a wall or a house, one line each
+std::string benchmark_collision(unsigned int agent_count);
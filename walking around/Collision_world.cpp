@@ -0,0 +1,239 @@
+#include "Collision_world.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// the closest point of the segment to x, z
+void closest_point(const Collision_world::segment_t &segment, float x, float z, float &closest_x,
+                   float &closest_z) {
+    float ex = segment.x1 - segment.x0, ez = segment.z1 - segment.z0;
+    float length_squared = ex * ex + ez * ez;
+    float u = length_squared > 0
+                  ? (std::clamp)(((x - segment.x0) * ex + (z - segment.z0) * ez) / length_squared,
+                                 0.0f, 1.0f)
+                  : 0;
+    closest_x = segment.x0 + ex * u;
+    closest_z = segment.z0 + ez * u;
+}
+
+// when the circle moving from x, z by dx, dz first touches the point cx, cz, as a part of the
+// move, false when it doesn't before earliest
+bool sweep_point(float x, float z, float dx, float dz, float radius, float cx, float cz,
+                 float earliest, float &t) {
+    float mx = x - cx, mz = z - cz;
+    float b = mx * dx + mz * dz;
+    float c = mx * mx + mz * mz - radius * radius;
+    if (b >= 0) {
+        return false; // moving away
+    }
+    float a = dx * dx + dz * dz;
+    float discriminant = b * b - a * c;
+    if (discriminant < 0) {
+        return false;
+    }
+    t = (std::max)((-b - std::sqrt(discriminant)) / a, 0.0f);
+    return t < earliest;
+}
+
+} // namespace
+
+unsigned int Collision_world::add_segment(const segment_t &segment) {
+    unsigned int id = tree.insert({{(std::min)(segment.x0, segment.x1), 0,
+                                    (std::min)(segment.z0, segment.z1)},
+                                   {(std::max)(segment.x0, segment.x1), 0,
+                                    (std::max)(segment.z0, segment.z1)}});
+    if (id == segments.size()) {
+        segments.push_back(segment);
+    } else {
+        segments[id] = segment;
+    }
+    segment_count++;
+    return id;
+}
+
+void Collision_world::find_nearby(float x, float z, float reach,
+                                  std::vector<unsigned int> &nearby) const {
+    nearby.clear();
+    tree.query_box({{x - reach, 0, z - reach}, {x + reach, 0, z + reach}}, nearby);
+}
+
+void Collision_world::init(float _min_y, float _max_y) {
+    min_y = _min_y;
+    max_y = _max_y;
+    segments.clear();
+    segment_count = 0;
+    tree.init(0);
+}
+
+void Collision_world::add_triangles(const math::float3 *positions, const unsigned int *indices,
+                                    std::size_t index_count) {
+    std::vector<segment_t> walls;
+    cut_walls(min_y, max_y, positions, indices, index_count, walls);
+    for (const segment_t &wall : walls) {
+        add_segment(wall);
+    }
+}
+
+void Collision_world::cut_walls(float low_y, float high_y, const math::float3 *positions,
+                                const unsigned int *indices, std::size_t index_count,
+                                std::vector<segment_t> &walls) {
+    for (std::size_t i = 0; i + 2 < index_count; i += 3) {
+        // the triangle cut to the band, one plane at a time, three corners become at most five
+        math::float3 polygon[5], clipped[5];
+        unsigned int corner_count = 3, clipped_count;
+        for (unsigned int j = 0; j < 3; j++) {
+            polygon[j] = positions[indices[i + j]];
+        }
+        for (unsigned int plane = 0; plane < 2 && corner_count > 0; plane++) {
+            // inside is y >= low_y for the first plane, y <= high_y for the second
+            float sign = plane == 0 ? 1.0f : -1.0f, offset = plane == 0 ? low_y : high_y;
+            clipped_count = 0;
+            for (unsigned int j = 0; j < corner_count; j++) {
+                const math::float3 &from = polygon[j], &to = polygon[(j + 1) % corner_count];
+                float from_distance = sign * (from.y - offset);
+                float to_distance = sign * (to.y - offset);
+                if (from_distance >= 0) {
+                    clipped[clipped_count++] = from;
+                }
+                if ((from_distance >= 0) != (to_distance >= 0)) {
+                    float u = from_distance / (from_distance - to_distance);
+                    clipped[clipped_count++] = {from.x + (to.x - from.x) * u, offset,
+                                                from.z + (to.z - from.z) * u};
+                }
+            }
+            std::copy(clipped, clipped + clipped_count, polygon);
+            corner_count = clipped_count;
+        }
+
+        // a wall's outline is flat, both of its sides become the same segments
+        for (unsigned int j = 0; j < corner_count; j++) {
+            const math::float3 &from = polygon[j], &to = polygon[(j + 1) % corner_count];
+            if (from.x != to.x || from.z != to.z) {
+                walls.push_back({from.x, from.z, to.x, to.z});
+            }
+        }
+        if (corner_count == 1) {
+            walls.push_back({polygon[0].x, polygon[0].z, polygon[0].x, polygon[0].z});
+        }
+    }
+}
+
+void Collision_world::add_walls(const std::vector<segment_t> &walls,
+                                std::vector<unsigned int> &ids) {
+    for (const segment_t &wall : walls) {
+        ids.push_back(add_segment(wall));
+    }
+}
+
+void Collision_world::remove_walls(const std::vector<unsigned int> &ids) {
+    for (unsigned int id : ids) {
+        tree.remove(id);
+        segment_count--;
+    }
+}
+
+void Collision_world::build() {
+    tree.flatten();
+}
+
+void Collision_world::move_circle(float &x, float &z, float radius, float dx, float dz,
+                                  std::vector<unsigned int> &nearby) const {
+    // sliding keeps the circle within the move's length of where it started
+    find_nearby(x, z, std::sqrt(dx * dx + dz * dz) + radius + skin, nearby);
+
+    for (unsigned int i : nearby) {
+        float closest_x, closest_z;
+        closest_point(segments[i], x, z, closest_x, closest_z);
+        float away_x = x - closest_x, away_z = z - closest_z;
+        float distance_squared = away_x * away_x + away_z * away_z;
+        if (distance_squared >= radius * radius || distance_squared == 0) {
+            continue;
+        }
+        float scale = (radius + skin) / std::sqrt(distance_squared);
+        x = closest_x + away_x * scale;
+        z = closest_z + away_z * scale;
+    }
+
+    for (unsigned int slide = 0; slide < max_slides && (dx != 0 || dz != 0); slide++) {
+        // the earliest touch of any segment, with the direction it pushes back in
+        float earliest = 1, normal_x = 0, normal_z = 0;
+        bool touched = false;
+        for (unsigned int i : nearby) {
+            const segment_t &segment = segments[i];
+            float t;
+            // the segment's sides first, its ends are the two points
+            float ex = segment.x1 - segment.x0, ez = segment.z1 - segment.z0;
+            float length_squared = ex * ex + ez * ez;
+            if (length_squared > 0) {
+                float length = std::sqrt(length_squared);
+                float side_x = -ez / length, side_z = ex / length;
+                float distance = (x - segment.x0) * side_x + (z - segment.z0) * side_z;
+                if (distance < 0) {
+                    side_x = -side_x;
+                    side_z = -side_z;
+                    distance = -distance;
+                }
+                float approach = dx * side_x + dz * side_z;
+                if (approach < 0 && distance >= radius) {
+                    t = (distance - radius) / -approach;
+                    float u = ((x + dx * t - segment.x0) * ex + (z + dz * t - segment.z0) * ez)
+                              / length_squared;
+                    if (t < earliest && u >= 0 && u <= 1) {
+                        earliest = t;
+                        normal_x = side_x;
+                        normal_z = side_z;
+                        touched = true;
+                    }
+                }
+            }
+            const float ends[2][2] = {{segment.x0, segment.z0}, {segment.x1, segment.z1}};
+            for (const float(&end)[2] : ends) {
+                if (sweep_point(x, z, dx, dz, radius, end[0], end[1], earliest, t)) {
+                    float away_x = x + dx * t - end[0], away_z = z + dz * t - end[1];
+                    float distance = std::sqrt(away_x * away_x + away_z * away_z);
+                    if (distance > 0) {
+                        earliest = t;
+                        normal_x = away_x / distance;
+                        normal_z = away_z / distance;
+                        touched = true;
+                    }
+                }
+            }
+        }
+
+        if (!touched) {
+            x += dx;
+            z += dz;
+            return;
+        }
+        // up to the wall, then what is left of the move along it
+        x += dx * earliest + normal_x * skin;
+        z += dz * earliest + normal_z * skin;
+        dx *= 1 - earliest;
+        dz *= 1 - earliest;
+        float into = dx * normal_x + dz * normal_z;
+        dx -= normal_x * into;
+        dz -= normal_z * into;
+    }
+}
+
+bool Collision_world::overlaps(float x, float z, float radius,
+                               std::vector<unsigned int> &nearby) const {
+    find_nearby(x, z, radius, nearby);
+    float inner_radius = radius - skin;
+    for (unsigned int i : nearby) {
+        float closest_x, closest_z;
+        closest_point(segments[i], x, z, closest_x, closest_z);
+        float away_x = x - closest_x, away_z = z - closest_z;
+        if (away_x * away_x + away_z * away_z < inner_radius * inner_radius) {
+            return true;
+        }
+    }
+    return false;
+}
+
+unsigned int Collision_world::get_segment_count() const {
+    return segment_count;
+}
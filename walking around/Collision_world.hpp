@@ -0,0 +1,67 @@
+#pragma once
+#include "Aabb_tree.hpp"
+
+#include <vector>
+
+// the world's triangles as walls on the ground plane: the part of every triangle between min_y
+// and max_y, the height band that someone standing on the ground collides in, is projected to
+// x, z and the outline kept as segments, with the aabb tree over them as the broadphase
+//
+// circles are swept against the segments grown by their radius and slide along the first one
+// they touch, so steps lower than min_y are walked over and what is above max_y walked under
+class Collision_world {
+    public:
+        struct segment_t {
+            public:
+                float x0, z0, x1, z1;
+        };
+
+    private:
+        float min_y = 0, max_y = 0;
+        std::vector<segment_t> segments;
+        // the segments' boxes at y = 0, ids are indices in segments, the removed segments'
+        // indices are given out again
+        Aabb_tree tree;
+        unsigned int segment_count = 0;
+
+        // a move ends at the third wall it slides along
+        constexpr static unsigned int max_slides = 3;
+        // how far a circle stopped by a wall is kept from it, so the next sweep starts outside
+        constexpr static float skin = 1e-3f;
+
+        unsigned int add_segment(const segment_t &segment);
+
+        // the segments whose boxes come within reach of x, z, into nearby
+        void find_nearby(float x, float z, float reach, std::vector<unsigned int> &nearby) const;
+
+    public:
+        void init(float _min_y, float _max_y);
+
+        // world-space triangles, three indices each
+        void add_triangles(const math::float3 *positions, const unsigned int *indices,
+                           std::size_t index_count);
+
+        // the walls add_triangles() adds for the band from low_y to high_y, appended to walls,
+        // so they can be cut on any thread and added later
+        static void cut_walls(float low_y, float high_y, const math::float3 *positions,
+                              const unsigned int *indices, std::size_t index_count,
+                              std::vector<segment_t> &walls);
+
+        // walls from cut_walls(), their ids are appended to ids for remove_walls()
+        void add_walls(const std::vector<segment_t> &walls, std::vector<unsigned int> &ids);
+
+        void remove_walls(const std::vector<unsigned int> &ids);
+
+        // after walls are added or removed, before anything moves
+        void build();
+
+        // moves the circle at x, z by dx, dz, out of any wall it starts in first, nearby is the
+        // broadphase's scratch space, one per thread moving circles
+        void move_circle(float &x, float &z, float radius, float dx, float dz,
+                         std::vector<unsigned int> &nearby) const;
+
+        // whether the circle is into a wall by more than the skin, for checking
+        bool overlaps(float x, float z, float radius, std::vector<unsigned int> &nearby) const;
+
+        unsigned int get_segment_count() const;
+};
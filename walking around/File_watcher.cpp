@@ -0,0 +1,179 @@
+#include "File_watcher.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+void File_watcher::add_change(const std::filesystem::path &filename) {
+    std::lock_guard<std::mutex> lock(mutex);
+    changes[directory / filename] = std::chrono::steady_clock::now();
+}
+
+#ifdef _WIN32
+void File_watcher::watch() {
+    OVERLAPPED overlapped = {};
+    overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    HANDLE events[] = {overlapped.hEvent, stop_event};
+    alignas(DWORD) char buffer[16 * 1024];
+
+    while (overlapped.hEvent) {
+        if (!ReadDirectoryChangesW(directory_handle, buffer, sizeof(buffer), FALSE,
+                                   FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE
+                                       | FILE_NOTIFY_CHANGE_SIZE,
+                                   nullptr, &overlapped, nullptr)) {
+            break;
+        }
+        DWORD bytes = 0;
+        if (WaitForMultipleObjects(_countof(events), events, FALSE, INFINITE) != WAIT_OBJECT_0) {
+            CancelIo(directory_handle);
+            GetOverlappedResult(directory_handle, &overlapped, &bytes, TRUE);
+            break;
+        }
+        if (!GetOverlappedResult(directory_handle, &overlapped, &bytes, FALSE)) {
+            break;
+        }
+
+        // no bytes when the buffer overflowed, those changes are lost
+        for (DWORD offset = 0; bytes > 0;) {
+            const FILE_NOTIFY_INFORMATION *info =
+                reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(buffer + offset);
+            if (info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED
+                || info->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+                add_change(std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR)));
+            }
+            if (info->NextEntryOffset == 0) {
+                break;
+            }
+            offset += info->NextEntryOffset;
+        }
+    }
+    if (overlapped.hEvent) {
+        CloseHandle(overlapped.hEvent);
+    }
+}
+#else
+void File_watcher::watch() {
+    alignas(inotify_event) char buffer[16 * 1024];
+    pollfd descriptors[] = {
+        {.fd = inotify_descriptor, .events = POLLIN, .revents = 0},
+        {.fd = stop_descriptor,    .events = POLLIN, .revents = 0},
+    };
+
+    while (::poll(descriptors, 2, -1) >= 0 && !(descriptors[1].revents & POLLIN)) {
+        if (!(descriptors[0].revents & POLLIN)) {
+            continue;
+        }
+        ssize_t bytes = read(inotify_descriptor, buffer, sizeof(buffer));
+        if (bytes <= 0) {
+            break;
+        }
+        for (ssize_t offset = 0; offset < bytes;) {
+            const inotify_event *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+            if (event->len > 0 && (event->mask & (IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO))) {
+                add_change(event->name);
+            }
+            offset += sizeof(inotify_event) + event->len;
+        }
+    }
+}
+#endif
+
+File_watcher::~File_watcher() {
+    release();
+}
+
+void File_watcher::init(const std::filesystem::path &_directory) {
+    release();
+    directory = _directory;
+
+#ifdef _WIN32
+    directory_handle = CreateFileW(directory.c_str(), FILE_LIST_DIRECTORY,
+                                   FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                   nullptr, OPEN_EXISTING,
+                                   FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (directory_handle == INVALID_HANDLE_VALUE) {
+        directory_handle = nullptr;
+        throw std::runtime_error("can't watch " + directory.string());
+    }
+    stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (!stop_event) {
+        release();
+        throw std::runtime_error("can't create the watcher's stop event");
+    }
+#else
+    inotify_descriptor = inotify_init1(IN_CLOEXEC);
+    stop_descriptor = eventfd(0, EFD_CLOEXEC);
+    if (inotify_descriptor < 0 || stop_descriptor < 0
+        || inotify_add_watch(inotify_descriptor, directory.c_str(),
+                             IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO)
+               < 0) {
+        release();
+        throw std::runtime_error("can't watch " + directory.string());
+    }
+#endif
+
+    thread = std::thread(&File_watcher::watch, this);
+}
+
+std::vector<std::filesystem::path> File_watcher::poll() {
+    std::vector<std::filesystem::path> settled;
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = changes.begin(); it != changes.end();) {
+        if (now - it->second < settle_time) {
+            ++it;
+            continue;
+        }
+        settled.push_back(it->first);
+        it = changes.erase(it);
+    }
+    return settled;
+}
+
+void File_watcher::release() {
+#ifdef _WIN32
+    if (stop_event) {
+        SetEvent(stop_event);
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (stop_event) {
+        CloseHandle(stop_event);
+        stop_event = nullptr;
+    }
+    if (directory_handle) {
+        CloseHandle(directory_handle);
+        directory_handle = nullptr;
+    }
+#else
+    if (stop_descriptor >= 0) {
+        std::uint64_t one = 1;
+        [[maybe_unused]] ssize_t written = write(stop_descriptor, &one, sizeof(one));
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (stop_descriptor >= 0) {
+        close(stop_descriptor);
+        stop_descriptor = -1;
+    }
+    if (inotify_descriptor >= 0) {
+        close(inotify_descriptor);
+        inotify_descriptor = -1;
+    }
+#endif
+    std::lock_guard<std::mutex> lock(mutex);
+    changes.clear();
+}
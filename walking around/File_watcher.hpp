@@ -0,0 +1,48 @@
+#pragma once
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// reports the files of one directory that were written, not those of its subdirectories,
+// on a thread of its own, a file is reported once it has been quiet for settle_time so
+// that files still being saved aren't
+class File_watcher {
+    private:
+        constexpr static std::chrono::milliseconds settle_time{200};
+
+        std::filesystem::path directory;
+        std::thread thread;
+
+        std::mutex mutex;
+        // when each changed file was last written to
+        std::map<std::filesystem::path, std::chrono::steady_clock::time_point> changes;
+
+#ifdef _WIN32
+        void *directory_handle = nullptr;
+        void *stop_event = nullptr;
+#else
+        int inotify_descriptor = -1;
+        int stop_descriptor = -1;
+#endif
+
+        void add_change(const std::filesystem::path &filename);
+
+        // waits for changes until release()
+        void watch();
+
+    public:
+        File_watcher() = default;
+        File_watcher(const File_watcher &) = delete;
+        File_watcher &operator=(const File_watcher &) = delete;
+        ~File_watcher();
+
+        void init(const std::filesystem::path &_directory);
+
+        // the settled changes since the last call, as directory / filename
+        std::vector<std::filesystem::path> poll();
+
+        void release();
+};
@@ -1,43 +1,229 @@
 #include "Game.hpp"
 #include "Utility.hpp"
 
+#include <shellapi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+Game::scene_texture_t Game::load_scene_texture(Upload_batch &batch,
+                                               const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle) {
+    static_assert(_countof(TextureFilenames) == texture_ids::texture_count);
+
+    // files with the same contents decode to the same image, which is packed once
+    scene_texture_t scene;
+    std::vector<texture_packer::image_t> images;
+    std::vector<unsigned int> image_indices;
+    for (PCWSTR filename : TextureFilenames) {
+        scene.images.push_back(image_cache.get(
+            filename, 0, [this](texture_packer::image_t &image, const std::vector<char> &contents) {
+                image = texture_loader.decode_image(contents);
+            }));
+        auto first = std::find(scene.images.begin(), scene.images.end(), scene.images.back());
+        if (first + 1 == scene.images.end()) {
+            image_indices.push_back(static_cast<unsigned int>(images.size()));
+            images.push_back(*scene.images.back());
+        } else {
+            image_indices.push_back(image_indices[first - scene.images.begin()]);
+        }
+    }
+
+    auto start_point = std::chrono::high_resolution_clock::now();
+    texture_packer::packed_t packed = texture_packer::pack(images, AtlasPadding, MaxAtlasSize);
+    auto end_point = std::chrono::high_resolution_clock::now();
+
+    for (unsigned int image_index : image_indices) {
+        scene.placements.push_back(packed.placements[image_index]);
+    }
+    scene.size = {packed.width, packed.height};
+
+    scene.streaming =
+        packed.slice_count <= MIN_LOD_SLICES && Texture_streamer::is_supported(m_device);
+    if (scene.streaming) {
+        scene.streamer = std::make_unique<Texture_streamer>();
+        scene.streamer->init(m_device, m_commandQueue, packed.width, packed.height,
+                             packed.slice_count, std::move(packed.pixels), TextureBudget,
+                             cpu_handle);
+    } else {
+        scene.texture.init_array(m_device, batch, packed.width, packed.height,
+                                 packed.slice_count, packed.pixels.data(), cpu_handle,
+                                 const_heaps.get_gpu_handle(heap_ids::scene_tex));
+    }
+
+    std::stringstream s;
+    s << "scene texture: "
+      << (packed.layout == texture_packer::layout_t::texture_array ? "array" : "atlas") << " "
+      << packed.width << "x" << packed.height << "x" << packed.slice_count << ", packed in "
+      << std::chrono::duration_cast<std::chrono::microseconds>(end_point - start_point).count()
+      << " us, " << (scene.streaming ? "streamed" : "not streamed") << "\n";
+    OutputDebugStringA(s.str().c_str());
+    return scene;
+}
+
 void Game::init_environment_objects() {
 
     environment_objects.emplace_back();
-    environment_objects.back().init(
-        m_device, texture_loader, LR"(resources/house.png)", LR"(resources/house.wobj)",
-        const_heaps.get_cpu_handle(heap_ids::house_tex),
-        const_heaps.get_gpu_handle(heap_ids::house_tex), object_id_giver);
+    environment_objects.back().init(m_device, upload_batch, mesh_cache,
+                                    LR"(resources/house.wobj)",
+                                    const_heaps.get_gpu_handle(heap_ids::scene_tex),
+                                    scene_texture.placements[texture_ids::house_texture],
+                                    object_id_giver);
+    environment_textures.push_back(texture_ids::house_texture);
+    environment_filenames.push_back(LR"(resources/house.wobj)");
 
     obj_id_to_transform[object_id_giver.get_id("house.off")] =
-        DirectX::XMMatrixTranspose(DirectX::XMMatrixTranslation(1.0f, 0.0f, 5.0f));
+        math::affine_translation(1.0f, 0.0f, 5.0f);
 
     environment_objects.emplace_back();
-    environment_objects.back().init(
-        m_device, texture_loader, LR"(resources/stone.png)", LR"(resources/stone.wobj)",
-        const_heaps.get_cpu_handle(heap_ids::stone_tex),
-        const_heaps.get_gpu_handle(heap_ids::stone_tex), object_id_giver);
+    environment_objects.back().init(m_device, upload_batch, mesh_cache,
+                                    LR"(resources/stone.wobj)",
+                                    const_heaps.get_gpu_handle(heap_ids::scene_tex),
+                                    scene_texture.placements[texture_ids::stone_texture],
+                                    object_id_giver);
+    environment_textures.push_back(texture_ids::stone_texture);
+    environment_filenames.push_back(LR"(resources/stone.wobj)");
 
     obj_id_to_transform[object_id_giver.get_id("stone.off")] =
-        DirectX::XMMatrixTranspose(DirectX::XMMatrixTranslation(-2.0f, 0.0f, -3.0f));
-
-    environment_objects.emplace_back();
-    environment_objects.back().init(
-        m_device, texture_loader, LR"(resources/ground.png)", LR"(resources/ground.wobj)",
-        const_heaps.get_cpu_handle(heap_ids::ground_tex),
-        const_heaps.get_gpu_handle(heap_ids::ground_tex), object_id_giver);
+        math::affine_translation(-2.0f, 0.0f, -3.0f);
 
-    obj_id_to_transform[object_id_giver.get_id("ground.off")] =
-        DirectX::XMMatrixTranspose(DirectX::XMMatrixIdentity());
+    // the terrain and the cells are made in world space
+    obj_id_to_transform[object_id_giver.get_id("terrain.off")] = math::affine_identity();
+    obj_id_to_transform[object_id_giver.get_id("cells.off")] = math::affine_identity();
 
     environment_objects.emplace_back();
-    environment_objects.back().init(
-        m_device, texture_loader, LR"(resources/tree.png)", LR"(resources/tree.wobj)",
-        const_heaps.get_cpu_handle(heap_ids::tree_tex),
-        const_heaps.get_gpu_handle(heap_ids::tree_tex), object_id_giver);
+    environment_objects.back().init(m_device, upload_batch, mesh_cache,
+                                    LR"(resources/tree.wobj)",
+                                    const_heaps.get_gpu_handle(heap_ids::scene_tex),
+                                    scene_texture.placements[texture_ids::tree_texture],
+                                    object_id_giver);
+    environment_textures.push_back(texture_ids::tree_texture);
+    environment_filenames.push_back(LR"(resources/tree.wobj)");
 
     obj_id_to_transform[object_id_giver.get_id("tree.off")] =
-        DirectX::XMMatrixTranspose(DirectX::XMMatrixTranslation(-4.0f, 0.0f, 3.0f));
+        math::affine_translation(-4.0f, 0.0f, 3.0f);
+}
+
+std::vector<Asset_cache<Mesh>::handle_t> Game::get_prop_meshes() {
+    std::vector<Asset_cache<Mesh>::handle_t> meshes;
+    for (texture_ids texture : PropTextures) {
+        auto object = std::find(environment_textures.begin(), environment_textures.end(), texture);
+        meshes.push_back(environment_objects[object - environment_textures.begin()].get_mesh());
+    }
+    return meshes;
+}
+
+std::vector<scatter::circle_t> Game::get_scatter_exclusions() {
+    std::vector<scatter::circle_t> exclusions = {{0, 0, PlayerStartClearance}};
+    for (unsigned int i = 0; i < environment_objects.size(); i++) {
+        Object &object = environment_objects[i];
+        math::float4 sphere = object.get_bounding_sphere();
+        math::matrix world = math::to_matrix(get_group_transform(object.get_off_id()));
+        math::float3 center;
+        math::store(center, math::transform3(math::set(sphere.x, sphere.y, sphere.z, 1), world));
+        float yard = environment_textures[i] == texture_ids::house_texture ? HouseYardRadius : 0;
+        exclusions.push_back({center.x, center.z, sphere.w + yard + ScatterClearance});
+    }
+    return exclusions;
+}
+
+math::affine Game::get_group_transform(unsigned int id) {
+    auto transform = obj_id_to_transform.find(id);
+    return transform == obj_id_to_transform.end() ? math::affine_identity() : transform->second;
+}
+
+void Game::build_scene_tree() {
+    scene_tree.init(SceneTreeMargin);
+    scene_item_objects.clear();
+    for (unsigned int i = 0; i < environment_objects.size(); i++) {
+        for (const auto &[id, bounds] : environment_objects[i].get_group_bounds()) {
+            scene_tree.insert(Aabb_tree::transform(bounds, get_group_transform(id)));
+            scene_item_objects.push_back(i);
+        }
+    }
+    scene_tree.flatten();
+    visible_objects.assign(environment_objects.size(), true);
+}
+
+void Game::draw_occluders(const math::matrix &view_proj) {
+    occlusion_buffer.clear(view_proj);
+    auto house = std::find(environment_textures.begin(), environment_textures.end(),
+                           texture_ids::house_texture);
+    Object &object = environment_objects[house - environment_textures.begin()];
+    occluder_transforms.clear();
+    occluder_transforms.push_back(get_group_transform(object.get_off_id()));
+    cell_streamer.get_placements(world_cells::house, occluder_transforms);
+
+    math::vector camera = player.get_camera_position();
+    auto distance = [&camera](const math::affine &transform) {
+        float dx = transform.m[3][0] - math::get_x(camera);
+        float dz = transform.m[3][2] - math::get_z(camera);
+        return dx * dx + dz * dz;
+    };
+    auto end = occluder_transforms.begin()
+               + (std::min)(occluder_transforms.size(), static_cast<std::size_t>(MaxOccluders));
+    std::partial_sort(occluder_transforms.begin(), end, occluder_transforms.end(),
+                      [&distance](const math::affine &a, const math::affine &b) {
+                          return distance(a) < distance(b);
+                      });
+    const Mesh::collision_mesh_t &mesh = object.get_mesh()->get_collision_mesh();
+    for (auto transform = occluder_transforms.begin(); transform != end; transform++) {
+        occlusion_buffer.add_occluder(mesh.positions.data(), mesh.indices.data(),
+                                      mesh.indices.size(), math::to_matrix(*transform));
+    }
+    occlusion_buffer.build_pyramid();
+}
+
+void Game::cull_objects(const math::matrix &view_proj) {
+    draw_occluders(view_proj);
+    scene_query_results.clear();
+    scene_tree.query_frustum(Aabb_tree::get_frustum(view_proj), scene_query_results);
+    visible_objects.assign(environment_objects.size(), false);
+    for (unsigned int item : scene_query_results) {
+        unsigned int object = scene_item_objects[item];
+        if (!visible_objects[object] && occlusion_buffer.is_visible(scene_tree.get_box(item))) {
+            visible_objects[object] = true;
+        }
+    }
+}
+
+void Game::collide_camera() {
+    math::float3 origin, direction;
+    float length, distance;
+    unsigned int item;
+    player.get_camera_ray(origin, direction, length);
+    // a box around the player is entered at 0, the camera isn't pulled in for it
+    if (scene_tree.raycast(origin, direction, length + CameraCollisionMargin, item, distance)
+        && distance > 0) {
+        player.limit_camera_distance(distance - CameraCollisionMargin);
+    } else {
+        player.limit_camera_distance(length);
+    }
+}
+
+void Game::build_collision_world() {
+    collision_world.init(CollisionStepHeight, CollisionHeadHeight);
+    std::vector<math::float3> world_positions;
+    for (Object &object : environment_objects) {
+        const Mesh::collision_mesh_t &mesh = object.get_collision_mesh();
+        world_positions.resize(mesh.positions.size());
+        for (std::size_t i = 0; i < mesh.positions.size(); i++) {
+            math::matrix world = math::to_matrix(get_group_transform(mesh.groups[i]));
+            math::store(world_positions[i],
+                        math::transform3(math::load(mesh.positions[i]), world));
+        }
+        collision_world.add_triangles(world_positions.data(), mesh.indices.data(),
+                                      mesh.indices.size());
+    }
+    cell_streamer.add_walls(collision_world);
+    collision_world.build();
+
+    std::stringstream s;
+    s << "collision: " << collision_world.get_segment_count() << " wall segments\n";
+    OutputDebugStringA(s.str().c_str());
 }
 
 double Game::get_delta_time() {
@@ -57,44 +243,621 @@ double Game::get_time() {
     return microseconds_passed / 1'000'000;
 }
 
+void Game::init_input_replay() {
+    int argument_count = 0;
+    LPWSTR *arguments = CommandLineToArgvW(GetCommandLineW(), &argument_count);
+    if (!arguments) {
+        return;
+    }
+    std::vector<std::wstring> options(arguments + 1, arguments + argument_count);
+    LocalFree(arguments);
+
+    for (std::size_t i = 0; i < options.size(); i++) {
+        bool has_value = i + 1 < options.size();
+        if (options[i] == L"--record" && has_value) {
+            input_recording_path = options[++i];
+            input_recorder.init(SimulationStep);
+            recording_input = true;
+        } else if (options[i] == L"--replay" && has_value) {
+            input_replayer.init(options[++i]);
+            replaying_input = true;
+        } else if (options[i] == L"--headless") {
+            headless_replay = true;
+        } else if (options[i] == L"--submission" && has_value) {
+            std::wstring name = options[++i];
+            if (name == L"indirect") {
+                submission = submission_t::indirect;
+            } else if (name == L"parallel") {
+                submission = submission_t::parallel;
+            } else if (name == L"single") {
+                submission = submission_t::single;
+            } else {
+                throw std::runtime_error("--submission takes indirect, parallel or single");
+            }
+        }
+    }
+    if (recording_input && replaying_input) {
+        throw std::runtime_error("--record and --replay can't be used together");
+    }
+    headless_replay = headless_replay && replaying_input;
+}
+
+void Game::step_replay() {
+    input_recording::step_t step = input_replayer.next();
+    for (const input_recording::event_t &event : step.events) {
+        if (event.down) {
+            player.key_down(event.key);
+        } else {
+            player.key_up(event.key);
+        }
+    }
+    player.update(step.delta_time, collision_world);
+    replay_time += step.delta_time;
+}
+
+void Game::run_headless_replay() {
+    while (!input_replayer.done()) {
+        auto frame_start = std::chrono::high_resolution_clock::now();
+        // the terrain's and the cells' retired buffers, there is no hot reload to collect them
+        retired_resources.collect();
+        step_replay();
+        recalculate_matrix(replay_time);
+        fill_render_queue();
+        auto frame_end = std::chrono::high_resolution_clock::now();
+        replay_frame_milliseconds.push_back(
+            std::chrono::duration<double, std::milli>(frame_end - frame_start).count());
+    }
+    report_replay();
+    PostMessage(hwnd, WM_CLOSE, 0, 0);
+}
+
+void Game::report_replay() {
+    std::vector<double> sorted = replay_frame_milliseconds;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0;
+    for (double milliseconds : sorted) {
+        total += milliseconds;
+    }
+    auto percentile = [&sorted](double fraction) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        return sorted[static_cast<std::size_t>(fraction * (sorted.size() - 1))];
+    };
+    math::float3 position;
+    math::store(position, player.get_position());
+
+    std::stringstream s;
+    s << "replay" << (headless_replay ? " (headless)" : "") << ": " << sorted.size()
+      << " frames, " << replay_time << " s simulated, frame ms mean "
+      << (sorted.empty() ? 0 : total / sorted.size()) << ", median " << percentile(0.5)
+      << ", 95th " << percentile(0.95) << ", max " << percentile(1) << "\n";
+    s << "replay: the player ended at " << position.x << ", " << position.y << ", " << position.z
+      << "\n";
+    OutputDebugStringA(s.str().c_str());
+}
+
 void Game::recalculate_matrix(double angle) {
 
-    DirectX::XMMATRIX world, proj;
+    math::matrix world, proj;
+
+    world = math::multiply(math::rotation_y(static_cast<float>(2.5f * angle)),
+                           math::rotation_x(static_cast<float>(sin(angle)) / 2.0f));
+
+    proj = math::perspective_fov_lh(45.0f, static_cast<float>(width / height), NearPlane,
+                                    FarPlane);
+
+    collide_camera();
+    math::matrix view_proj = math::multiply(player.get_view_matrix(), proj);
+    cull_objects(view_proj);
+    math::float3 camera_position;
+    math::store(camera_position, player.get_camera_position());
+    terrain_chunks.update(job_system, camera_position, view_proj, retired_resources,
+                          m_commandQueue);
+    math::vector player_position = player.get_position();
+    // size in pixels of one unit at distance 1
+    float pixels_per_unit = math::get_y(proj.r[1]) * height / 2;
+    cell_streamer.update(job_system, math::get_x(player_position), math::get_z(player_position),
+                         camera_position, view_proj, pixels_per_unit, collision_world,
+                         retired_resources, m_commandQueue);
+    shadow_maps.update(player.get_view_matrix(), proj, NearPlane, ShadowDistance,
+                       ShadowSplitLambda, math::load(LightDirection));
+    select_lods(proj);
+    cull_meshlets(proj);
+    stream_textures(proj);
+
+    // written straight into the mapped buffer, the GPU finished the last frame before this one
+    // started, every member is written once and none is read back from the write-combined memory
+    Shader_const_buffer &buff = *static_cast<Shader_const_buffer *>(matrix_buffer.data());
+
+    math::affine world_transforms[WORLD_MATRIX_COUNT];
+    std::fill(std::begin(world_transforms), std::end(world_transforms), math::affine_identity());
+
+    //object_id_giver.write();
+    for (const auto& [obj_id, transform] : obj_id_to_transform) {
+        world_transforms[obj_id] = transform;
+    }
+
+    player.fill_const_buffer(buff, world_transforms);
+    math::store_column_major(world_transforms, WORLD_MATRIX_COUNT, buff.matWorld);
+
+    math::store_column_major(buff.matProj, proj);
 
-    world = DirectX::XMMatrixMultiply(
-        DirectX::XMMatrixRotationY(2.5f * angle),
-        DirectX::XMMatrixRotationX(static_cast<FLOAT>(sin(angle)) / 2.0f));
+    buff.colLight = {1.0f, 1.0f, 1.0f, 1.0f};
+    buff.dirLight = LightDirection;
+    shadow_maps.fill_const_buffer(buff);
+
+    float min_lods[MIN_LOD_SLICES] = {};
+    if (scene_texture.streaming) {
+        for (unsigned int i = 0; i < scene_texture.streamer->get_slice_count(); i++) {
+            min_lods[i] = scene_texture.streamer->get_min_lod(i);
+        }
+    }
+    std::memcpy(buff.sliceMinLod, min_lods, sizeof(min_lods));
+}
 
-    proj = DirectX::XMMatrixPerspectiveFovLH(45.0f, width / height, 0.1f, 100.0f);
+void Game::stream_textures(const math::matrix &proj) {
+    if (!scene_texture.streaming) {
+        return;
+    }
+    constexpr static float near_distance = 0.1f;
+
+    float pixels_per_unit = math::get_y(proj.r[1]) * height / 2;
+    math::vector player_position = player.get_position();
+
+    // an object's image is taken to stretch once across its bounding sphere
+    auto want = [&](texture_ids texture, float radius, float distance) {
+        const texture_packer::placement_t &placement = scene_texture.placements[texture];
+        float texels = (std::max)(placement.scale[0] * scene_texture.size[0],
+                                  placement.scale[1] * scene_texture.size[1]);
+        float screen_pixels =
+            2 * radius * pixels_per_unit / (std::max)(distance, near_distance);
+        scene_texture.streamer->want(placement.slice, std::log2(texels / screen_pixels),
+                                     screen_pixels);
+    };
 
+    for (unsigned int i = 0; i < environment_objects.size(); i++) {
+        Object &object = environment_objects[i];
+        math::float4 sphere = object.get_bounding_sphere();
+        math::matrix world = math::to_matrix(obj_id_to_transform.at(object.get_off_id()));
+        math::vector center = math::transform3(math::set(sphere.x, sphere.y, sphere.z, 1), world);
+        float distance = math::length3(math::subtract(center, player_position)) - sphere.w;
+        want(environment_textures[i], sphere.w, distance);
+    }
+    // the player is seen from the camera
+    float player_distance =
+        math::length3(math::subtract(player.get_camera_position(), player_position));
+    want(texture_ids::person_texture, player.get_bounding_radius(), player_distance);
+    // the closest ground is under the player
+    want(texture_ids::ground_texture, terrain_chunks.get_texture_span() / 2, player_distance);
+    // and the closest prop of every kind in the cells
+    std::vector<Asset_cache<Mesh>::handle_t> prop_meshes = get_prop_meshes();
+    for (unsigned int kind = 0; kind < world_cells::kind_count; kind++) {
+        float distance, scale;
+        if (cell_streamer.get_closest_prop(kind, math::get_x(player_position),
+                                           math::get_z(player_position), distance, scale)) {
+            float radius = prop_meshes[kind]->get_bounding_sphere().w * scale;
+            want(PropTextures[kind], radius, distance - radius);
+        }
+    }
 
-    world = XMMatrixTranspose(world);
-    proj = XMMatrixTranspose(proj);
+    scene_texture.streamer->update(job_system, m_commandQueue);
+}
 
-    DirectX::XMMATRIX alternative = DirectX::XMMatrixTranslation(0.0f, 0.0f, 0.0f);
-    alternative = XMMatrixTranspose(alternative);
+void Game::select_lods(const math::matrix &proj) {
+    constexpr static float near_distance = 0.1f;
+
+    // size in pixels of one unit at distance 1
+    float pixels_per_unit = math::get_y(proj.r[1]) * height / 2;
+    math::vector camera_position = player.get_camera_position();
+
+    job_system.parallel_for(0, environment_objects.size(), 1, [&](unsigned int first,
+                                                                  unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            Object &object = environment_objects[i];
+            math::float4 sphere = object.get_bounding_sphere();
+            math::matrix world = math::to_matrix(obj_id_to_transform.at(object.get_off_id()));
+            math::vector center =
+                math::transform3(math::set(sphere.x, sphere.y, sphere.z, 1), world);
+            float distance = math::length3(math::subtract(center, camera_position)) - sphere.w;
+            object.select_lod(pixels_per_unit / (std::max)(distance, near_distance));
+        }
+    });
+}
 
-    Shader_const_buffer buff;
+void Game::cull_meshlets(const math::matrix &proj) {
+    math::matrix view_proj = math::multiply(player.get_view_matrix(), proj);
+    math::vector camera_position = player.get_camera_position();
+
+    // every object counts on its own, summed after the jobs are done
+    std::vector<meshlet::cull_statistics> object_statistics(environment_objects.size());
+    job_system.parallel_for(0, environment_objects.size(), 1, [&](unsigned int first,
+                                                                  unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            Object &object = environment_objects[i];
+            math::matrix world = math::to_matrix(obj_id_to_transform.at(object.get_off_id()));
+            object.cull_meshlets(world, view_proj, camera_position, object_statistics[i]);
+        }
+    });
 
-    for (unsigned int i = 0; i < 10; i++) {
-        XMStoreFloat4x4(&buff.matWorld[i], alternative);
+    meshlet_statistics = {};
+    for (const meshlet::cull_statistics &statistics : object_statistics) {
+        meshlet_statistics.add(statistics);
     }
+}
 
-    //object_id_giver.write();
-    for (const auto& [obj_id, transform] : obj_id_to_transform) {
+void Game::report_statistics(double time) {
+    if (time - last_report_time < 1) {
+        return;
+    }
+    last_report_time = time;
+
+    std::stringstream s;
+    s << "meshlets: " << meshlet_statistics.total << ", frustum culled "
+      << meshlet_statistics.frustum_culled << ", backface culled "
+      << meshlet_statistics.backface_culled << ", culling took "
+      << meshlet_statistics.cull_microseconds << " us\n";
+    if (recorded_submission == submission_t::indirect) {
+        s << "indirect draws: " << indirect_statistics.commands << " commands, built in "
+          << indirect_statistics.build_microseconds << " us, recording took "
+          << recording_microseconds << " us\n";
+    } else {
+        if (recorded_submission == submission_t::parallel) {
+            s << "command lists: " << parallel_recorder.get_worker_count() << " on "
+              << job_system.get_thread_count() << " threads";
+        } else {
+            s << "command lists: 1 on the main thread";
+        }
+        s << ", recording took " << recording_microseconds << " us\n";
+        s << "draws: " << render_statistics.draws << ", state changes "
+          << render_statistics.state_changes << " sorted, "
+          << render_statistics.unsorted_state_changes << " unsorted\n";
+    }
+    if (scene_texture.streaming) {
+        Texture_streamer::statistics_t statistics = scene_texture.streamer->get_statistics();
+        s << "textures: " << (statistics.usage >> 20) << " of " << (statistics.budget >> 20)
+          << " MB resident, " << statistics.residency.loads_in_flight << " loads in flight, "
+          << statistics.residency.loads << " loaded, " << statistics.residency.evictions
+          << " evicted\n";
+    }
+    Terrain_chunks::statistics_t terrain = terrain_chunks.get_statistics();
+    s << "terrain: " << terrain.drawn << " chunks drawn, " << terrain.cached << " cached, "
+      << terrain.wanted << " wanted, " << terrain.built << " built at "
+      << terrain.chunks_per_second << " chunks/s, " << terrain.evicted << " evicted\n";
+    Cell_streamer::statistics_t cells = cell_streamer.get_statistics();
+    s << "cells: " << cells.residency.resident << " resident with " << cells.props << " props, "
+      << cells.drawn_props << " drawn in " << cells.drawn << " draws, "
+      << cells.residency.loads_in_flight << " loading, " << (cells.residency.usage >> 20)
+      << " of " << (cells.residency.budget >> 20) << " MB, "
+      << cells.residency.loads << " loaded, " << cells.residency.unloads << " unloaded, "
+      << cells.residency.refused << " refused, taking them in took at most "
+      << cells.max_transition_microseconds << " us a frame, " << cells.capped_frames
+      << " frames capped\n";
+    const Occlusion_buffer::statistics_t &occlusion = occlusion_buffer.get_statistics();
+    s << "occlusion: the last frame " << occlusion.occluders << " occluders, "
+      << occlusion.triangles << " triangles drawn in " << occlusion.rasterize_microseconds
+      << " us, " << occlusion.culled << " of " << occlusion.tested << " boxes culled in "
+      << occlusion.test_microseconds << " us\n";
+    const Shadow_maps::statistics_t &shadows = shadow_maps.get_statistics();
+    s << "shadows: " << shadows.cascades_drawn << " of " << shadow_maps.get_cascade_count()
+      << " cascades drawn with " << shadows.casters << " casters culled in "
+      << shadow_cull_microseconds << " us and recorded in " << shadows.record_microseconds
+      << " us, the passes took " << shadows.gpu_milliseconds << " of the GPU's "
+      << shadows.gpu_frame_milliseconds << " ms, " << 100 * shadows.share << "% smoothed of a "
+      << 100 * ShadowBudget << "% budget, the far cascades redrawn every "
+      << shadows.refresh_interval << " frames\n";
+    s << "shadow draws: " << shadows.draws.draws << ", state changes "
+      << shadows.draws.state_changes << " sorted, " << shadows.draws.unsorted_state_changes
+      << " unsorted\n";
+    OutputDebugStringA(s.str().c_str());
+}
+
+void Game::report_assets() {
+    std::stringstream s;
+    Asset_source::statistics_t files = asset_source->get_statistics();
+    s << "files: " << (asset_source == &asset_archive ? "archive" : "loose") << ", "
+      << files.files_opened << " opened, " << files.reads << " reads, "
+      << files.bytes_read / 1024 << " KB read for " << files.bytes / 1024 << " KB in "
+      << files.milliseconds << " ms\n";
+    auto report = [&s](const char *kind, auto &cache) {
+        auto statistics = cache.get_statistics();
+        s << kind << ": " << statistics.requests << " requests, " << statistics.loads
+          << " loads, " << statistics.coalesced << " coalesced\n";
+        std::size_t total = 0;
+        for (const auto &entry : cache.get_report()) {
+            s << "  " << entry.path << ": " << entry.bytes / 1024 << " KB, " << entry.handles
+              << " handles\n";
+            total += entry.bytes;
+        }
+        s << "  total " << total / 1024 << " KB\n";
+    };
+    report("images", image_cache);
+    report("meshes", mesh_cache);
+    OutputDebugStringA(s.str().c_str());
+}
 
-        XMStoreFloat4x4(&buff.matWorld[obj_id], transform);
+void Game::init_hot_reload() {
+    retired_resources.init(m_device);
+    // the archive is what ships, there is nothing to edit in it
+    if (asset_source != &loose_files) {
+        return;
     }
+    reload_upload_batch.init(m_device);
+    D3D12_DESCRIPTOR_HEAP_DESC heap_desc = {.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+                                            .NumDescriptors = 1,
+                                            .Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE,
+                                            .NodeMask = 0};
+    check_output(
+        m_device->CreateDescriptorHeap(&heap_desc, IID_PPV_ARGS(&reload_descriptor_heap)));
+    resource_watcher.init(ResourceDirectory);
+    watching_resources = true;
+}
 
-    player.fill_const_buffer(buff);
+void Game::update_hot_reload() {
+    retired_resources.collect();
+    if (!watching_resources) {
+        return;
+    }
+    for (const std::filesystem::path &path : resource_watcher.poll()) {
+        changed_files.insert(path);
+    }
+    if (reload && reload->counter.done()) {
+        apply_reload();
+    }
+    if (!reload && !changed_files.empty()) {
+        start_reload();
+    }
+}
 
+void Game::start_reload() {
+    auto loading = std::make_unique<reload_t>();
+    loading->changed_meshes.resize(environment_objects.size() + 1, false);
+    bool any_changed = false;
+    // other files, like the .lod files meshes write, are ignored
+    for (const std::filesystem::path &path : changed_files) {
+        for (PCWSTR filename : TextureFilenames) {
+            if (path == filename) {
+                loading->images_changed = any_changed = true;
+            }
+        }
+        for (unsigned int i = 0; i < environment_filenames.size(); i++) {
+            if (path == environment_filenames[i]) {
+                loading->changed_meshes[i] = any_changed = true;
+            }
+        }
+        if (path == Player::obj_filename) {
+            loading->changed_meshes.back() = any_changed = true;
+        }
+    }
+    changed_files.clear();
+    if (!any_changed) {
+        return;
+    }
 
-    XMStoreFloat4x4(&buff.matProj, proj);
+    loading->id_giver = object_id_giver;
+    reload = std::move(loading);
+    reload_t *started = reload.get();
+    job_system.run([this, started] { load_reload(*started); }, reload->counter);
+}
 
-    buff.colLight = {1.0f, 1.0f, 1.0f, 1.0f};
-    buff.dirLight = {1, 1, 1, 0.0f};
+void Game::load_reload(reload_t &loading) {
+    // WIC decodes on this thread, which may not have COM yet
+    HRESULT com_result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+    try {
+        const std::vector<texture_packer::placement_t> *placements = &scene_texture.placements;
+        if (loading.images_changed) {
+            loading.scene_texture = std::make_unique<scene_texture_t>(load_scene_texture(
+                reload_upload_batch, reload_descriptor_heap->GetCPUDescriptorHandleForHeapStart()));
+            placements = &loading.scene_texture->placements;
+        }
+        // the uvs are baked into the meshes, so every mesh is loaded again when images moved
+        bool placements_changed = *placements != scene_texture.placements;
+
+        loading.meshes.resize(loading.changed_meshes.size());
+        for (unsigned int i = 0; i < loading.meshes.size(); i++) {
+            if (!placements_changed && !loading.changed_meshes[i]) {
+                continue;
+            }
+            bool is_player = i == environment_objects.size();
+            PCWSTR filename = is_player ? Player::obj_filename : environment_filenames[i];
+            texture_ids texture = is_player ? texture_ids::person_texture : environment_textures[i];
+            loading.meshes[i] =
+                Object::load_mesh(m_device, reload_upload_batch, mesh_cache, filename,
+                                  const_heaps.get_gpu_handle(heap_ids::scene_tex),
+                                  (*placements)[texture], loading.id_giver);
+
+            // groups seen for the first time get new ids, the others keep theirs
+            if (loading.id_giver.get_count() > WORLD_MATRIX_COUNT) {
+                throw std::runtime_error(std::filesystem::path(filename).string()
+                                         + " has more groups than there are world matrices");
+            }
+            // the transforms are found by the off group's id, which comes from the object name
+            unsigned int off_id = is_player ? loading.id_giver.get_id("person.off")
+                                            : environment_objects[i].get_off_id();
+            if (loading.meshes[i]->mesh->get_off_id() != off_id) {
+                throw std::runtime_error(std::filesystem::path(filename).string()
+                                         + " names its object differently");
+            }
+        }
+        reload_upload_batch.flush();
+    } catch (...) {
+        if (SUCCEEDED(com_result)) {
+            CoUninitialize();
+        }
+        throw;
+    }
+    if (SUCCEEDED(com_result)) {
+        CoUninitialize();
+    }
+}
+
+void Game::apply_reload() {
+    std::unique_ptr<reload_t> loaded = std::move(reload);
+    try {
+        job_system.wait(loaded->counter);
+    } catch (const std::exception &exception) {
+        OutputDebugStringA(
+            (std::string("hot reload failed, keeping the old assets: ") + exception.what() + "\n")
+                .c_str());
+        return;
+    }
+
+    object_id_giver = loaded->id_giver;
+    unsigned int swapped_meshes = 0;
+    if (loaded->scene_texture) {
+        if (scene_texture.streaming) {
+            scene_texture.streamer->release(job_system);
+        }
+        // the last frame is done on the GPU, so the heap's view can be overwritten
+        m_device->CopyDescriptorsSimple(
+            1, const_heaps.get_cpu_handle(heap_ids::scene_tex),
+            reload_descriptor_heap->GetCPUDescriptorHandleForHeapStart(),
+            D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        std::swap(scene_texture, *loaded->scene_texture);
+        retired_resources.retire(m_commandQueue, std::move(loaded->scene_texture));
+        terrain_chunks.set_placement(job_system,
+                                     scene_texture.placements[texture_ids::ground_texture],
+                                     retired_resources, m_commandQueue);
+    }
+    for (unsigned int i = 0; i < loaded->meshes.size(); i++) {
+        if (!loaded->meshes[i]) {
+            continue;
+        }
+        Object::loaded_mesh_t previous = i < environment_objects.size()
+                                             ? environment_objects[i].swap_mesh(
+                                                   std::move(*loaded->meshes[i]))
+                                             : player.swap_mesh(std::move(*loaded->meshes[i]));
+        retired_resources.retire(m_commandQueue,
+                                 std::make_shared<Object::loaded_mesh_t>(std::move(previous)));
+        swapped_meshes++;
+    }
+    if (swapped_meshes > 0) {
+        cell_streamer.set_meshes(job_system, get_prop_meshes(), collision_world,
+                                 retired_resources, m_commandQueue);
+        build_scene_tree();
+        build_collision_world();
+    }
+
+    std::stringstream s;
+    s << "hot reload: " << swapped_meshes << " meshes"
+      << (loaded->images_changed ? " and the scene texture" : "") << " swapped in, "
+      << retired_resources.get_count() << " retired resources waiting for the GPU\n";
+    OutputDebugStringA(s.str().c_str());
+}
+
+void Game::set_draw_state(ComPtr<ID3D12GraphicsCommandList> &command_list) {
+    command_list->SetGraphicsRootSignature(m_rootSignature.Get());
+
+    ID3D12DescriptorHeap *pHeaps = const_heaps.get_heap_ptr();
+    command_list->SetDescriptorHeaps(1, &pHeaps);
+
+
+    command_list->SetGraphicsRootDescriptorTable(0, const_heaps.get_gpu_handle(0));
+
+    // indirect draws don't bind a texture, so the scene texture is there from the start
+    command_list->SetGraphicsRootDescriptorTable(Render_queue::texture_argument,
+                                                 const_heaps.get_gpu_handle(heap_ids::scene_tex));
+    command_list->SetGraphicsRootDescriptorTable(Shadow_maps::shadow_map_argument,
+                                                 const_heaps.get_gpu_handle(heap_ids::shadow_tex));
+
+
+    D3D12_VIEWPORT viewport = {
+        .TopLeftX = 0.0f,
+        .TopLeftY = 0.0f,
+        .Width = static_cast<float>(width),
+        .Height = static_cast<float>(height),
+        .MinDepth = 0.0f,
+        .MaxDepth = 1.0f,
+
+    };
+    D3D12_RECT scissor_rect = {
+        .left = 0, .right = static_cast<LONG>(width), .bottom = static_cast<LONG>(height)};
+    command_list->RSSetViewports(1, &viewport);
+    command_list->RSSetScissorRects(1, &scissor_rect);
+
+    command_list->OMSetRenderTargets(1, &m_rtvHandles[m_frameIndex], FALSE,
+                                     &depth_buffer.get_view());
+
+    command_list->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
+
+void Game::set_shadow_state(ComPtr<ID3D12GraphicsCommandList> &command_list) {
+    command_list->SetGraphicsRootSignature(m_rootSignature.Get());
+
+    ID3D12DescriptorHeap *pHeaps = const_heaps.get_heap_ptr();
+    command_list->SetDescriptorHeaps(1, &pHeaps);
+
+    command_list->SetGraphicsRootDescriptorTable(0, const_heaps.get_gpu_handle(0));
+}
+
+unsigned int Game::get_draw_count() {
+    return environment_objects.size() + Terrain_chunks::MaxDraws + Cell_streamer::MaxDraws + 1;
+}
+
+void Game::fill_render_queue() {
+    math::matrix view = player.get_view_matrix();
+
+    render_queue.clear();
+    for (unsigned int i = 0; i < environment_objects.size(); i++) {
+        if (!visible_objects[i]) {
+            continue;
+        }
+        Object &object = environment_objects[i];
+        math::float4 sphere = object.get_bounding_sphere();
+        math::matrix world = math::to_matrix(obj_id_to_transform.at(object.get_off_id()));
+        math::vector center = math::transform3(math::set(sphere.x, sphere.y, sphere.z, 1),
+                                               math::multiply(world, view));
+        object.submit(render_queue, m_pipelineState.Get(), math::get_z(center) - sphere.w);
+    }
+    terrain_chunks.submit(render_queue, m_pipelineState.Get(), player.get_view_matrix());
+    cell_streamer.submit(render_queue, m_pipelineState.Get(), player.get_view_matrix(),
+                         occlusion_buffer);
+    player.submit(render_queue, m_pipelineState.Get());
+    render_queue.sort();
+    fill_shadow_queues();
+}
 
-    memcpy(matrix_buffer.data(), &buff, sizeof(buff));
+void Game::fill_shadow_queues() {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    math::float3 position;
+    math::store(position, player.get_position());
+    float radius = player.get_bounding_radius();
+    // the person stands at position, no taller than the bounding sphere is wide
+    Aabb_tree::box_t player_box = {{position.x - radius, position.y, position.z - radius},
+                                   {position.x + radius, position.y + 2 * radius,
+                                    position.z + radius}};
+    ID3D12PipelineState *pipeline_state = m_shadowPipelineState.Get();
+    job_system.parallel_for(
+        0, shadow_maps.get_cascade_count(), 1, [&](unsigned int first, unsigned int end) {
+            for (unsigned int cascade = first; cascade < end; cascade++) {
+                if (!shadow_maps.is_due(cascade)) {
+                    continue;
+                }
+                Render_queue &queue = shadow_maps.get_queue(cascade);
+                Aabb_tree::frustum_t casters = shadow_maps.get_caster_frustum(cascade);
+                std::vector<unsigned int> &results = shadow_query_results[cascade];
+                std::vector<bool> &casting = shadow_casting_objects[cascade];
+                results.clear();
+                scene_tree.query_frustum(casters, results);
+                casting.assign(environment_objects.size(), false);
+                for (unsigned int item : results) {
+                    casting[scene_item_objects[item]] = true;
+                }
+                for (unsigned int i = 0; i < environment_objects.size(); i++) {
+                    if (casting[i]) {
+                        environment_objects[i].submit_caster(queue, pipeline_state);
+                    }
+                }
+                terrain_chunks.submit_casters(queue, pipeline_state, casters);
+                cell_streamer.submit_casters(queue, pipeline_state, casters);
+                if (Aabb_tree::intersects(casters, player_box)) {
+                    player.submit_caster(queue, pipeline_state);
+                }
+            }
+        });
+    auto end_point = std::chrono::high_resolution_clock::now();
+    shadow_cull_microseconds =
+        std::chrono::duration<double, std::micro>(end_point - start_point).count();
 }
 
 void Game::set_root_signature() {
@@ -108,6 +871,11 @@ void Game::set_root_signature() {
          .NumDescriptors = 1,
          .BaseShaderRegister = 0,
          .RegisterSpace = 0,
+         .OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND},
+        {.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
+         .NumDescriptors = 1,
+         .BaseShaderRegister = 1,
+         .RegisterSpace = 0,
          .OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND}
     };
 
@@ -117,7 +885,18 @@ void Game::set_root_signature() {
          .ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL  },
         {.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
          .DescriptorTable = {1, &root_signature_ranges[1]},
-         .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL}
+         .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL },
+        {.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+         .Constants = {.ShaderRegister = 1,
+                       .RegisterSpace = 0,
+                       .Num32BitValues = sizeof(mesh_bounds_t) / 4},
+         .ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX},
+        {.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
+         .DescriptorTable = {1, &root_signature_ranges[2]},
+         .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL },
+        {.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+         .Constants = {.ShaderRegister = 3, .RegisterSpace = 0, .Num32BitValues = 1},
+         .ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX}
     };
 
     D3D12_STATIC_SAMPLER_DESC tex_sampler_desc = {
@@ -135,13 +914,29 @@ void Game::set_root_signature() {
         .RegisterSpace = 0,
         .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL};
 
+    // compares with the shadow maps' depths, lit past their sides
+    D3D12_STATIC_SAMPLER_DESC shadow_sampler_desc = {
+        .Filter = D3D12_FILTER_COMPARISON_MIN_MAG_LINEAR_MIP_POINT,
+        .AddressU = D3D12_TEXTURE_ADDRESS_MODE_BORDER,
+        .AddressV = D3D12_TEXTURE_ADDRESS_MODE_BORDER,
+        .AddressW = D3D12_TEXTURE_ADDRESS_MODE_BORDER,
+        .MipLODBias = 0,
+        .MaxAnisotropy = 0,
+        .ComparisonFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL,
+        .BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE,
+        .MinLOD = 0.0f,
+        .MaxLOD = D3D12_FLOAT32_MAX,
+        .ShaderRegister = 1,
+        .RegisterSpace = 0,
+        .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL};
+    D3D12_STATIC_SAMPLER_DESC sampler_descs[] = {tex_sampler_desc, shadow_sampler_desc};
 
     D3D12_ROOT_SIGNATURE_DESC root_signature_desc = {};
 
     root_signature_desc.NumParameters = _countof(root_signature_params);
     root_signature_desc.pParameters = root_signature_params;
-    root_signature_desc.NumStaticSamplers = 1;
-    root_signature_desc.pStaticSamplers = &tex_sampler_desc;
+    root_signature_desc.NumStaticSamplers = _countof(sampler_descs);
+    root_signature_desc.pStaticSamplers = sampler_descs;
     root_signature_desc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT
                                 | D3D12_ROOT_SIGNATURE_FLAG_DENY_HULL_SHADER_ROOT_ACCESS
                                 | D3D12_ROOT_SIGNATURE_FLAG_DENY_DOMAIN_SHADER_ROOT_ACCESS
@@ -159,7 +954,33 @@ void Game::set_root_signature() {
 
 void Game::create_graphics_pipeline_state() {
 
-    D3D12_INPUT_ELEMENT_DESC input_elements[] = {
+#ifdef PACKED_VERTICES
+    // packed_vertex_t, mat_index is stored in the w of POSITION
+    D3D12_INPUT_ELEMENT_DESC vertex_elements[] = {
+        {.SemanticName = "POSITION",
+         .SemanticIndex = 0,
+         .Format = DXGI_FORMAT_R16G16B16A16_UINT,
+         .InputSlot = 0,
+         .AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT,
+         .InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
+         .InstanceDataStepRate = 0},
+        {  .SemanticName = "NORMAL",
+         .SemanticIndex = 0,
+         .Format = DXGI_FORMAT_R16G16_SNORM,
+         .InputSlot = 0,
+         .AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT,
+         .InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
+         .InstanceDataStepRate = 0},
+        {.SemanticName = "TEXCOORD",
+         .SemanticIndex = 0,
+         .Format = DXGI_FORMAT_R16G16_FLOAT,
+         .InputSlot = 0,
+         .AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT,
+         .InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
+         .InstanceDataStepRate = 0},
+    };
+#else
+    D3D12_INPUT_ELEMENT_DESC vertex_elements[] = {
         { .SemanticName = "POSITION",
          .SemanticIndex = 0,
          .Format = DXGI_FORMAT_R32G32B32_FLOAT,
@@ -189,6 +1010,20 @@ void Game::create_graphics_pipeline_state() {
          .InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
          .InstanceDataStepRate = 0},
     };
+#endif
+    // then the instance's math::affine from the second slot, a row each
+    std::vector<D3D12_INPUT_ELEMENT_DESC> input_elements(std::begin(vertex_elements),
+                                                        std::end(vertex_elements));
+    for (UINT row = 0; row < 4; row++) {
+        input_elements.push_back(
+            {.SemanticName = "INSTANCE",
+             .SemanticIndex = row,
+             .Format = DXGI_FORMAT_R32G32B32_FLOAT,
+             .InputSlot = 1,
+             .AlignedByteOffset = static_cast<UINT>(row * sizeof(float[3])),
+             .InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA,
+             .InstanceDataStepRate = 1});
+    }
 
     D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {
         .pRootSignature = m_rootSignature.Get(),
@@ -236,7 +1071,7 @@ void Game::create_graphics_pipeline_state() {
                                            .StencilDepthFailOp = D3D12_STENCIL_OP_KEEP,
                                            .StencilPassOp = D3D12_STENCIL_OP_KEEP,
                                            .StencilFunc = D3D12_COMPARISON_FUNC_ALWAYS}},
-        .InputLayout = {input_elements, _countof(input_elements)},
+        .InputLayout = {input_elements.data(), static_cast<UINT>(input_elements.size())},
         .IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_DISABLED,
         .PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE,
         .NumRenderTargets = 1,
@@ -246,6 +1081,19 @@ void Game::create_graphics_pipeline_state() {
     };
 
     check_output(m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_pipelineState)));
+
+    // no pixel shader or render target, and what is nearer the light than a cascade is clamped
+    // onto its near plane instead of clipped, it still casts into the cascade
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC shadow_desc = psoDesc;
+    shadow_desc.VS = {shadow_vs_main, sizeof(shadow_vs_main)};
+    shadow_desc.PS = {};
+    shadow_desc.RasterizerState.DepthBias = ShadowDepthBias;
+    shadow_desc.RasterizerState.SlopeScaledDepthBias = ShadowSlopeScaledDepthBias;
+    shadow_desc.RasterizerState.DepthClipEnable = FALSE;
+    shadow_desc.NumRenderTargets = 0;
+    shadow_desc.RTVFormats[0] = DXGI_FORMAT_UNKNOWN;
+    check_output(m_device->CreateGraphicsPipelineState(&shadow_desc,
+                                                       IID_PPV_ARGS(&m_shadowPipelineState)));
 }
 
 void Game::init_debug_layer() {
@@ -292,6 +1140,8 @@ Game::Game() {}
 void Game::init(HWND _hwnd) {
     hwnd = _hwnd;
 
+    job_system.init();
+
     D3D12_RECT hwnd_rect;
     GetClientRect(hwnd, &hwnd_rect);
     width = hwnd_rect.right;
@@ -341,25 +1191,99 @@ void Game::init(HWND _hwnd) {
                                     nullptr, IID_PPV_ARGS(&m_commandList[i]));
 
         m_commandList[i]->Close();
+
+        m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_commandAllocator[i].Get(),
+                                    nullptr, IID_PPV_ARGS(&m_endCommandList[i]));
+
+        m_endCommandList[i]->Close();
     }
 
     gpu_waiter.init(m_device);
+    upload_batch.init(m_device);
+    identity_instance.init(m_device, upload_batch,
+                           std::vector<math::affine>{math::affine_identity()});
+    render_queue.init(identity_instance.get_view());
 
     texture_loader.init();
     set_root_signature();
     create_graphics_pipeline_state();
 
-    init_environment_objects();
-
+    if (std::filesystem::exists(ArchiveFilename)) {
+        asset_archive.init(ArchiveFilename, &job_system);
+        asset_source = &asset_archive;
+    }
+    image_cache.init(
+        [](const texture_packer::image_t &image) { return image.pixels.size(); }, asset_source);
+    mesh_cache.init([](const Mesh &mesh) { return mesh.get_memory_size(); }, asset_source);
 
-    player.init(m_device, texture_loader, const_heaps.get_cpu_handle(heap_ids::person_tex),
-                const_heaps.get_gpu_handle(heap_ids::person_tex), object_id_giver);
+    scene_texture =
+        load_scene_texture(upload_batch, const_heaps.get_cpu_handle(heap_ids::scene_tex));
+    init_environment_objects();
+    build_scene_tree();
+    build_collision_world();
+    occlusion_buffer.init(OcclusionWidth, OcclusionHeight);
+    terrain_chunks.init(m_device, const_heaps.get_gpu_handle(heap_ids::scene_tex),
+                        scene_texture.placements[texture_ids::ground_texture],
+                        object_id_giver.get_id("terrain.off"));
+    cell_streamer.init(m_device, get_prop_meshes(), const_heaps.get_gpu_handle(heap_ids::scene_tex),
+                       object_id_giver.get_id("cells.off"), CollisionStepHeight,
+                       CollisionHeadHeight, get_scatter_exclusions());
+
+    player.init(m_device, upload_batch, mesh_cache,
+                const_heaps.get_gpu_handle(heap_ids::scene_tex),
+                scene_texture.placements[texture_ids::person_texture], object_id_giver);
+    upload_batch.flush();
     matrix_buffer.init(m_device, sizeof(Shader_const_buffer),
                        const_heaps.get_cpu_handle(heap_ids::const_buff));
     depth_buffer.init(m_device, width, height);
+    shadow_maps.init(m_device, m_commandQueue, FrameCount, SHADOW_CASCADE_COUNT, ShadowMapSize,
+                     ShadowBudget, const_heaps.get_cpu_handle(heap_ids::shadow_tex),
+                     identity_instance.get_view());
+    shadow_query_results.resize(SHADOW_CASCADE_COUNT);
+    shadow_casting_objects.resize(SHADOW_CASCADE_COUNT);
+
+    // every submission is ready, so they can be switched between frames
+    unsigned int worker_count =
+        (std::min)({job_system.get_thread_count(), MaxRecordingWorkers, get_draw_count()});
+    parallel_recorder.init(m_device, FrameCount, worker_count);
+    worker_render_statistics.resize(worker_count);
+    indirect_draws.init(m_device, m_rootSignature, FrameCount, get_draw_count());
+
+    init_hot_reload();
+    report_assets();
+
+    init_input_replay();
+    // the player collides with the cells' walls
+    cell_streamer.set_deterministic(replaying_input);
+    if (headless_replay) {
+        run_headless_replay();
+    }
 }
 
-void Game::release() {}
+void Game::release() {
+    if (recording_input) {
+        recording_input = false;
+        input_recorder.write(input_recording_path);
+        OutputDebugStringA(("input recording: " + std::to_string(input_recorder.get_step_count())
+                            + " steps written to " + input_recording_path.string() + "\n")
+                               .c_str());
+    }
+    resource_watcher.release();
+    if (reload) {
+        try {
+            job_system.wait(reload->counter);
+        } catch (const std::exception &) {
+            // nothing is swapped in anymore
+        }
+        reload.reset();
+    }
+    if (scene_texture.streaming) {
+        scene_texture.streamer->release(job_system);
+    }
+    terrain_chunks.release(job_system);
+    cell_streamer.release(job_system);
+    job_system.release();
+}
 
 void Game::resize(UINT _width, UINT _height) {
     width = _width;
@@ -367,26 +1291,142 @@ void Game::resize(UINT _width, UINT _height) {
 }
 
 void Game::update() {
-    float delta_time = get_delta_time();
-    player.update(delta_time);
+    double delta_time = get_delta_time();
+    // replays step in paint(), one step a frame
+    if (replaying_input) {
+        return;
+    }
+    unsimulated_time = (std::min)(unsimulated_time + delta_time, MaxSimulationLag);
+    while (unsimulated_time >= SimulationStep) {
+        unsimulated_time -= SimulationStep;
+        if (recording_input) {
+            input_recorder.step();
+        }
+        player.update(SimulationStep, collision_world);
+    }
 }
 
 void Game::key_down(WPARAM key_code, LPARAM flags) {
-    if (!(flags & KF_REPEAT)) {
-        player.key_down(key_code);
+    if (key_code == BenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(
+            benchmark_job_system(Job_system::get_default_thread_count()).c_str());
+        return;
+    }
+    if (key_code == PackerBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_texture_packer(PackerBenchmarkImages).c_str());
+        return;
+    }
+    if (key_code == AssetReportKey && !(flags & KF_REPEAT)) {
+        report_assets();
+        return;
+    }
+    if (key_code == MathBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_math(MathBenchmarkItems).c_str());
+        return;
+    }
+    if (key_code == SpatialHashBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(
+            benchmark_spatial_hash(SpatialHashBenchmarkAgents, job_system).c_str());
+        return;
+    }
+    if (key_code == AabbTreeBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_aabb_tree(AabbTreeBenchmarkBoxes).c_str());
+        return;
+    }
+    if (key_code == CollisionBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_collision(CollisionBenchmarkAgents).c_str());
+        return;
     }
+    if (key_code == TerrainBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_terrain(TerrainBenchmarkChunks, job_system).c_str());
+        return;
+    }
+    if (key_code == WorldStreamingBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_world_streaming(WorldStreamingBenchmarkCells,
+                                                     WorldStreamingBenchmarkFrames, job_system)
+                               .c_str());
+        return;
+    }
+    if (key_code == OcclusionBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_occlusion(OcclusionBenchmarkBoxes).c_str());
+        return;
+    }
+    if (key_code == ShadowBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_shadow_cascades(ShadowBenchmarkBoxes).c_str());
+        return;
+    }
+    if (key_code == MipResidencyBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_mip_residency(MipResidencyBenchmarkTextures).c_str());
+        return;
+    }
+    if (key_code == MeshOptimizerBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_mesh_optimizer(MeshOptimizerBenchmarkTriangles).c_str());
+        return;
+    }
+    if (key_code == MeshletBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_meshlets(MeshletBenchmarkViews).c_str());
+        return;
+    }
+    if (key_code == IndirectDrawsBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_indirect_draws(IndirectDrawsBenchmarkDraws).c_str());
+        return;
+    }
+    if (key_code == ScatterBenchmarkKey && !(flags & KF_REPEAT)) {
+        OutputDebugStringA(benchmark_scatter(ScatterBenchmarkCells, job_system).c_str());
+        return;
+    }
+    if (key_code == RecordingBenchmarkKey && !(flags & KF_REPEAT)) {
+        std::vector<Render_queue::draw_t> draws;
+        for (unsigned int i = 0; i < render_queue.size(); i++) {
+            draws.push_back(render_queue.get_sorted_draw(i));
+        }
+        OutputDebugStringA(benchmark_recording(m_device, job_system, m_pipelineState.Get(),
+                                               draws, RecordingBenchmarkDraws,
+                                               [this](ComPtr<ID3D12GraphicsCommandList> &list) {
+                                                   set_draw_state(list);
+                                               })
+                               .c_str());
+        return;
+    }
+    if (key_code == SubmissionKey && !(flags & KF_REPEAT)) {
+        submission = static_cast<submission_t>((static_cast<unsigned int>(submission) + 1)
+                                               % static_cast<unsigned int>(submission_t::count));
+        return;
+    }
+    if (replaying_input || (flags & KF_REPEAT)) {
+        return;
+    }
+    if (recording_input) {
+        input_recorder.key(static_cast<unsigned int>(key_code), true);
+    }
+    player.key_down(key_code);
 }
 
 void Game::key_up(WPARAM key_code, LPARAM flags) {
+    if (replaying_input) {
+        return;
+    }
+    if (recording_input) {
+        input_recorder.key(static_cast<unsigned int>(key_code), false);
+    }
     player.key_up(key_code);
 }
 
 void Game::paint() {
+    if (replaying_input && input_replayer.done()) {
+        return;
+    }
+    auto frame_start = std::chrono::high_resolution_clock::now();
+    if (replaying_input) {
+        step_replay();
+    }
 
+    double time = replaying_input ? replay_time : get_time();
 
-    double time = get_time();
-
+    update_hot_reload();
     recalculate_matrix(time);
+    fill_render_queue();
+    report_statistics(time);
 
     HRESULT hr;
 
@@ -394,28 +1434,7 @@ void Game::paint() {
     check_output(m_commandList[m_frameIndex]->Reset(m_commandAllocator[m_frameIndex].Get(),
                                                     m_pipelineState.Get()));
 
-    m_commandList[m_frameIndex]->SetGraphicsRootSignature(m_rootSignature.Get());
-
-    ID3D12DescriptorHeap *pHeaps = const_heaps.get_heap_ptr();
-    m_commandList[m_frameIndex]->SetDescriptorHeaps(1, &pHeaps);
-
-
-    m_commandList[m_frameIndex]->SetGraphicsRootDescriptorTable(0, const_heaps.get_gpu_handle(0));
-
-
-    D3D12_VIEWPORT viewport = {
-        .TopLeftX = 0.0f,
-        .TopLeftY = 0.0f,
-        .Width = static_cast<float>(width),
-        .Height = static_cast<float>(height),
-        .MinDepth = 0.0f,
-        .MaxDepth = 1.0f,
-
-    };
-    D3D12_RECT scissor_rect = {
-        .left = 0, .right = static_cast<LONG>(width), .bottom = static_cast<LONG>(height)};
-    m_commandList[m_frameIndex]->RSSetViewports(1, &viewport);
-    m_commandList[m_frameIndex]->RSSetScissorRects(1, &scissor_rect);
+    set_draw_state(m_commandList[m_frameIndex]);
 
     D3D12_RESOURCE_BARRIER barrier;
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
@@ -427,9 +1446,6 @@ void Game::paint() {
 
     m_commandList[m_frameIndex]->ResourceBarrier(1, &barrier);
 
-    m_commandList[m_frameIndex]->OMSetRenderTargets(1, &m_rtvHandles[m_frameIndex], FALSE,
-                                                    &depth_buffer.get_view());
-
 
     constexpr static FLOAT yellow[4] = {1, 0, 1, 1};
     m_commandList[m_frameIndex]->ClearRenderTargetView(m_rtvHandles[m_frameIndex], yellow, 0,
@@ -440,29 +1456,92 @@ void Game::paint() {
         depth_buffer.get_view(), D3D12_CLEAR_FLAG_STENCIL | D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0,
         nullptr);
 
-    m_commandList[m_frameIndex]->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-
-    for (auto& object : environment_objects) {
-        object.draw(m_commandList[m_frameIndex]);
-    }
-    
-    player.draw(m_commandList[m_frameIndex]);
-
     barrier.Transition.pResource = m_renderTargets[m_frameIndex].Get();
     barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
     barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
     barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
 
-    m_commandList[m_frameIndex]->ResourceBarrier(1, &barrier);
+    std::fill(worker_render_statistics.begin(), worker_render_statistics.end(),
+              Render_queue::statistics_t());
+    // the shadow passes go first, the frame's lists read their maps
+    std::vector<ID3D12CommandList *> command_lists;
+    shadow_maps.record(job_system, m_frameIndex, m_shadowPipelineState.Get(),
+                       [this](ComPtr<ID3D12GraphicsCommandList> &command_list) {
+                           set_shadow_state(command_list);
+                       },
+                       command_lists);
+    command_lists.push_back(m_commandList[m_frameIndex].Get());
+    auto record_start = std::chrono::high_resolution_clock::now();
+
+    if (submission == submission_t::indirect) {
+        indirect_draws.record(m_commandList[m_frameIndex], m_frameIndex, render_queue,
+                              indirect_statistics);
+
+        m_commandList[m_frameIndex]->ResourceBarrier(1, &barrier);
+        shadow_maps.end_frame(m_commandList[m_frameIndex], m_frameIndex);
+
+        check_output(m_commandList[m_frameIndex]->Close());
+    } else if (submission == submission_t::parallel) {
+        check_output(m_commandList[m_frameIndex]->Close());
+
+        parallel_recorder.record(
+            job_system, m_frameIndex, m_pipelineState.Get(),
+            [this](ComPtr<ID3D12GraphicsCommandList> &command_list, unsigned int worker,
+                   unsigned int worker_count) {
+                unsigned int draw_count = render_queue.size();
+                set_draw_state(command_list);
+                render_queue.record(command_list, m_pipelineState.Get(),
+                                    worker * draw_count / worker_count,
+                                    (worker + 1) * draw_count / worker_count,
+                                    worker_render_statistics[worker]);
+            });
+        parallel_recorder.append_command_lists(m_frameIndex, command_lists);
+
+        // the begin list is closed, so the allocator is free for the end list
+        check_output(m_endCommandList[m_frameIndex]->Reset(m_commandAllocator[m_frameIndex].Get(),
+                                                           nullptr));
+        m_endCommandList[m_frameIndex]->ResourceBarrier(1, &barrier);
+        shadow_maps.end_frame(m_endCommandList[m_frameIndex], m_frameIndex);
+        check_output(m_endCommandList[m_frameIndex]->Close());
+        command_lists.push_back(m_endCommandList[m_frameIndex].Get());
+    } else {
+        render_queue.record(m_commandList[m_frameIndex], m_pipelineState.Get(), 0,
+                            render_queue.size(), worker_render_statistics[0]);
+
+        m_commandList[m_frameIndex]->ResourceBarrier(1, &barrier);
+        shadow_maps.end_frame(m_commandList[m_frameIndex], m_frameIndex);
+
+        check_output(m_commandList[m_frameIndex]->Close());
+    }
 
-    check_output(m_commandList[m_frameIndex]->Close());
+    auto record_end = std::chrono::high_resolution_clock::now();
+    recorded_submission = submission;
+    recording_microseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(record_end - record_start).count()
+        / 1'000.0;
+
+    render_statistics = {};
+    for (const Render_queue::statistics_t &statistics : worker_render_statistics) {
+        render_statistics.add(statistics);
+    }
 
-    ID3D12CommandList *ppCommandLists[] = {m_commandList[m_frameIndex].Get()};
-    m_commandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
+    m_commandQueue->ExecuteCommandLists(command_lists.size(), command_lists.data());
 
-    check_output(m_swapChain->Present(1, 0));
+    // replays aren't held to the refresh rate, so that the frame times are the frame's work
+    check_output(m_swapChain->Present(replaying_input ? 0 : 1, 0));
 
     gpu_waiter.wait(m_commandQueue);
+    shadow_maps.finish_frame(m_frameIndex);
 
     m_frameIndex ^= 1;
+
+    if (replaying_input) {
+        auto frame_end = std::chrono::high_resolution_clock::now();
+        replay_frame_milliseconds.push_back(
+            std::chrono::duration<double, std::milli>(frame_end - frame_start).count());
+        if (input_replayer.done()) {
+            report_replay();
+            PostMessage(hwnd, WM_CLOSE, 0, 0);
+        }
+    }
 }
@@ -4,6 +4,7 @@
 #include "Depth_buffer.hpp"
 #include "Vertex_buffer.hpp"
 #include "GPU_waiter.hpp"
+#include "Upload_batch.hpp"
 #include "Const_and_texture_heap.hpp"
 #include "Texture.hpp"
 #include "Texture_loader.hpp"
@@ -11,12 +12,51 @@
 #include "Id_giver.hpp"
 #include "Object.hpp"
 #include "Player.hpp"
+#include "Parallel_recorder.hpp"
+#include "Recording_benchmark.hpp"
+#include "Render_queue.hpp"
+#include "Indirect_draws.hpp"
+#include "Indirect_draws_benchmark.hpp"
+#include "Job_system.hpp"
+#include "Job_system_benchmark.hpp"
+#include "Math_benchmark.hpp"
+#include "Spatial_hash_benchmark.hpp"
+#include "Texture_packer.hpp"
+#include "Texture_packer_benchmark.hpp"
+#include "Texture_streamer.hpp"
+#include "Mip_residency_benchmark.hpp"
+#include "Asset_archive.hpp"
+#include "Asset_cache.hpp"
+#include "Mesh.hpp"
+#include "Mesh_optimizer_benchmark.hpp"
+#include "Meshlet_benchmark.hpp"
+#include "File_watcher.hpp"
+#include "Retired_resources.hpp"
+#include "Input_recording.hpp"
+#include "Affine.hpp"
+#include "Aabb_tree.hpp"
+#include "Aabb_tree_benchmark.hpp"
+#include "Collision_world.hpp"
+#include "Collision_benchmark.hpp"
+#include "Terrain_chunks.hpp"
+#include "Terrain_benchmark.hpp"
+#include "Cell_streamer.hpp"
+#include "World_streaming_benchmark.hpp"
+#include "Scatter_benchmark.hpp"
+#include "Occlusion_buffer.hpp"
+#include "Occlusion_benchmark.hpp"
+#include "Shadow_maps.hpp"
+#include "Shadow_cascades_benchmark.hpp"
 
 
 #include "pixel_shader.h"
 #include "vertex_shader.h"
+#include "shadow_vertex_shader.h"
 
 #include <chrono>
+#include <memory>
+#include <optional>
+#include <set>
 
 
 class Game {
@@ -25,6 +65,8 @@ class Game {
         UINT width = 0, height = 0;
         HWND hwnd = 0;
 
+        Job_system job_system;
+
         constexpr static UINT FrameCount = 2;
 
         ComPtr<ID3D12Device> m_device;
@@ -34,19 +76,71 @@ class Game {
         ComPtr<ID3D12Resource> m_renderTargets[FrameCount];
         ComPtr<ID3D12CommandAllocator> m_commandAllocator[FrameCount];
         ComPtr<ID3D12GraphicsCommandList> m_commandList[FrameCount];
+        // closes the frame after the workers' lists, shares the frame's allocator
+        ComPtr<ID3D12GraphicsCommandList> m_endCommandList[FrameCount];
+
+        // how the main pass is drawn: the whole queue as one ExecuteIndirect, the draws split
+        // between the workers each on its own command list, or all of them on the frame's list,
+        // --submission indirect|parallel|single picks it at the start and SubmissionKey goes
+        // through them in turn
+        enum class submission_t {indirect, parallel, single, count};
+        submission_t submission = submission_t::indirect;
+        // what the last frame was drawn with, for its statistics
+        submission_t recorded_submission = submission_t::indirect;
+        constexpr static WPARAM SubmissionKey = 'I';
+        constexpr static unsigned int MaxRecordingWorkers = 8;
+        // records the last frame's draws many times over
+        constexpr static WPARAM RecordingBenchmarkKey = 'L';
+        constexpr static unsigned int RecordingBenchmarkDraws = 100'000;
+        constexpr static WPARAM BenchmarkKey = VK_F5;
+        constexpr static WPARAM PackerBenchmarkKey = VK_F6;
+        constexpr static WPARAM MathBenchmarkKey = VK_F8;
+        constexpr static unsigned int MathBenchmarkItems = 100'000;
+        constexpr static WPARAM SpatialHashBenchmarkKey = VK_F9;
+        constexpr static unsigned int SpatialHashBenchmarkAgents = 100'000;
+        constexpr static WPARAM AabbTreeBenchmarkKey = VK_F11;
+        constexpr static unsigned int AabbTreeBenchmarkBoxes = 100'000;
+        constexpr static WPARAM CollisionBenchmarkKey = VK_F2;
+        constexpr static unsigned int CollisionBenchmarkAgents = 10'000;
+        constexpr static WPARAM TerrainBenchmarkKey = VK_F3;
+        constexpr static unsigned int TerrainBenchmarkChunks = 1'024;
+        constexpr static WPARAM WorldStreamingBenchmarkKey = VK_F4;
+        constexpr static unsigned int WorldStreamingBenchmarkCells = 1'024;
+        constexpr static unsigned int WorldStreamingBenchmarkFrames = 1'000;
+        constexpr static WPARAM ScatterBenchmarkKey = VK_F1;
+        constexpr static unsigned int ScatterBenchmarkCells = 2'048;
+        // every function key is taken
+        constexpr static WPARAM OcclusionBenchmarkKey = 'O';
+        constexpr static unsigned int OcclusionBenchmarkBoxes = 10'000;
+        constexpr static WPARAM ShadowBenchmarkKey = 'P';
+        constexpr static unsigned int ShadowBenchmarkBoxes = 20'000;
+        constexpr static WPARAM MipResidencyBenchmarkKey = 'R';
+        constexpr static unsigned int MipResidencyBenchmarkTextures = 512;
+        constexpr static WPARAM MeshOptimizerBenchmarkKey = 'V';
+        constexpr static unsigned int MeshOptimizerBenchmarkTriangles = 1'000'000;
+        constexpr static WPARAM MeshletBenchmarkKey = 'M';
+        constexpr static unsigned int MeshletBenchmarkViews = 1'000;
+        constexpr static WPARAM IndirectDrawsBenchmarkKey = 'E';
+        constexpr static unsigned int IndirectDrawsBenchmarkDraws = 100'000;
+        Parallel_recorder parallel_recorder;
+        double recording_microseconds = 0;
 
         Depth_buffer depth_buffer;
 
         ComPtr<ID3D12RootSignature> m_rootSignature;
         ComPtr<ID3D12PipelineState> m_pipelineState;
+        // depth only, from the light
+        ComPtr<ID3D12PipelineState> m_shadowPipelineState;
 
-        enum heap_ids {const_buff, house_tex, person_tex, ground_tex, tree_tex, stone_tex, num};
+        enum heap_ids {const_buff, scene_tex, shadow_tex, num};
         Const_and_texture_heap const_heaps;
 
         Const_buffer matrix_buffer;
 
         GPU_waiter gpu_waiter;
 
+        Upload_batch upload_batch;
+
         UINT m_rtvDescriptorSize;
         UINT m_frameIndex = 0;
 
@@ -60,21 +154,267 @@ class Game {
         Texture_loader texture_loader;
         Texture smile_texture;
 
-        std::map<unsigned int, DirectX::XMMATRIX> obj_id_to_transform;
+        // resources/ packed by the asset packer, the loose files are read when it is missing
+        constexpr static PCWSTR ArchiveFilename = L"resources.pak";
+        Asset_archive asset_archive;
+        Loose_files loose_files;
+        Asset_source *asset_source = &loose_files;
+
+        // decoded images and uploaded meshes, shared by everyone loading the same contents
+        Asset_cache<texture_packer::image_t> image_cache;
+        Asset_cache<Mesh> mesh_cache;
+        constexpr static WPARAM AssetReportKey = VK_F7;
+
+        // the file reads and every cached asset's memory to the debug output
+        void report_assets();
+
+        // every object's image packed into one texture array or atlas, bound once per list
+        enum texture_ids {house_texture, stone_texture, ground_texture, tree_texture,
+                          person_texture, texture_count};
+        constexpr static unsigned int AtlasPadding = 4;
+        constexpr static unsigned int MaxAtlasSize = 16384;
+        constexpr static unsigned int PackerBenchmarkImages = 500;
+        // in the order of texture_ids
+        constexpr static PCWSTR TextureFilenames[] = {
+            LR"(resources/house.png)", LR"(resources/stone.png)", LR"(resources/ground.png)",
+            LR"(resources/tree.png)", Player::texture_filename};
+        // the budget is below what every mip takes so that far textures get evicted
+        constexpr static UINT64 TextureBudget = 16 << 20;
+
+        // everything the scene texture is made of, a reload builds a new one and swaps it whole
+        struct scene_texture_t {
+            public:
+                // what it was packed from, in the order of texture_ids
+                std::vector<Asset_cache<texture_packer::image_t>::handle_t> images;
+                std::vector<texture_packer::placement_t> placements;
+                std::array<unsigned int, 2> size = {};
+                // the finer mips are streamed in when tiled resources allow it
+                bool streaming = false;
+                Texture texture;
+                std::unique_ptr<Texture_streamer> streamer;
+        };
+        scene_texture_t scene_texture;
+        // of every environment object
+        std::vector<texture_ids> environment_textures;
+        std::vector<PCWSTR> environment_filenames;
+
+        // decodes the images through image_cache and packs them, the view is written to
+        // cpu_handle and the uploads wait for batch to be flushed, may run on a worker
+        scene_texture_t load_scene_texture(Upload_batch &batch,
+                                           const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle);
+
+        // asks for mips by each object's size on screen seen from the player
+        void stream_textures(const math::matrix &proj);
+
+        // every off group's world transform
+        std::map<unsigned int, math::affine> obj_id_to_transform;
         std::vector<Object> environment_objects;
 
         void init_environment_objects();
 
+        // what the shader places a group with, the identity for groups without a transform
+        math::affine get_group_transform(unsigned int id);
+
+        // a box for every group of every environment object, placed by the group's transform
+        constexpr static float SceneTreeMargin = 0.1f;
+        Aabb_tree scene_tree;
+        // the environment object of every item
+        std::vector<unsigned int> scene_item_objects;
+        std::vector<unsigned int> scene_query_results;
+        // the objects with a group in the view, the others aren't drawn
+        std::vector<bool> visible_objects;
+        // how far the camera stays in front of the boxes behind the player
+        constexpr static float CameraCollisionMargin = 0.2f;
+
+        // after the objects are placed or their meshes change
+        void build_scene_tree();
+
+        // the houses nearest the camera drawn into a small depth buffer on the CPU, the objects
+        // and cells wholly behind them aren't drawn
+        constexpr static unsigned int OcclusionWidth = 256;
+        constexpr static unsigned int OcclusionHeight = 128;
+        constexpr static unsigned int MaxOccluders = 8;
+        Occlusion_buffer occlusion_buffer;
+        std::vector<math::affine> occluder_transforms;
+
+        // view_proj is untransposed
+        void draw_occluders(const math::matrix &view_proj);
+
+        // view_proj is untransposed, draws the occluders first
+        void cull_objects(const math::matrix &view_proj);
+
+        // pulls the camera in front of the first box between it and the player
+        void collide_camera();
+
+        // the environment objects' walls the player walks into, what lies between the step
+        // height and the head height
+        constexpr static float CollisionStepHeight = 0.3f;
+        constexpr static float CollisionHeadHeight = 2.0f;
+        Collision_world collision_world;
+
+        // after the objects are placed or their meshes change
+        void build_collision_world();
+
+        // the ground, drawn with the ground's image under the terrain.off group
+        Terrain_chunks terrain_chunks;
+
+        // the props of the world's cells around the player, drawn under the cells.off group
+        Cell_streamer cell_streamer;
+        // world_cells' kinds by the image of the environment object showing them
+        constexpr static texture_ids PropTextures[world_cells::kind_count] = {
+            texture_ids::house_texture, texture_ids::stone_texture, texture_ids::tree_texture};
+
+        // the environment objects' meshes in the order of world_cells' kinds
+        std::vector<Asset_cache<Mesh>::handle_t> get_prop_meshes();
+
+        // the cells' props keep this far off the hand placed objects, further off the house,
+        // and off where the player starts
+        constexpr static float ScatterClearance = 1.0f;
+        constexpr static float HouseYardRadius = 4.0f;
+        constexpr static float PlayerStartClearance = 2.0f;
+
+        // the circles the cells place nothing in, after the environment objects are placed
+        std::vector<scatter::circle_t> get_scatter_exclusions();
+
         Id_giver object_id_giver;
 
         Player player;
 
+        // while the assets come from loose files, resources/ is watched and the changed files
+        // are loaded on the job system, then swapped in together at the start of a frame
+        struct reload_t {
+            public:
+                bool images_changed = false;
+                // the environment objects then the player
+                std::vector<bool> changed_meshes;
+                // null when no image changed
+                std::unique_ptr<scene_texture_t> scene_texture;
+                // empty for the meshes that are kept
+                std::vector<std::optional<Object::loaded_mesh_t>> meshes;
+                // object_id_giver as the reload started, the meshes' new groups get their ids
+                // here and it replaces object_id_giver only when the reload is applied
+                Id_giver id_giver;
+                Job_counter counter;
+        };
+        constexpr static PCWSTR ResourceDirectory = L"resources";
+        File_watcher resource_watcher;
+        bool watching_resources = false;
+        std::set<std::filesystem::path> changed_files;
+        std::unique_ptr<reload_t> reload;
+        // the reload's own uploads, and where its scene texture's view waits to be copied
+        // into the heap
+        Upload_batch reload_upload_batch;
+        ComPtr<ID3D12DescriptorHeap> reload_descriptor_heap;
+        Retired_resources retired_resources;
+
+        void init_hot_reload();
+
+        // applies a finished reload and starts the next, call it before the frame's work
+        void update_hot_reload();
+
+        void start_reload();
+
+        // runs on the job system, builds everything apply_reload() swaps in
+        void load_reload(reload_t &loading);
+
+        void apply_reload();
+
+        // the player moves in steps of SimulationStep, as many as the frames' time adds up to
+        // but no more than MaxSimulationLag behind, so a recording has the same steps wherever
+        // it was made
+        constexpr static float SimulationStep = 1.0f / 120;
+        constexpr static double MaxSimulationLag = 0.25;
+        double unsimulated_time = 0;
+
+        // --record <file> writes the player's keys and update steps to file when the game closes,
+        // --replay <file> plays them back one step a frame in place of the live keys, then quits
+        // with the frame times, with --headless the steps run without rendering
+        Input_recorder input_recorder;
+        std::filesystem::path input_recording_path;
+        bool recording_input = false;
+        Input_replayer input_replayer;
+        bool replaying_input = false;
+        bool headless_replay = false;
+        // the sum of the replayed steps, stands in for the clock
+        double replay_time = 0;
+        std::vector<double> replay_frame_milliseconds;
+
+        // reads the options above and --submission from the command line
+        void init_input_replay();
+
+        // feeds the next step's keys and delta time to the player
+        void step_replay();
+
+        // the whole replay's CPU frame work without drawing, called at the end of init()
+        void run_headless_replay();
+
+        // frame times and where the player ended, to compare runs of the same recording
+        void report_replay();
+
+        // the projection's depth range
+        constexpr static float NearPlane = 0.1f;
+        constexpr static float FarPlane = 100.0f;
+        // towards the light, like the shaders' dirLight
+        constexpr static math::float4 LightDirection = {1.0f, 1.0f, 1.0f, 0.0f};
+
+        // the directional light's shadows out to ShadowDistance, the cascades split
+        // ShadowSplitLambda of the way from the uniform splits to the logarithmic ones, and
+        // their passes held to ShadowBudget of the GPU's frame time
+        constexpr static unsigned int ShadowMapSize = 1024;
+        constexpr static float ShadowDistance = 60.0f;
+        constexpr static float ShadowSplitLambda = 0.8f;
+        constexpr static double ShadowBudget = 0.25;
+        // on top of the pixel shader's push along the normal
+        constexpr static INT ShadowDepthBias = 64;
+        constexpr static float ShadowSlopeScaledDepthBias = 2.0f;
+        Shadow_maps shadow_maps;
+        // by cascade, so they are culled at the same time
+        std::vector<std::vector<unsigned int>> shadow_query_results;
+        std::vector<std::vector<bool>> shadow_casting_objects;
+        double shadow_cull_microseconds = 0;
+
+        // culls every cascade redrawn this frame's casters into its queue, on the job system
+        void fill_shadow_queues();
+
         double get_delta_time();
 
         double get_time();
 
         void recalculate_matrix(double angle);
 
+        // proj is the untransposed projection matrix
+        void select_lods(const math::matrix &proj);
+
+        meshlet::cull_statistics meshlet_statistics;
+        double last_report_time = 0;
+
+        void cull_meshlets(const math::matrix &proj);
+
+        // writes the last frame's statistics to the debug output about once a second
+        void report_statistics(double time);
+
+        // the state every command list needs before drawing
+        void set_draw_state(ComPtr<ID3D12GraphicsCommandList> &command_list);
+
+        // what the shadow passes' lists share, Shadow_maps sets the rest
+        void set_shadow_state(ComPtr<ID3D12GraphicsCommandList> &command_list);
+
+        // most draws a frame can have, every object, the terrain's chunks, the cells and the
+        // player
+        unsigned int get_draw_count();
+
+        // the one instance of every draw that has no instances of its own
+        Vertex_buffer identity_instance;
+        Render_queue render_queue;
+        // one per recording worker, summed for the report
+        std::vector<Render_queue::statistics_t> worker_render_statistics;
+        Render_queue::statistics_t render_statistics;
+
+        void fill_render_queue();
+
+        Indirect_draws indirect_draws;
+        Indirect_draws::statistics_t indirect_statistics;
+
         void set_root_signature();
 
         void create_graphics_pipeline_state();
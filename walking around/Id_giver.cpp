@@ -1,9 +1,28 @@
 #include "Id_giver.hpp"
 
+Id_giver::Id_giver(const Id_giver &other) {
+    *this = other;
+}
+
+Id_giver &Id_giver::operator=(const Id_giver &other) {
+    if (this != &other) {
+        std::scoped_lock lock(mutex, other.mutex);
+        given_id = other.given_id;
+        str_to_id = other.str_to_id;
+    }
+    return *this;
+}
+
 unsigned int Id_giver::get_id(const std::string &str) {
+    std::lock_guard<std::mutex> lock(mutex);
     auto found = str_to_id.find(str);
     if (found == str_to_id.end()) {
         return (str_to_id[str] = given_id++);
     }
     return found->second;
-}
\ No newline at end of file
+}
+
+unsigned int Id_giver::get_count() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return given_id;
+}
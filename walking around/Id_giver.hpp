@@ -1,21 +1,33 @@
 #pragma once
 #include "Windows_includes.hpp"
 #include <map>
+#include <mutex>
 #include <string>
 
 #include <sstream>
 
+// the same name always gets the same id, meshes loading on other threads may ask too
 class Id_giver {
     private:
         unsigned int given_id = 0;
         std::map<std::string, unsigned int> str_to_id;
+        mutable std::mutex mutex;
 
     public:
+        Id_giver() = default;
+        // the copy knows the same names and gives its new ids on its own
+        Id_giver(const Id_giver &other);
+        Id_giver &operator=(const Id_giver &other);
+
         unsigned int get_id(const std::string &str);
 
+        // how many ids were given, they are below it
+        unsigned int get_count();
+
         constexpr static unsigned int no_id = (std::numeric_limits<unsigned int>::max)();
 
         void write() {
+            std::lock_guard<std::mutex> lock(mutex);
             std::stringstream s;
             s << "--------IDs:\n";
             for (auto [a, b] : str_to_id) {
@@ -0,0 +1,94 @@
+#pragma once
+#include "Windows_includes.hpp"
+
+#include "Utility.hpp"
+#include "Upload_batch.hpp"
+#include <vector>
+
+class Index_buffer {
+    private:
+        ComPtr<ID3D12Resource> m_indexBuffer;
+        D3D12_INDEX_BUFFER_VIEW m_indexBufferView;
+        unsigned int m_index_count = 0;
+
+        UINT *m_mapped_indices = nullptr;
+
+        void create_resource(ComPtr<ID3D12Device> &device, D3D12_HEAP_TYPE heap_type,
+                             unsigned int data_size, D3D12_RESOURCE_STATES initial_state) {
+            D3D12_HEAP_PROPERTIES heapProps = {
+                .Type = heap_type,
+                .CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
+                .MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
+                .CreationNodeMask = 1,
+                .VisibleNodeMask = 1,
+            };
+
+            D3D12_RESOURCE_DESC desc = {
+                .Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+                .Alignment = 0,
+                .Width = data_size,
+                .Height = 1,
+                .DepthOrArraySize = 1,
+                .MipLevels = 1,
+                .Format = DXGI_FORMAT_UNKNOWN,
+                .SampleDesc = {.Count = 1, .Quality = 0},
+                .Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                .Flags = D3D12_RESOURCE_FLAG_NONE
+            };
+
+            check_output(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc,
+                                                         initial_state, nullptr,
+                                                         IID_PPV_ARGS(&m_indexBuffer)));
+
+            m_indexBufferView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress();
+            m_indexBufferView.Format = DXGI_FORMAT_R32_UINT;
+            m_indexBufferView.SizeInBytes = data_size;
+        }
+
+    public:
+        // can be drawn after upload_batch is flushed
+        void init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                  const std::vector<UINT> &index_data) {
+            m_index_count = index_data.size();
+            unsigned int data_size = sizeof(UINT) * m_index_count;
+
+            create_resource(device, D3D12_HEAP_TYPE_DEFAULT, data_size,
+                            D3D12_RESOURCE_STATE_COPY_DEST);
+            upload_batch.upload_buffer(m_indexBuffer.Get(), index_data.data(), data_size,
+                                       D3D12_RESOURCE_STATE_INDEX_BUFFER);
+        }
+
+        // rewritten by the CPU every frame through data(), stays mapped in the upload heap
+        void init_dynamic(ComPtr<ID3D12Device> &device, unsigned int max_index_count) {
+            m_index_count = 0;
+            unsigned int data_size = sizeof(UINT) * max_index_count;
+
+            create_resource(device, D3D12_HEAP_TYPE_UPLOAD, data_size,
+                            D3D12_RESOURCE_STATE_GENERIC_READ);
+
+            D3D12_RANGE zero_range = {.Begin = 0, .End = 0};
+            check_output(m_indexBuffer->Map(0, &zero_range,
+                                            reinterpret_cast<void **>(&m_mapped_indices)));
+        }
+
+        // only for buffers made with init_dynamic
+        UINT *data() {
+            return m_mapped_indices;
+        }
+
+        void set_index_count(unsigned int index_count) {
+            m_index_count = index_count;
+        }
+
+        D3D12_INDEX_BUFFER_VIEW &get_view() {
+            return m_indexBufferView;
+        }
+
+        const D3D12_INDEX_BUFFER_VIEW &get_view() const {
+            return m_indexBufferView;
+        }
+
+        unsigned int get_index_count() {
+            return m_index_count;
+        }
+};
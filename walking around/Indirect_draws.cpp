@@ -0,0 +1,131 @@
+#include "Indirect_draws.hpp"
+#include "Utility.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+
+// the signature reads the arguments back to back, so there must be no padding between them
+#ifdef PACKED_VERTICES
+static_assert(offsetof(Indirect_draws::command_t, vertex_buffer) == sizeof(mesh_bounds_t));
+#endif
+static_assert(offsetof(Indirect_draws::command_t, index_buffer)
+              == offsetof(Indirect_draws::command_t, vertex_buffer)
+                     + 2 * sizeof(D3D12_VERTEX_BUFFER_VIEW));
+static_assert(offsetof(Indirect_draws::command_t, draw)
+              == offsetof(Indirect_draws::command_t, index_buffer)
+                     + sizeof(D3D12_INDEX_BUFFER_VIEW));
+
+void Indirect_draws::build_commands(Render_queue &render_queue,
+                                    std::vector<command_t> &commands) {
+    commands.resize(render_queue.size());
+    for (unsigned int i = 0; i < render_queue.size(); i++) {
+        const Render_queue::draw_t &draw = render_queue.get_sorted_draw(i);
+        command_t &command = commands[i];
+
+#ifdef PACKED_VERTICES
+        command.bounds = {};
+        std::memcpy(&command.bounds, draw.root_constants,
+                    (std::min)(static_cast<UINT64>(draw.root_constant_count) * 4,
+                               static_cast<UINT64>(sizeof(command.bounds))));
+#endif
+        command.vertex_buffer = *draw.vertex_buffer;
+        command.instance_buffer = *draw.instance_buffer;
+        command.index_buffer = *draw.index_buffer;
+        command.draw = {.IndexCountPerInstance = draw.index_count,
+                        .InstanceCount = draw.instance_count,
+                        .StartIndexLocation = draw.first_index,
+                        .BaseVertexLocation = 0,
+                        .StartInstanceLocation = 0};
+    }
+}
+
+void Indirect_draws::init(ComPtr<ID3D12Device> &device,
+                          ComPtr<ID3D12RootSignature> &root_signature, unsigned int frame_count,
+                          unsigned int _max_commands) {
+    max_commands = _max_commands;
+
+    std::vector<D3D12_INDIRECT_ARGUMENT_DESC> arguments;
+    D3D12_INDIRECT_ARGUMENT_DESC argument = {};
+    // a signature that sets no root arguments mustn't name the root signature
+    ID3D12RootSignature *arguments_root_signature = nullptr;
+#ifdef PACKED_VERTICES
+    argument.Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+    argument.Constant = {.RootParameterIndex = Render_queue::root_constants_argument,
+                         .DestOffsetIn32BitValues = 0,
+                         .Num32BitValuesToSet = sizeof(mesh_bounds_t) / 4};
+    arguments.push_back(argument);
+    arguments_root_signature = root_signature.Get();
+#endif
+    argument = {};
+    argument.Type = D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW;
+    argument.VertexBuffer.Slot = 0;
+    arguments.push_back(argument);
+    argument.VertexBuffer.Slot = 1;
+    arguments.push_back(argument);
+    argument = {};
+    argument.Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+    arguments.push_back(argument);
+    argument = {};
+    argument.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+    arguments.push_back(argument);
+
+    D3D12_COMMAND_SIGNATURE_DESC signature_desc = {
+        .ByteStride = sizeof(command_t),
+        .NumArgumentDescs = static_cast<UINT>(arguments.size()),
+        .pArgumentDescs = arguments.data(),
+        .NodeMask = 0};
+    check_output(device->CreateCommandSignature(&signature_desc, arguments_root_signature,
+                                                IID_PPV_ARGS(&command_signature)));
+
+    D3D12_HEAP_PROPERTIES heap_properties = {.Type = D3D12_HEAP_TYPE_UPLOAD,
+                                             .CPUPageProperty =
+                                                 D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
+                                             .MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
+                                             .CreationNodeMask = 1,
+                                             .VisibleNodeMask = 1};
+    D3D12_RESOURCE_DESC resource_desc = {.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+                                         .Alignment = 0,
+                                         .Width = max_commands * sizeof(command_t),
+                                         .Height = 1,
+                                         .DepthOrArraySize = 1,
+                                         .MipLevels = 1,
+                                         .Format = DXGI_FORMAT_UNKNOWN,
+                                         .SampleDesc = {.Count = 1, .Quality = 0},
+                                         .Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                         .Flags = D3D12_RESOURCE_FLAG_NONE};
+
+    argument_buffers.resize(frame_count);
+    mapped_arguments.resize(frame_count);
+    for (unsigned int i = 0; i < frame_count; i++) {
+        check_output(device->CreateCommittedResource(
+            &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc,
+            D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&argument_buffers[i])));
+
+        D3D12_RANGE read_range = {0, 0};
+        check_output(argument_buffers[i]->Map(
+            0, &read_range, reinterpret_cast<void **>(&mapped_arguments[i])));
+    }
+}
+
+void Indirect_draws::record(ComPtr<ID3D12GraphicsCommandList> &command_list,
+                            unsigned int frame_index, Render_queue &render_queue,
+                            statistics_t &statistics) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+
+    build_commands(render_queue, commands);
+    UINT command_count = (std::min)(static_cast<unsigned int>(commands.size()), max_commands);
+    std::memcpy(mapped_arguments[frame_index], commands.data(), command_count * sizeof(command_t));
+
+    auto end_point = std::chrono::high_resolution_clock::now();
+    statistics.commands = command_count;
+    statistics.build_microseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+        / 1'000.0;
+
+    if (command_count > 0) {
+        command_list->ExecuteIndirect(command_signature.Get(), command_count,
+                                      argument_buffers[frame_index].Get(), 0, nullptr, 0);
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "Windows_includes.hpp"
+#include "Render_queue.hpp"
+#include "Vertex.hpp"
+
+#include <vector>
+
+// draws the whole render queue with one ExecuteIndirect, the arguments are built on the CPU
+class Indirect_draws {
+    public:
+        // one command of the signature, the arguments follow each other without padding
+        struct command_t {
+            public:
+#ifdef PACKED_VERTICES
+                mesh_bounds_t bounds;
+#endif
+                D3D12_VERTEX_BUFFER_VIEW vertex_buffer;
+                D3D12_VERTEX_BUFFER_VIEW instance_buffer;
+                D3D12_INDEX_BUFFER_VIEW index_buffer;
+                D3D12_DRAW_INDEXED_ARGUMENTS draw;
+        };
+
+        struct statistics_t {
+            public:
+                unsigned int commands = 0;
+                double build_microseconds = 0;
+        };
+
+    private:
+        ComPtr<ID3D12CommandSignature> command_signature;
+
+        // one persistently mapped upload buffer per frame
+        std::vector<ComPtr<ID3D12Resource>> argument_buffers;
+        std::vector<command_t *> mapped_arguments;
+        unsigned int max_commands = 0;
+
+        std::vector<command_t> commands;
+
+    public:
+        // every draw must use the texture the list has bound
+        static void build_commands(Render_queue &render_queue, std::vector<command_t> &commands);
+
+        void init(ComPtr<ID3D12Device> &device, ComPtr<ID3D12RootSignature> &root_signature,
+                  unsigned int frame_count, unsigned int max_commands);
+
+        // the list must have the root signature and the frame's shared state set
+        void record(ComPtr<ID3D12GraphicsCommandList> &command_list, unsigned int frame_index,
+                    Render_queue &render_queue, statistics_t &statistics);
+};
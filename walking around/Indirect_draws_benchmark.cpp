@@ -0,0 +1,166 @@
+#include "Indirect_draws_benchmark.hpp"
+#include "Indirect_draws.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int buffer_count = 16;
+constexpr UINT buffer_indices = 1 << 16;
+constexpr UINT max_draw_triangles = 512;
+constexpr UINT max_instances = 64;
+constexpr float max_depth = 100;
+
+double microseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end_point - start_point).count();
+}
+
+// what the queue gives draws without instances
+D3D12_VERTEX_BUFFER_VIEW identity_instance = {UINT64(1) << 40, 48, 48};
+
+bool same_views(const Indirect_draws::command_t &command, const Render_queue::draw_t &draw) {
+    const D3D12_VERTEX_BUFFER_VIEW *instance_buffer =
+        draw.instance_buffer ? draw.instance_buffer : &identity_instance;
+    return std::memcmp(&command.vertex_buffer, draw.vertex_buffer, sizeof(command.vertex_buffer))
+               == 0
+           && std::memcmp(&command.instance_buffer, instance_buffer,
+                          sizeof(command.instance_buffer))
+                  == 0
+           && std::memcmp(&command.index_buffer, draw.index_buffer, sizeof(command.index_buffer))
+                  == 0;
+}
+
+bool same_range(const Indirect_draws::command_t &command, const Render_queue::draw_t &draw) {
+    UINT instance_count = draw.instance_buffer ? draw.instance_count : 1;
+    return command.draw.IndexCountPerInstance == draw.index_count
+           && command.draw.StartIndexLocation == draw.first_index
+           && command.draw.InstanceCount == instance_count
+           && command.draw.BaseVertexLocation == 0 && command.draw.StartInstanceLocation == 0;
+}
+} // namespace
+
+std::string benchmark_indirect_draws(unsigned int draw_count) {
+    // at addresses that only need to differ, the draws are never executed
+    std::vector<D3D12_VERTEX_BUFFER_VIEW> vertex_buffers, instance_buffers;
+    std::vector<D3D12_INDEX_BUFFER_VIEW> index_buffers;
+    std::vector<mesh_bounds_t> bounds;
+    for (unsigned int i = 0; i < buffer_count; i++) {
+        D3D12_GPU_VIRTUAL_ADDRESS address = (i + 1) * (UINT64(1) << 24);
+        vertex_buffers.push_back({address, buffer_indices * 16, 16});
+        index_buffers.push_back(
+            {address + (UINT64(1) << 23), buffer_indices * 4, DXGI_FORMAT_R32_UINT});
+        instance_buffers.push_back({address + (UINT64(1) << 22), max_instances * 48, 48});
+        float f = static_cast<float>(i);
+        bounds.push_back({{f, -f, f, 0}, {1 + f, 2 + f, 3 + f, 0}});
+    }
+
+    // one pipeline and texture, like the main pass
+    ID3D12PipelineState *pipeline_state = reinterpret_cast<ID3D12PipelineState *>(UINT64(64));
+    D3D12_GPU_DESCRIPTOR_HANDLE texture = {128};
+    std::mt19937 generator(13);
+    std::uniform_int_distribution<unsigned int> pick(0, buffer_count - 1);
+    std::uniform_int_distribution<UINT> triangles(1, max_draw_triangles);
+    std::uniform_real_distribution<float> depth(0, max_depth);
+    std::uniform_int_distribution<UINT> instances(1, max_instances);
+    std::vector<Render_queue::draw_t> draws;
+    std::vector<UINT64> keys;
+    // the queue numbers the vertex buffers as it first sees them
+    std::vector<int> buffer_ids(buffer_count, -1);
+    int next_id = 0;
+    Render_queue queue;
+    queue.init(identity_instance);
+    for (unsigned int i = 0; i < draw_count; i++) {
+        unsigned int buffer = pick(generator);
+        UINT index_count = 3 * triangles(generator);
+        UINT first_index =
+            3 * std::uniform_int_distribution<UINT>(0, (buffer_indices - index_count) / 3)(
+                    generator);
+        float draw_depth = depth(generator);
+        draws.push_back({.pipeline_state = pipeline_state,
+                         .texture = texture,
+                         .vertex_buffer = &vertex_buffers[buffer],
+                         .index_buffer = &index_buffers[buffer],
+                         .root_constants = &bounds[buffer],
+                         .root_constant_count = sizeof(mesh_bounds_t) / 4,
+                         .index_count = index_count,
+                         .first_index = first_index,
+                         .instance_buffer = i % 2 ? &instance_buffers[buffer] : nullptr,
+                         .instance_count = i % 2 ? instances(generator) : 0});
+        queue.submit(draws.back(), draw_depth);
+        if (buffer_ids[buffer] < 0) {
+            buffer_ids[buffer] = next_id++;
+        }
+        keys.push_back(Render_queue::make_key(0, 0, buffer_ids[buffer], draw_depth));
+    }
+    queue.sort();
+
+    // the order the commands should come in, ties in submission order
+    std::vector<unsigned int> order(draw_count);
+    for (unsigned int i = 0; i < draw_count; i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](unsigned int a, unsigned int b) { return keys[a] < keys[b]; });
+
+    // timed the second time, when the commands fit, as from frame to frame
+    std::vector<Indirect_draws::command_t> commands;
+    Indirect_draws::build_commands(queue, commands);
+    auto start_point = std::chrono::high_resolution_clock::now();
+    Indirect_draws::build_commands(queue, commands);
+    double build_microseconds = microseconds_since(start_point);
+
+    // the signature reads its arguments back to back from the start of the stride
+    using command_t = Indirect_draws::command_t;
+    std::size_t argument_size = 2 * sizeof(D3D12_VERTEX_BUFFER_VIEW)
+                                + sizeof(D3D12_INDEX_BUFFER_VIEW)
+                                + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
+    std::size_t vertex_buffer_start = 0;
+#ifdef PACKED_VERTICES
+    argument_size += sizeof(mesh_bounds_t);
+    vertex_buffer_start = sizeof(mesh_bounds_t);
+#endif
+    std::size_t gaps =
+        (offsetof(command_t, vertex_buffer) - vertex_buffer_start)
+        + (offsetof(command_t, instance_buffer) - offsetof(command_t, vertex_buffer)
+           - sizeof(D3D12_VERTEX_BUFFER_VIEW))
+        + (offsetof(command_t, index_buffer) - offsetof(command_t, instance_buffer)
+           - sizeof(D3D12_VERTEX_BUFFER_VIEW))
+        + (offsetof(command_t, draw) - offsetof(command_t, index_buffer)
+           - sizeof(D3D12_INDEX_BUFFER_VIEW));
+
+    unsigned int out_of_order = 0, other_views = 0, other_bounds = 0, other_ranges = 0;
+    unsigned int past_end = 0;
+    unsigned int command_count = static_cast<unsigned int>(commands.size());
+    for (unsigned int i = 0; i < (std::min)(command_count, draw_count); i++) {
+        const Indirect_draws::command_t &command = commands[i];
+        const Render_queue::draw_t &expected = draws[order[i]];
+        out_of_order += !same_views(command, expected) || !same_range(command, expected);
+
+        const Render_queue::draw_t &draw = queue.get_sorted_draw(i);
+        other_views += !same_views(command, draw);
+#ifdef PACKED_VERTICES
+        other_bounds +=
+            std::memcmp(&command.bounds, draw.root_constants, sizeof(mesh_bounds_t)) != 0;
+#endif
+        other_ranges += !same_range(command, draw);
+        UINT index_size = command.index_buffer.Format == DXGI_FORMAT_R32_UINT ? 4 : 2;
+        past_end += UINT64(command.draw.StartIndexLocation) + command.draw.IndexCountPerInstance
+                    > command.index_buffer.SizeInBytes / index_size;
+    }
+
+    std::stringstream s;
+    s << "indirect draws: " << command_count << " commands for " << draw_count
+      << " draws built in " << build_microseconds << " us, a stride of " << sizeof(command_t)
+      << " bytes for " << argument_size << " bytes of arguments with " << gaps
+      << " bytes between them\n";
+    s << "indirect draws: " << out_of_order << " out of the queue's order, " << other_views
+      << " with other views, " << other_bounds << " with other bounds, " << other_ranges
+      << " with other index ranges, " << past_end << " past the end of their index buffer\n";
+    return s.str();
+}
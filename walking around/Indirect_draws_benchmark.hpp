@@ -0,0 +1,10 @@
+#pragma once
+#include <string>
+
+// draw_count made up draws over a few vertex and index buffers at random depths, every other
+// one with instances and the rest with the queue's identity instance, sorted in a Render_queue
+// and turned into ExecuteIndirect arguments by Indirect_draws::build_commands with no device:
+// how long the build takes, the command's stride against its arguments' sizes and the padding
+// between them, then the commands out of the queue's order, with other views, bounds or index
+// ranges than their draws, or past the end of their index buffers, one line each
+std::string benchmark_indirect_draws(unsigned int draw_count);
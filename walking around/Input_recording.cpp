@@ -0,0 +1,100 @@
+#include "Input_recording.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+using namespace input_recording;
+
+void Input_recorder::init(float _step_seconds) {
+    step_seconds = _step_seconds;
+    step_count = 0;
+    events.clear();
+}
+
+void Input_recorder::key(unsigned int key_code, bool down) {
+    events.push_back({.step = step_count,
+                      .key = static_cast<std::uint16_t>(key_code),
+                      .down = static_cast<std::uint8_t>(down),
+                      .padding = 0});
+}
+
+void Input_recorder::step() {
+    step_count++;
+}
+
+unsigned int Input_recorder::get_step_count() const {
+    return step_count;
+}
+
+void Input_recorder::write(const std::filesystem::path &path) const {
+    header_t header = {.magic = {},
+                       .version = version,
+                       .step_count = step_count,
+                       .event_count = static_cast<std::uint32_t>(events.size()),
+                       .step_seconds = step_seconds};
+    std::memcpy(header.magic, magic, sizeof(magic));
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("can't create " + path.string());
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(events.data()), events.size() * sizeof(event_t));
+    if (!file) {
+        throw std::runtime_error("can't write " + path.string());
+    }
+}
+
+void Input_replayer::init(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("can't open " + path.string());
+    }
+    header_t header;
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))
+        || std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+        throw std::runtime_error(path.string() + " isn't an input recording");
+    }
+    if (header.version != version) {
+        throw std::runtime_error(path.string() + " isn't of a known version");
+    }
+    if (!(header.step_seconds > 0)) {
+        throw std::runtime_error(path.string() + " has no step length");
+    }
+
+    step_seconds = header.step_seconds;
+    step_count = header.step_count;
+    events.resize(header.event_count);
+    file.read(reinterpret_cast<char *>(events.data()), events.size() * sizeof(event_t));
+    if (!file) {
+        throw std::runtime_error(path.string() + " is cut off");
+    }
+    for (std::size_t i = 0; i < events.size(); i++) {
+        if (events[i].step > header.step_count || (i > 0 && events[i].step < events[i - 1].step)) {
+            throw std::runtime_error(path.string() + " has events out of order");
+        }
+    }
+    next_step = 0;
+    next_event = 0;
+}
+
+bool Input_replayer::done() const {
+    return next_step == step_count;
+}
+
+step_t Input_replayer::next() {
+    std::size_t first_event = next_event;
+    while (next_event < events.size() && events[next_event].step == next_step) {
+        next_event++;
+    }
+    step_t step = {.events = std::span<const event_t>(events).subspan(first_event,
+                                                                       next_event - first_event),
+                   .delta_time = step_seconds};
+    next_step++;
+    return step;
+}
+
+unsigned int Input_replayer::get_step_count() const {
+    return step_count;
+}
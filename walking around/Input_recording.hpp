@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+// the player's keys and the count of fixed update steps they came between, so that a run can be
+// played again exactly on any machine, the same steps with the same keys give the same player
+// every time
+//
+// layout: header_t, then the events in step order
+namespace input_recording {
+
+constexpr char magic[4] = {'W', 'A', 'I', 'R'};
+constexpr std::uint32_t version = 2;
+
+struct header_t {
+    public:
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t step_count;
+        std::uint32_t event_count;
+        float step_seconds; // every step's length
+};
+
+struct event_t {
+    public:
+        std::uint32_t step; // the event happened before this step
+        std::uint16_t key;  // virtual key code
+        std::uint8_t down;
+        std::uint8_t padding;
+};
+
+// one update() step of a replay, its events go to the player before the update
+struct step_t {
+    public:
+        std::span<const event_t> events;
+        float delta_time;
+};
+
+} // namespace input_recording
+
+class Input_recorder {
+    private:
+        float step_seconds = 0;
+        std::uint32_t step_count = 0;
+        std::vector<input_recording::event_t> events;
+
+    public:
+        void init(float _step_seconds);
+
+        void key(unsigned int key_code, bool down);
+
+        // one more step of step_seconds, after the keys so far
+        void step();
+
+        unsigned int get_step_count() const;
+
+        void write(const std::filesystem::path &path) const;
+};
+
+class Input_replayer {
+    private:
+        float step_seconds = 0;
+        std::uint32_t step_count = 0;
+        std::vector<input_recording::event_t> events;
+        unsigned int next_step = 0;
+        std::size_t next_event = 0;
+
+    public:
+        void init(const std::filesystem::path &path);
+
+        bool done() const;
+
+        // call only while !done()
+        input_recording::step_t next();
+
+        unsigned int get_step_count() const;
+};
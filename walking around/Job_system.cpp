@@ -0,0 +1,220 @@
+#include "Job_system.hpp"
+
+#include <algorithm>
+
+namespace {
+// the pool the current thread works for and its index there
+thread_local const void *current_system = nullptr;
+thread_local int current_worker = -1;
+
+// picks the first victim to steal from
+thread_local unsigned int random_state = 0x9e3779b9u;
+
+unsigned int next_random() {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+} // namespace
+
+bool Job_counter::done() const {
+    return pending.load() == 0;
+}
+
+int Job_system::get_worker_index() {
+    return current_system == this ? current_worker : -1;
+}
+
+void Job_system::push(job_t *job) {
+    int worker = get_worker_index();
+    if (worker < 0 || !deques[worker]->push(job)) {
+        std::lock_guard lock(injected_mutex);
+        injected.push_back(job);
+    }
+
+    queued_jobs++;
+    if (sleeping_workers.load() > 0) {
+        std::lock_guard lock(sleep_mutex);
+        wake_condition.notify_one();
+    }
+}
+
+job_t *Job_system::find_job(int worker) {
+    job_t *job = worker >= 0 ? deques[worker]->pop() : nullptr;
+
+    if (!job) {
+        std::lock_guard lock(injected_mutex);
+        if (!injected.empty()) {
+            job = injected.front();
+            injected.pop_front();
+        }
+    }
+
+    unsigned int deque_count = deques.size();
+    unsigned int first_victim = next_random();
+    for (unsigned int i = 0; !job && i < deque_count; i++) {
+        unsigned int victim = (first_victim + i) % deque_count;
+        if (static_cast<int>(victim) != worker) {
+            job = deques[victim]->steal();
+        }
+    }
+
+    if (job) {
+        queued_jobs--;
+    }
+    return job;
+}
+
+void Job_system::execute(job_t *job) {
+    Job_counter &counter = *job->counter;
+    try {
+        job->function();
+    } catch (...) {
+        std::lock_guard lock(counter.mutex);
+        if (!counter.exception) {
+            counter.exception = std::current_exception();
+        }
+    }
+    delete job;
+
+    // under the lock, so a waiter can't destroy the counter while it's still used here
+    std::vector<job_t *> ready;
+    {
+        std::lock_guard lock(counter.mutex);
+        if (--counter.pending == 0) {
+            ready.swap(counter.continuations);
+        }
+    }
+    for (job_t *continuation : ready) {
+        push(continuation);
+    }
+}
+
+void Job_system::worker_loop(unsigned int worker) {
+    current_system = this;
+    current_worker = worker;
+    random_state += worker * 0x61c88647u;
+
+    unsigned int idle_spins = 0;
+    while (!stopping.load()) {
+        if (job_t *job = find_job(worker)) {
+            execute(job);
+            idle_spins = 0;
+            continue;
+        }
+        if (++idle_spins < SpinsBeforeSleep) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex);
+        sleeping_workers++;
+        wake_condition.wait(lock, [&] { return stopping.load() || queued_jobs.load() > 0; });
+        sleeping_workers--;
+        idle_spins = 0;
+    }
+}
+
+Job_system::~Job_system() {
+    release();
+}
+
+unsigned int Job_system::get_default_thread_count() {
+    return (std::max)(std::thread::hardware_concurrency(), 1u);
+}
+
+void Job_system::init(unsigned int thread_count) {
+    thread_count = (std::max)(thread_count, 1u);
+    for (unsigned int i = 0; i < thread_count; i++) {
+        deques.push_back(std::make_unique<Work_stealing_deque<job_t>>(DequeCapacity));
+    }
+
+    outer_system = current_system;
+    outer_worker = current_worker;
+    current_system = this;
+    current_worker = 0;
+    for (unsigned int i = 1; i < thread_count; i++) {
+        threads.emplace_back(&Job_system::worker_loop, this, i);
+    }
+}
+
+void Job_system::run(std::function<void()> function, Job_counter &counter) {
+    counter.pending++;
+    push(new job_t{std::move(function), &counter});
+}
+
+void Job_system::run_after(Job_counter &dependency, std::function<void()> function,
+                           Job_counter &counter) {
+    counter.pending++;
+    job_t *job = new job_t{std::move(function), &counter};
+    {
+        std::lock_guard lock(dependency.mutex);
+        if (dependency.pending.load() > 0) {
+            dependency.continuations.push_back(job);
+            return;
+        }
+    }
+    push(job);
+}
+
+void Job_system::wait(Job_counter &counter) {
+    int worker = get_worker_index();
+    while (!counter.done()) {
+        if (job_t *job = find_job(worker)) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    std::lock_guard lock(counter.mutex);
+    if (counter.exception) {
+        std::exception_ptr exception = counter.exception;
+        counter.exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+void Job_system::parallel_for(unsigned int begin, unsigned int end, unsigned int grain,
+                              const range_function &function) {
+    if (begin >= end) {
+        return;
+    }
+    unsigned int count = end - begin;
+    if (grain == 0) {
+        grain = (std::max)(count / (get_thread_count() * 4), 1u);
+    }
+    if (count <= grain) {
+        function(begin, end);
+        return;
+    }
+
+    Job_counter counter;
+    for (unsigned int first = begin; first < end; first += (std::min)(grain, end - first)) {
+        unsigned int last = first + (std::min)(grain, end - first);
+        run([&function, first, last] { function(first, last); }, counter);
+    }
+    wait(counter);
+}
+
+unsigned int Job_system::get_thread_count() {
+    return (std::max)(static_cast<unsigned int>(deques.size()), 1u);
+}
+
+void Job_system::release() {
+    {
+        std::lock_guard lock(sleep_mutex);
+        stopping = true;
+    }
+    wake_condition.notify_all();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+
+    if (current_system == this) {
+        current_system = outer_system;
+        current_worker = outer_worker;
+    }
+}
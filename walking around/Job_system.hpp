@@ -0,0 +1,104 @@
+#pragma once
+#include "Work_stealing_deque.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct job_t;
+
+// counts the unfinished jobs of a group, jobs scheduled after it start when it reaches zero
+class Job_counter {
+    private:
+        friend class Job_system;
+
+        std::atomic<unsigned int> pending = 0;
+        std::mutex mutex;
+        std::vector<job_t *> continuations;
+        std::exception_ptr exception; // the first one thrown by the group's jobs
+
+    public:
+        bool done() const;
+};
+
+struct job_t {
+    public:
+        std::function<void()> function;
+        Job_counter *counter;
+};
+
+// fixed size work-stealing thread pool, the thread calling init() is worker 0
+// and works while it waits
+class Job_system {
+    public:
+        using range_function = std::function<void(unsigned int first, unsigned int end)>;
+
+    private:
+        constexpr static std::size_t DequeCapacity = 4096;
+        constexpr static unsigned int SpinsBeforeSleep = 64;
+
+        std::vector<std::unique_ptr<Work_stealing_deque<job_t>>> deques;
+        std::vector<std::thread> threads;
+
+        // jobs from threads outside the pool and from full deques
+        std::mutex injected_mutex;
+        std::deque<job_t *> injected;
+
+        // briefly negative when a job is taken before its push counted it
+        std::atomic<int> queued_jobs = 0;
+        std::atomic<unsigned int> sleeping_workers = 0;
+        std::mutex sleep_mutex;
+        std::condition_variable wake_condition;
+        std::atomic<bool> stopping = false;
+
+        // the pool the thread calling init() belonged to before, restored by release()
+        const void *outer_system = nullptr;
+        int outer_worker = -1;
+
+        // the pool's index of the calling thread, -1 outside the pool
+        int get_worker_index();
+
+        void push(job_t *job);
+
+        job_t *find_job(int worker);
+
+        void execute(job_t *job);
+
+        void worker_loop(unsigned int worker);
+
+    public:
+        Job_system() = default;
+        Job_system(const Job_system &) = delete;
+        Job_system &operator=(const Job_system &) = delete;
+        ~Job_system();
+
+        static unsigned int get_default_thread_count();
+
+        // thread_count includes the calling thread
+        void init(unsigned int thread_count = get_default_thread_count());
+
+        void run(std::function<void()> function, Job_counter &counter);
+
+        // function starts once dependency is done, dependency must get no new jobs meanwhile
+        void run_after(Job_counter &dependency, std::function<void()> function,
+                       Job_counter &counter);
+
+        // runs other jobs until the counter is done, rethrows the first exception of its jobs,
+        // a counter may only be destroyed after its wait
+        void wait(Job_counter &counter);
+
+        // calls function on chunks of at most grain items and waits for all of them,
+        // grain 0 splits into a few chunks per thread
+        void parallel_for(unsigned int begin, unsigned int end, unsigned int grain,
+                          const range_function &function);
+
+        unsigned int get_thread_count();
+
+        void release();
+};
@@ -0,0 +1,69 @@
+#include "Job_system_benchmark.hpp"
+#include "Job_system.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int item_count = 1 << 22;
+constexpr unsigned int small_job_count = 100'000;
+constexpr unsigned int repeats = 3;
+
+double milliseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+           / 1'000'000.0;
+}
+
+// a transform-like amount of arithmetic per item
+double time_parallel_for(Job_system &job_system, std::vector<float> &output) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    job_system.parallel_for(0, item_count, 0, [&](unsigned int first, unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            float x = static_cast<float>(i) * 0.001f;
+            output[i] = std::sqrt(x) * std::sin(x) + std::cos(x * 0.5f);
+        }
+    });
+    return milliseconds_since(start_point);
+}
+
+// scheduling overhead, jobs that do almost nothing
+double time_small_jobs(Job_system &job_system, std::vector<float> &output) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    Job_counter counter;
+    for (unsigned int i = 0; i < small_job_count; i++) {
+        job_system.run([&output, i] { output[i] += 1; }, counter);
+    }
+    job_system.wait(counter);
+    return milliseconds_since(start_point);
+}
+} // namespace
+
+std::string benchmark_job_system(unsigned int max_threads) {
+    std::vector<float> output(item_count);
+    std::stringstream s;
+    double single_thread_time = 0;
+
+    for (unsigned int thread_count = 1; thread_count <= max_threads; thread_count++) {
+        Job_system job_system;
+        job_system.init(thread_count);
+
+        double parallel_for_time = 1e30, small_jobs_time = 1e30;
+        for (unsigned int i = 0; i < repeats; i++) {
+            parallel_for_time =
+                (std::min)(parallel_for_time, time_parallel_for(job_system, output));
+            small_jobs_time = (std::min)(small_jobs_time, time_small_jobs(job_system, output));
+        }
+        if (thread_count == 1) {
+            single_thread_time = parallel_for_time;
+        }
+
+        s << thread_count << " threads: parallel_for of " << item_count << " items "
+          << parallel_for_time << " ms (" << single_thread_time / parallel_for_time
+          << "x), " << small_job_count << " small jobs " << small_jobs_time << " ms\n";
+    }
+    return s.str();
+}
@@ -0,0 +1,5 @@
+#pragma once
+#include <string>
+
+// times the same work on pools of 1 to max_threads threads, one line per pool
+std::string benchmark_job_system(unsigned int max_threads);
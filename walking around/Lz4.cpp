@@ -0,0 +1,167 @@
+#include "Lz4.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace lz4 {
+
+namespace {
+constexpr std::size_t min_match = 4;
+// the last bytes are always literals and the last match starts before them
+constexpr std::size_t last_literals = 5;
+constexpr std::size_t match_start_limit = 12;
+constexpr std::size_t max_offset = 65535;
+constexpr unsigned int hash_bits = 16;
+
+std::uint32_t read32(const unsigned char *data) {
+    std::uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+std::uint32_t hash(std::uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - hash_bits);
+}
+
+// the part of a length that doesn't fit its 4 bits of the token
+unsigned char *write_length(unsigned char *out, std::size_t length) {
+    for (; length >= 255; length -= 255) {
+        *out++ = 255;
+    }
+    *out++ = static_cast<unsigned char>(length);
+    return out;
+}
+
+bool read_length(const unsigned char *&in, const unsigned char *in_end, std::size_t &length) {
+    unsigned char byte;
+    do {
+        if (in == in_end) {
+            return false;
+        }
+        byte = *in++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+unsigned char *write_literals(unsigned char *out, unsigned char *token,
+                              const unsigned char *literals, std::size_t count) {
+    *token = static_cast<unsigned char>((std::min)(count, std::size_t(15)) << 4);
+    if (count >= 15) {
+        out = write_length(out, count - 15);
+    }
+    if (count > 0) {
+        std::memcpy(out, literals, count);
+    }
+    return out + count;
+}
+} // namespace
+
+std::size_t get_max_compressed_size(std::size_t size) {
+    return size + size / 255 + 16;
+}
+
+std::size_t compress(const unsigned char *source, std::size_t size, unsigned char *destination) {
+    unsigned char *out = destination;
+    std::size_t anchor = 0;
+
+    if (size > match_start_limit) {
+        // positions + 1 of the last sequence with each hash, 0 for none
+        std::vector<std::uint32_t> table(std::size_t(1) << hash_bits, 0);
+        std::size_t match_end_limit = size - last_literals;
+
+        for (std::size_t i = 0; i + match_start_limit <= size;) {
+            std::uint32_t sequence = read32(source + i);
+            std::uint32_t &slot = table[hash(sequence)];
+            std::size_t candidate = slot;
+            slot = static_cast<std::uint32_t>(i + 1);
+            if (candidate == 0 || i - (candidate - 1) > max_offset
+                || read32(source + candidate - 1) != sequence) {
+                i++;
+                continue;
+            }
+            candidate--;
+
+            std::size_t length = min_match;
+            while (i + length < match_end_limit
+                   && source[candidate + length] == source[i + length]) {
+                length++;
+            }
+
+            unsigned char *token = out++;
+            out = write_literals(out, token, source + anchor, i - anchor);
+            std::size_t offset = i - candidate;
+            *out++ = static_cast<unsigned char>(offset & 0xff);
+            *out++ = static_cast<unsigned char>(offset >> 8);
+            std::size_t match_code = length - min_match;
+            *token |= static_cast<unsigned char>((std::min)(match_code, std::size_t(15)));
+            if (match_code >= 15) {
+                out = write_length(out, match_code - 15);
+            }
+
+            i += length;
+            anchor = i;
+        }
+    }
+
+    unsigned char *token = out++;
+    out = write_literals(out, token, source + anchor, size - anchor);
+    return out - destination;
+}
+
+bool decompress(const unsigned char *source, std::size_t compressed_size,
+                unsigned char *destination, std::size_t size) {
+    const unsigned char *in = source, *in_end = source + compressed_size;
+    unsigned char *out = destination, *out_end = destination + size;
+
+    while (true) {
+        if (in == in_end) {
+            return false;
+        }
+        unsigned char token = *in++;
+
+        std::size_t literals = token >> 4;
+        if (literals == 15 && !read_length(in, in_end, literals)) {
+            return false;
+        }
+        if (literals > std::size_t(in_end - in) || literals > std::size_t(out_end - out)) {
+            return false;
+        }
+        if (literals > 0) {
+            std::memcpy(out, in, literals);
+        }
+        in += literals;
+        out += literals;
+        if (in == in_end) {
+            // the last sequence has no match
+            return out == out_end;
+        }
+
+        if (in_end - in < 2) {
+            return false;
+        }
+        std::size_t offset = in[0] | std::size_t(in[1]) << 8;
+        in += 2;
+        if (offset == 0 || offset > std::size_t(out - destination)) {
+            return false;
+        }
+        std::size_t length = token & 15;
+        if (length == 15 && !read_length(in, in_end, length)) {
+            return false;
+        }
+        length += min_match;
+        if (length > std::size_t(out_end - out)) {
+            return false;
+        }
+        // byte by byte, the match may overlap what it writes
+        const unsigned char *match = out - offset;
+        for (std::size_t i = 0; i < length; i++) {
+            out[i] = match[i];
+        }
+        out += length;
+    }
+}
+
+} // namespace lz4
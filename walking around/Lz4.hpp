@@ -0,0 +1,17 @@
+#pragma once
+#include <cstddef>
+
+// the LZ4 block format, greedy matching over a 64 KB window, inputs below 4 GB
+namespace lz4 {
+
+// what compress() may write for size bytes of input, incompressible data grows a little
+std::size_t get_max_compressed_size(std::size_t size);
+
+// returns the compressed size, destination holds get_max_compressed_size(size) bytes
+std::size_t compress(const unsigned char *source, std::size_t size, unsigned char *destination);
+
+// false when source isn't a block that decompresses to exactly size bytes
+bool decompress(const unsigned char *source, std::size_t compressed_size,
+                unsigned char *destination, std::size_t size);
+
+} // namespace lz4
@@ -0,0 +1,122 @@
+#include "Math.hpp"
+
+namespace math {
+
+matrix inverse(const matrix &m, float *determinant) {
+    float4x4 f;
+    store(f, m);
+    const float(&a)[4][4] = f.m;
+
+    // the 2x2 determinants of the top two rows and of the bottom two
+    float s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    float s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    float s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    float s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    float s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    float s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+    float c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+    float c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    float c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    float c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    float c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    float c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+
+    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    if (determinant) {
+        *determinant = det;
+    }
+    if (det == 0) {
+        return m;
+    }
+    float d = 1 / det;
+
+    return {{set((a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * d,
+                 (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * d,
+                 (a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * d,
+                 (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * d),
+             set((-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * d,
+                 (a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * d,
+                 (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * d,
+                 (a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * d),
+             set((a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * d,
+                 (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * d,
+                 (a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * d,
+                 (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * d),
+             set((-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * d,
+                 (a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * d,
+                 (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * d,
+                 (a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * d)}};
+}
+
+#ifdef MATH_AVX2
+namespace {
+// both 128 bit lanes hold v
+__m256 duplicate(vector v) {
+    return _mm256_set_m128(v.v, v.v);
+}
+
+// every component of each lane set to that lane's component i, the same operations as
+// transform3() and multiply() on two vectors at once, so the bits don't change
+template <int i> __m256 splat_lanes(__m256 a) {
+    return _mm256_permute_ps(a, _MM_SHUFFLE(i, i, i, i));
+}
+} // namespace
+
+void transform_points(const float3 *points, std::size_t count, const matrix &m, float3 *out) {
+    __m256 r0 = duplicate(m.r[0]), r1 = duplicate(m.r[1]), r2 = duplicate(m.r[2]),
+           r3 = duplicate(m.r[3]);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m256 p = _mm256_setr_ps(points[i].x, points[i].y, points[i].z, 0, points[i + 1].x,
+                                  points[i + 1].y, points[i + 1].z, 0);
+        __m256 result = _mm256_add_ps(_mm256_mul_ps(splat_lanes<2>(p), r2), r3);
+        result = _mm256_add_ps(_mm256_mul_ps(splat_lanes<1>(p), r1), result);
+        result = _mm256_add_ps(_mm256_mul_ps(splat_lanes<0>(p), r0), result);
+        alignas(32) float stored[8];
+        _mm256_store_ps(stored, result);
+        out[i] = {stored[0], stored[1], stored[2]};
+        out[i + 1] = {stored[4], stored[5], stored[6]};
+    }
+    for (; i < count; i++) {
+        store(out[i], transform3(load(points[i]), m));
+    }
+}
+
+void multiply(const matrix *a, std::size_t count, const matrix &b, matrix *out) {
+    __m256 b0 = duplicate(b.r[0]), b1 = duplicate(b.r[1]), b2 = duplicate(b.r[2]),
+           b3 = duplicate(b.r[3]);
+    for (std::size_t i = 0; i < count; i++) {
+        // two rows at a time
+        for (int row = 0; row < 4; row += 2) {
+            __m256 rows = _mm256_set_m128(a[i].r[row + 1].v, a[i].r[row].v);
+            __m256 x = _mm256_mul_ps(splat_lanes<0>(rows), b0);
+            __m256 y = _mm256_mul_ps(splat_lanes<1>(rows), b1);
+            __m256 z = _mm256_mul_ps(splat_lanes<2>(rows), b2);
+            __m256 w = _mm256_mul_ps(splat_lanes<3>(rows), b3);
+            __m256 result = _mm256_add_ps(_mm256_add_ps(x, z), _mm256_add_ps(y, w));
+            out[i].r[row].v = _mm256_castps256_ps128(result);
+            out[i].r[row + 1].v = _mm256_extractf128_ps(result, 1);
+        }
+    }
+}
+#else
+void transform_points(const float3 *points, std::size_t count, const matrix &m, float3 *out) {
+    for (std::size_t i = 0; i < count; i++) {
+        store(out[i], transform3(load(points[i]), m));
+    }
+}
+
+void multiply(const matrix *a, std::size_t count, const matrix &b, matrix *out) {
+    for (std::size_t i = 0; i < count; i++) {
+        out[i] = multiply(a[i], b);
+    }
+}
+#endif
+
+void store_column_major(const matrix *matrices, std::size_t count, float4x4 *out) {
+    for (std::size_t i = 0; i < count; i++) {
+        store_column_major(out[i], matrices[i]);
+    }
+}
+
+} // namespace math
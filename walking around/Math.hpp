@@ -0,0 +1,382 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+// vectors, matrices and quaternions without Windows headers, laid out and multiplied like
+// DirectXMath: row vectors times row-major matrices, so v * world * view * proj
+//
+// the SSE backend is used where SSE2 is (every x64 build), the batch functions also have AVX2
+// paths for /arch:AVX2 or -mavx2, and MATH_SCALAR forces plain floats, every backend does the
+// same operations in the same order as DirectXMath's SSE path, so the transform chains give the
+// same bits as long as the compiler doesn't contract a * b + c into FMAs (/fp:contract,
+// -ffp-contract=fast with -mfma)
+#if !defined(MATH_SCALAR)                                                                          \
+    && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SSE
+#include <immintrin.h>
+#if defined(__AVX2__)
+#define MATH_AVX2
+#endif
+#endif
+
+namespace math {
+
+#if defined(MATH_AVX2)
+constexpr const char *backend = "avx2";
+#elif defined(MATH_SSE)
+constexpr const char *backend = "sse";
+#else
+constexpr const char *backend = "scalar";
+#endif
+
+// DirectXMath's XM_PI, XM_2PI, XM_1DIV2PI and XM_PIDIV2
+constexpr float pi = 3.141592654f;
+constexpr float two_pi = 6.283185307f;
+constexpr float one_div_two_pi = 0.159154943f;
+constexpr float pi_div_two = 1.570796327f;
+
+// storage, what goes to memory and to the shaders
+struct float3 {
+    public:
+        float x, y, z;
+};
+
+struct float4 {
+    public:
+        float x, y, z, w;
+};
+
+struct float4x4 {
+    public:
+        float m[4][4];
+};
+
+// the working types, kept in registers
+struct vector {
+    public:
+#ifdef MATH_SSE
+        __m128 v;
+#else
+        alignas(16) float v[4];
+#endif
+};
+
+// quaternions are x, y, z the axis times sin(angle / 2), w cos(angle / 2)
+using quaternion = vector;
+
+struct matrix {
+    public:
+        vector r[4];
+};
+
+// the backends only differ below, everything else is built from these
+#ifdef MATH_SSE
+inline vector set(float x, float y, float z, float w) {
+    return {_mm_set_ps(w, z, y, x)};
+}
+
+inline vector splat(float f) {
+    return {_mm_set1_ps(f)};
+}
+
+inline vector add(vector a, vector b) {
+    return {_mm_add_ps(a.v, b.v)};
+}
+
+inline vector subtract(vector a, vector b) {
+    return {_mm_sub_ps(a.v, b.v)};
+}
+
+inline vector multiply(vector a, vector b) {
+    return {_mm_mul_ps(a.v, b.v)};
+}
+
+inline vector divide(vector a, vector b) {
+    return {_mm_div_ps(a.v, b.v)};
+}
+
+// every component set to component i
+template <int i> inline vector splat(vector a) {
+    return {_mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(i, i, i, i))};
+}
+
+template <int i> inline float get(vector a) {
+    return _mm_cvtss_f32(splat<i>(a).v);
+}
+
+inline vector load(const float4 &f) {
+    return {_mm_loadu_ps(&f.x)};
+}
+
+inline void store(float4 &f, vector a) {
+    _mm_storeu_ps(&f.x, a.v);
+}
+
+inline matrix transpose(const matrix &m) {
+    __m128 t0 = _mm_shuffle_ps(m.r[0].v, m.r[1].v, _MM_SHUFFLE(1, 0, 1, 0));
+    __m128 t1 = _mm_shuffle_ps(m.r[0].v, m.r[1].v, _MM_SHUFFLE(3, 2, 3, 2));
+    __m128 t2 = _mm_shuffle_ps(m.r[2].v, m.r[3].v, _MM_SHUFFLE(1, 0, 1, 0));
+    __m128 t3 = _mm_shuffle_ps(m.r[2].v, m.r[3].v, _MM_SHUFFLE(3, 2, 3, 2));
+    return {{{_mm_shuffle_ps(t0, t2, _MM_SHUFFLE(2, 0, 2, 0))},
+             {_mm_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 1, 3, 1))},
+             {_mm_shuffle_ps(t1, t3, _MM_SHUFFLE(2, 0, 2, 0))},
+             {_mm_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 1, 3, 1))}}};
+}
+#else
+inline vector set(float x, float y, float z, float w) {
+    return {{x, y, z, w}};
+}
+
+inline vector splat(float f) {
+    return {{f, f, f, f}};
+}
+
+inline vector add(vector a, vector b) {
+    return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+}
+
+inline vector subtract(vector a, vector b) {
+    return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+}
+
+inline vector multiply(vector a, vector b) {
+    return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+}
+
+inline vector divide(vector a, vector b) {
+    return {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}};
+}
+
+template <int i> inline vector splat(vector a) {
+    return splat(a.v[i]);
+}
+
+template <int i> inline float get(vector a) {
+    return a.v[i];
+}
+
+inline vector load(const float4 &f) {
+    return {{f.x, f.y, f.z, f.w}};
+}
+
+inline void store(float4 &f, vector a) {
+    f = {a.v[0], a.v[1], a.v[2], a.v[3]};
+}
+
+inline matrix transpose(const matrix &m) {
+    matrix t;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            t.r[i].v[j] = m.r[j].v[i];
+        }
+    }
+    return t;
+}
+#endif
+
+inline vector zero() {
+    return splat(0.0f);
+}
+
+inline vector scale(vector a, float f) {
+    return multiply(a, splat(f));
+}
+
+inline float get_x(vector a) {
+    return get<0>(a);
+}
+
+inline float get_y(vector a) {
+    return get<1>(a);
+}
+
+inline float get_z(vector a) {
+    return get<2>(a);
+}
+
+inline float get_w(vector a) {
+    return get<3>(a);
+}
+
+// w is 0, like XMLoadFloat3
+inline vector load(const float3 &f) {
+    return set(f.x, f.y, f.z, 0);
+}
+
+inline void store(float3 &f, vector a) {
+    f = {get_x(a), get_y(a), get_z(a)};
+}
+
+inline matrix load(const float4x4 &f) {
+    return {{load(reinterpret_cast<const float4 &>(f.m[0])),
+             load(reinterpret_cast<const float4 &>(f.m[1])),
+             load(reinterpret_cast<const float4 &>(f.m[2])),
+             load(reinterpret_cast<const float4 &>(f.m[3]))}};
+}
+
+inline void store(float4x4 &f, const matrix &m) {
+    for (int i = 0; i < 4; i++) {
+        store(reinterpret_cast<float4 &>(f.m[i]), m.r[i]);
+    }
+}
+
+// HLSL reads the constant buffers' matrices column by column
+inline void store_column_major(float4x4 &f, const matrix &m) {
+    store(f, transpose(m));
+}
+
+inline matrix load_column_major(const float4x4 &f) {
+    return transpose(load(f));
+}
+
+// x + z first, then y, like XMVector3Dot
+inline float dot3(vector a, vector b) {
+    vector product = multiply(a, b);
+    return (get_x(product) + get_z(product)) + get_y(product);
+}
+
+inline float length3(vector a) {
+    return std::sqrt(dot3(a, a));
+}
+
+inline vector normalize3(vector a) {
+    float length = length3(a);
+    return length > 0 ? divide(a, splat(length)) : a;
+}
+
+// a point, w taken as 1, in the order of XMVector3Transform
+inline vector transform3(vector v, const matrix &m) {
+    vector result = add(multiply(splat<2>(v), m.r[2]), m.r[3]);
+    result = add(multiply(splat<1>(v), m.r[1]), result);
+    return add(multiply(splat<0>(v), m.r[0]), result);
+}
+
+// a times b, a's transform first, in the order of XMMatrixMultiply
+inline matrix multiply(const matrix &a, const matrix &b) {
+    matrix result;
+    for (int i = 0; i < 4; i++) {
+        vector x = multiply(splat<0>(a.r[i]), b.r[0]);
+        vector y = multiply(splat<1>(a.r[i]), b.r[1]);
+        vector z = multiply(splat<2>(a.r[i]), b.r[2]);
+        vector w = multiply(splat<3>(a.r[i]), b.r[3]);
+        result.r[i] = add(add(x, z), add(y, w));
+    }
+    return result;
+}
+
+// XMScalarSinCos, an 11 and a 10 degree minimax polynomial after reducing the angle to
+// [-pi / 2, pi / 2], std::sin and std::cos would round differently
+inline void sin_cos(float angle, float &sin, float &cos) {
+    float quotient = one_div_two_pi * angle;
+    if (angle >= 0.0f) {
+        quotient = static_cast<float>(static_cast<int>(quotient + 0.5f));
+    } else {
+        quotient = static_cast<float>(static_cast<int>(quotient - 0.5f));
+    }
+    float y = angle - two_pi * quotient;
+
+    float sign = 1.0f;
+    if (y > pi_div_two) {
+        y = pi - y;
+        sign = -1.0f;
+    } else if (y < -pi_div_two) {
+        y = -pi - y;
+        sign = -1.0f;
+    }
+
+    float y2 = y * y;
+    float s = -2.3889859e-08f * y2 + 2.7525562e-06f;
+    s = s * y2 - 0.00019840874f;
+    s = s * y2 + 0.0083333310f;
+    s = s * y2 - 0.16666667f;
+    sin = (s * y2 + 1.0f) * y;
+    float c = -2.6051615e-07f * y2 + 2.4760495e-05f;
+    c = c * y2 - 0.0013888378f;
+    c = c * y2 + 0.041666638f;
+    c = c * y2 - 0.5f;
+    cos = sign * (c * y2 + 1.0f);
+}
+
+inline matrix identity() {
+    return {{set(1, 0, 0, 0), set(0, 1, 0, 0), set(0, 0, 1, 0), set(0, 0, 0, 1)}};
+}
+
+inline matrix translation(float x, float y, float z) {
+    return {{set(1, 0, 0, 0), set(0, 1, 0, 0), set(0, 0, 1, 0), set(x, y, z, 1)}};
+}
+
+inline matrix scaling(float x, float y, float z) {
+    return {{set(x, 0, 0, 0), set(0, y, 0, 0), set(0, 0, z, 0), set(0, 0, 0, 1)}};
+}
+
+inline matrix rotation_x(float angle) {
+    float sin, cos;
+    sin_cos(angle, sin, cos);
+    return {{set(1, 0, 0, 0), set(0, cos, sin, 0), set(0, -sin, cos, 0), set(0, 0, 0, 1)}};
+}
+
+inline matrix rotation_y(float angle) {
+    float sin, cos;
+    sin_cos(angle, sin, cos);
+    return {{set(cos, 0, -sin, 0), set(0, 1, 0, 0), set(sin, 0, cos, 0), set(0, 0, 0, 1)}};
+}
+
+inline matrix rotation_z(float angle) {
+    float sin, cos;
+    sin_cos(angle, sin, cos);
+    return {{set(cos, sin, 0, 0), set(-sin, cos, 0, 0), set(0, 0, 1, 0), set(0, 0, 0, 1)}};
+}
+
+// left handed, depth 0 at near_z and 1 at far_z
+inline matrix perspective_fov_lh(float fov_y, float aspect_ratio, float near_z, float far_z) {
+    float sin, cos;
+    sin_cos(0.5f * fov_y, sin, cos);
+    float height = cos / sin;
+    float range = far_z / (far_z - near_z);
+    return {{set(height / aspect_ratio, 0, 0, 0), set(0, height, 0, 0), set(0, 0, range, 1),
+             set(0, 0, -range * near_z, 0)}};
+}
+
+// axis must be normalized
+inline quaternion quaternion_rotation_normal(vector axis, float angle) {
+    float sin, cos;
+    sin_cos(0.5f * angle, sin, cos);
+    return set(get_x(axis) * sin, get_y(axis) * sin, get_z(axis) * sin, cos);
+}
+
+// a's rotation, then b's, like XMQuaternionMultiply
+inline quaternion quaternion_multiply(quaternion a, quaternion b) {
+    float ax = get_x(a), ay = get_y(a), az = get_z(a), aw = get_w(a);
+    float bx = get_x(b), by = get_y(b), bz = get_z(b), bw = get_w(b);
+    return set(bw * ax + bx * aw + by * az - bz * ay, bw * ay - bx * az + by * aw + bz * ax,
+               bw * az + bx * ay - by * ax + bz * aw, bw * aw - bx * ax - by * ay - bz * az);
+}
+
+inline quaternion quaternion_normalize(quaternion q) {
+    vector squared = multiply(q, q);
+    float length =
+        std::sqrt((get_x(squared) + get_z(squared)) + (get_y(squared) + get_w(squared)));
+    return length > 0 ? divide(q, splat(length)) : q;
+}
+
+// q must be normalized
+inline matrix rotation_quaternion(quaternion q) {
+    float x = get_x(q), y = get_y(q), z = get_z(q), w = get_w(q);
+    return {{set(1 - 2 * (y * y + z * z), 2 * (x * y + z * w), 2 * (x * z - y * w), 0),
+             set(2 * (x * y - z * w), 1 - 2 * (x * x + z * z), 2 * (y * z + x * w), 0),
+             set(2 * (x * z + y * w), 2 * (y * z - x * w), 1 - 2 * (x * x + y * y), 0),
+             set(0, 0, 0, 1)}};
+}
+
+// the general inverse by cofactors, determinant is 0 when m has none and m is returned
+matrix inverse(const matrix &m, float *determinant = nullptr);
+
+// the batch versions of the functions above, over arrays, out may be the input array itself
+void transform_points(const float3 *points, std::size_t count, const matrix &m, float3 *out);
+
+// every a[i] times b
+void multiply(const matrix *a, std::size_t count, const matrix &b, matrix *out);
+
+void store_column_major(const matrix *matrices, std::size_t count, float4x4 *out);
+
+} // namespace math
@@ -0,0 +1,241 @@
+#include "Math_benchmark.hpp"
+#include "Math_directx.hpp"
+#include "Affine.hpp"
+
+#include <intrin.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int repeats = 5;
+
+struct inputs_t {
+    public:
+        std::vector<float> x, z, angle, pivot;
+        std::vector<math::float3> points;
+};
+
+// the fastest of repeats runs of function, in nanoseconds per item
+template <typename Function>
+double time_per_item(unsigned int count, Function function) {
+    double best = 1e30;
+    for (unsigned int i = 0; i < repeats; i++) {
+        auto start_point = std::chrono::high_resolution_clock::now();
+        function();
+        auto end_point = std::chrono::high_resolution_clock::now();
+        best = (std::min)(
+            best,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+                / static_cast<double>(count));
+    }
+    return best;
+}
+
+// the same for cycles, from the time stamp counter
+template <typename Function>
+double cycles_per_item(unsigned int count, Function function) {
+    double best = 1e30;
+    for (unsigned int i = 0; i < repeats; i++) {
+        unsigned long long start_cycles = __rdtsc();
+        function();
+        best = (std::min)(best, (__rdtsc() - start_cycles) / static_cast<double>(count));
+    }
+    return best;
+}
+
+void report_cycles(std::stringstream &s, const char *name, double chain_cycles,
+                   double builder_cycles, const void *chain_results,
+                   const void *builder_results, std::size_t bytes) {
+    s << name << ": 4x4 chain " << chain_cycles << " cycles, affine builder " << builder_cycles
+      << " cycles per matrix, "
+      << (std::memcmp(chain_results, builder_results, bytes) == 0 ? "same bits"
+                                                                  : "DIFFERENT bits")
+      << "\n";
+}
+
+void report(std::stringstream &s, const char *name, double directx_time, double math_time,
+            const void *directx_results, const void *math_results, std::size_t bytes) {
+    s << name << ": DirectXMath " << directx_time << " ns, math " << math_time << " ns, "
+      << (std::memcmp(directx_results, math_results, bytes) == 0 ? "same bits" : "DIFFERENT bits")
+      << "\n";
+}
+} // namespace
+
+std::string benchmark_math(unsigned int count) {
+    inputs_t inputs;
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> position(-50, 50), angle(-10, 10), pivot(0, 3);
+    for (unsigned int i = 0; i < count; i++) {
+        inputs.x.push_back(position(generator));
+        inputs.z.push_back(position(generator));
+        inputs.angle.push_back(angle(generator));
+        inputs.pivot.push_back(pivot(generator));
+        inputs.points.push_back({position(generator), position(generator), position(generator)});
+    }
+
+    std::vector<DirectX::XMFLOAT4X4> directx_matrices(count);
+    std::vector<math::float4x4> math_matrices(count);
+    std::stringstream s;
+    s << "math backend: " << math::backend << ", " << count << " items\n";
+
+    // Player::get_view_matrix() stored for the shaders
+    double directx_time = time_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            DirectX::XMMATRIX view = DirectX::XMMatrixMultiply(
+                DirectX::XMMatrixTranslation(-inputs.x[i], -5, -inputs.z[i]),
+                DirectX::XMMatrixRotationY(-inputs.angle[i]));
+            view = DirectX::XMMatrixMultiply(view, DirectX::XMMatrixTranslation(0, 0, 3));
+            view = DirectX::XMMatrixMultiply(view, DirectX::XMMatrixRotationX(-0.6f));
+            DirectX::XMStoreFloat4x4(&directx_matrices[i], DirectX::XMMatrixTranspose(view));
+        }
+    });
+    double math_time = time_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            math::matrix view = math::multiply(math::translation(-inputs.x[i], -5, -inputs.z[i]),
+                                               math::rotation_y(-inputs.angle[i]));
+            view = math::multiply(view, math::translation(0, 0, 3));
+            view = math::multiply(view, math::rotation_x(-0.6f));
+            math::store_column_major(math_matrices[i], view);
+        }
+    });
+    report(s, "view chain", directx_time, math_time, directx_matrices.data(),
+           math_matrices.data(), count * sizeof(math::float4x4));
+
+    // a limb swung about its pivot, then placed with the person
+    directx_time = time_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            DirectX::XMMATRIX off = DirectX::XMMatrixMultiply(
+                DirectX::XMMatrixRotationY(inputs.angle[i]),
+                DirectX::XMMatrixTranslation(inputs.x[i], 0, inputs.z[i]));
+            DirectX::XMMATRIX limb = DirectX::XMMatrixTranslation(0, -inputs.pivot[i], 0);
+            limb = DirectX::XMMatrixMultiply(limb, DirectX::XMMatrixRotationX(inputs.angle[i]));
+            limb = DirectX::XMMatrixMultiply(limb,
+                                             DirectX::XMMatrixTranslation(0, inputs.pivot[i], 0));
+            limb = DirectX::XMMatrixMultiply(limb, off);
+            DirectX::XMStoreFloat4x4(&directx_matrices[i], DirectX::XMMatrixTranspose(limb));
+        }
+    });
+    math_time = time_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            math::matrix off = math::multiply(math::rotation_y(inputs.angle[i]),
+                                              math::translation(inputs.x[i], 0, inputs.z[i]));
+            math::matrix limb = math::translation(0, -inputs.pivot[i], 0);
+            limb = math::multiply(limb, math::rotation_x(inputs.angle[i]));
+            limb = math::multiply(limb, math::translation(0, inputs.pivot[i], 0));
+            limb = math::multiply(limb, off);
+            math::store_column_major(math_matrices[i], limb);
+        }
+    });
+    report(s, "limb chain", directx_time, math_time, directx_matrices.data(),
+           math_matrices.data(), count * sizeof(math::float4x4));
+
+    // the batch functions against their DirectXMath loops
+    math::matrix view_proj =
+        math::multiply(math::multiply(math::translation(1, -5, 2), math::rotation_y(0.3f)),
+                       math::perspective_fov_lh(45.0f, 1.5f, 0.1f, 100.0f));
+    DirectX::XMMATRIX xm_view_proj = math::to_xm(view_proj);
+    std::vector<math::matrix> worlds(count);
+    std::vector<DirectX::XMMATRIX> xm_worlds(count);
+    for (unsigned int i = 0; i < count; i++) {
+        worlds[i] = math::multiply(math::rotation_x(inputs.angle[i]),
+                                   math::translation(inputs.x[i], inputs.pivot[i], inputs.z[i]));
+        xm_worlds[i] = math::to_xm(worlds[i]);
+    }
+    std::vector<math::matrix> math_products(count);
+    std::vector<DirectX::XMMATRIX> directx_products(count);
+    directx_time = time_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            directx_products[i] = DirectX::XMMatrixMultiply(xm_worlds[i], xm_view_proj);
+        }
+    });
+    math_time = time_per_item(count, [&] {
+        math::multiply(worlds.data(), count, view_proj, math_products.data());
+    });
+    report(s, "batch multiply", directx_time, math_time, directx_products.data(),
+           math_products.data(), count * sizeof(math::matrix));
+
+    std::vector<math::float3> math_points(count);
+    std::vector<DirectX::XMFLOAT3> directx_points(count);
+    directx_time = time_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            DirectX::XMVECTOR point = DirectX::XMLoadFloat3(
+                reinterpret_cast<const DirectX::XMFLOAT3 *>(&inputs.points[i]));
+            DirectX::XMStoreFloat3(&directx_points[i],
+                                   DirectX::XMVector3Transform(point, xm_view_proj));
+        }
+    });
+    math_time = time_per_item(count, [&] {
+        math::transform_points(inputs.points.data(), count, view_proj, math_points.data());
+    });
+    report(s, "batch transform", directx_time, math_time, directx_points.data(),
+           math_points.data(), count * sizeof(math::float3));
+
+    // the transforms built step by step into the shaders' layout against the 4x4 chains
+    std::vector<math::float4x4> builder_matrices(count);
+    double chain_cycles = cycles_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            math::matrix view = math::multiply(math::translation(-inputs.x[i], -5, -inputs.z[i]),
+                                               math::rotation_y(-inputs.angle[i]));
+            view = math::multiply(view, math::translation(0, 0, 3));
+            view = math::multiply(view, math::rotation_x(-0.6f));
+            math::store_column_major(math_matrices[i], view);
+        }
+    });
+    double builder_cycles = cycles_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            math::affine view = math::then_rotation_y(
+                math::affine_translation(-inputs.x[i], -5, -inputs.z[i]), -inputs.angle[i]);
+            view = math::then_translation(view, 0, 0, 3);
+            view = math::then_rotation_x(view, -0.6f);
+            math::store_column_major(builder_matrices[i], view);
+        }
+    });
+    report_cycles(s, "view", chain_cycles, builder_cycles, math_matrices.data(),
+                  builder_matrices.data(), count * sizeof(math::float4x4));
+
+    chain_cycles = cycles_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            math::matrix off = math::multiply(math::rotation_y(inputs.angle[i]),
+                                              math::translation(inputs.x[i], 0, inputs.z[i]));
+            math::matrix limb = math::translation(0, -inputs.pivot[i], 0);
+            limb = math::multiply(limb, math::rotation_x(inputs.angle[i]));
+            limb = math::multiply(limb, math::translation(0, inputs.pivot[i], 0));
+            math::store_column_major(math_matrices[i], math::multiply(limb, off));
+        }
+    });
+    builder_cycles = cycles_per_item(count, [&] {
+        for (unsigned int i = 0; i < count; i++) {
+            math::affine off =
+                math::then_translation(math::then_rotation_y(math::affine_identity(),
+                                                             inputs.angle[i]),
+                                       inputs.x[i], 0, inputs.z[i]);
+            math::affine limb = math::affine_pivot_rotation_x(inputs.pivot[i], inputs.angle[i]);
+            math::store_column_major(builder_matrices[i], math::then(limb, off));
+        }
+    });
+    report_cycles(s, "limb", chain_cycles, builder_cycles, math_matrices.data(),
+                  builder_matrices.data(), count * sizeof(math::float4x4));
+
+    // many objects' world transforms, only stored
+    std::vector<math::affine> transforms(count);
+    for (unsigned int i = 0; i < count; i++) {
+        transforms[i] = math::then_translation(
+            math::then_rotation_x(math::affine_identity(), inputs.angle[i]), inputs.x[i],
+            inputs.pivot[i], inputs.z[i]);
+    }
+    chain_cycles = cycles_per_item(count, [&] {
+        math::store_column_major(worlds.data(), count, math_matrices.data());
+    });
+    builder_cycles = cycles_per_item(count, [&] {
+        math::store_column_major(transforms.data(), count, builder_matrices.data());
+    });
+    report_cycles(s, "batch store", chain_cycles, builder_cycles, math_matrices.data(),
+                  builder_matrices.data(), count * sizeof(math::float4x4));
+
+    return s.str();
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "Math.hpp"
+
+#include <DirectXMath.h>
+
+// for comparing math with DirectXMath, both lay matrices out alike
+namespace math {
+
+inline DirectX::XMMATRIX to_xm(const matrix &m) {
+    float4x4 f;
+    store(f, m);
+    return DirectX::XMLoadFloat4x4(reinterpret_cast<const DirectX::XMFLOAT4X4 *>(&f));
+}
+
+} // namespace math
@@ -0,0 +1,414 @@
+#include "Mesh.hpp"
+#include "Asset_source.hpp"
+#include "Mesh_optimizer.hpp"
+#include "Mesh_simplifier.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <stdexcept>
+
+const std::array<float, 3> &Mesh::get_pivot(unsigned int id) const {
+    constexpr static std::array<float, 3> no_pivot = {0, 0, 0};
+    auto it = id_to_pivot_point.find(id);
+    return it != id_to_pivot_point.end() ? it->second : no_pivot;
+}
+
+const std::map<unsigned int, Aabb_tree::box_t> &Mesh::get_group_bounds() const {
+    return id_to_bounds;
+}
+
+const Mesh::collision_mesh_t &Mesh::get_collision_mesh() const {
+    return collision_mesh;
+}
+
+unsigned int Mesh::get_off_id() const {
+    return off_id;
+}
+
+math::float4 Mesh::get_bounding_sphere() const {
+    math::vector half_extent = math::scale(
+        math::set(bounds.extent.x, bounds.extent.y, bounds.extent.z, bounds.extent.w), 0.5f);
+    math::vector center =
+        math::add(math::set(bounds.min.x, bounds.min.y, bounds.min.z, bounds.min.w), half_extent);
+    return {math::get_x(center), math::get_y(center), math::get_z(center),
+            math::length3(half_extent)};
+}
+
+const mesh_bounds_t &Mesh::get_bounds() const {
+    return bounds;
+}
+
+const D3D12_GPU_DESCRIPTOR_HANDLE &Mesh::get_texture_handle() const {
+    return texture_handle;
+}
+
+const D3D12_VERTEX_BUFFER_VIEW &Mesh::get_vertex_buffer_view() const {
+    return vertex_buffer.get_view();
+}
+
+const D3D12_INDEX_BUFFER_VIEW &Mesh::get_index_buffer_view() const {
+    return index_buffer.get_view();
+}
+
+const std::vector<Mesh::lod_t> &Mesh::get_lods() const {
+    return lods;
+}
+
+const std::vector<std::vector<meshlet::meshlet_t>> &Mesh::get_lod_meshlets() const {
+    return lod_meshlets;
+}
+
+const std::vector<UINT> &Mesh::get_cpu_indices() const {
+    return cpu_indices;
+}
+
+const std::vector<vertex_t> &Mesh::get_cpu_vertices() const {
+    return cpu_vertices;
+}
+
+std::size_t Mesh::get_memory_size() const {
+    std::size_t size = vertex_buffer.get_view().SizeInBytes
+                       + index_buffer.get_view().SizeInBytes
+                       + cpu_indices.size() * sizeof(UINT)
+                       + cpu_vertices.size() * sizeof(vertex_t)
+                       + collision_mesh.positions.size() * sizeof(math::float3)
+                       + collision_mesh.groups.size() * sizeof(unsigned int)
+                       + collision_mesh.indices.size() * sizeof(UINT);
+    for (const std::vector<meshlet::meshlet_t> &meshlets : lod_meshlets) {
+        size += meshlets.size() * sizeof(meshlet::meshlet_t);
+    }
+    return size;
+}
+
+void Mesh::optimize_mesh(std::vector<vertex_t> &vertices, std::vector<UINT> &indices,
+                         PCWSTR obj_filename) {
+    using namespace mesh_optimizer;
+
+    auto start_point = std::chrono::high_resolution_clock::now();
+
+    cache_statistics before = analyze_vertex_cache(indices, vertices.size());
+
+    std::vector<std::array<float, 3>> positions(vertices.size());
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        std::copy(vertices[i].position, vertices[i].position + 3, positions[i].begin());
+    }
+
+    std::vector<unsigned int> cluster_starts;
+    indices = optimize_vertex_cache(indices, vertices.size(), cluster_starts);
+    indices = optimize_overdraw(indices, positions, cluster_starts);
+    vertices = remap_vertices(vertices, optimize_vertex_fetch(indices, vertices.size()));
+
+    cache_statistics after = analyze_vertex_cache(indices, vertices.size());
+
+    auto end_point = std::chrono::high_resolution_clock::now();
+    double milliseconds_passed =
+        std::chrono::duration_cast<std::chrono::microseconds>(end_point - start_point).count()
+        / 1'000.0;
+
+    std::wstringstream s;
+    s << obj_filename << ": " << indices.size() / 3 << " triangles, " << vertices.size()
+      << " vertices, ACMR " << before.acmr << " -> " << after.acmr << ", ATVR " << before.atvr
+      << " -> " << after.atvr << ", optimized in " << milliseconds_passed << " ms\n";
+    OutputDebugStringW(s.str().c_str());
+}
+
+void Mesh::build_meshlets(const std::vector<vertex_t> &vertices,
+                          const std::vector<UINT> &indices) {
+    if (lods[0].index_count / 3 < meshlet_min_triangles) {
+        return;
+    }
+
+    std::vector<std::array<float, 3>> positions(vertices.size());
+    std::vector<unsigned int> groups(vertices.size());
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        std::copy(vertices[i].position, vertices[i].position + 3, positions[i].begin());
+        groups[i] = vertices[i].mat_index;
+    }
+
+    for (const lod_t &lod : lods) {
+        lod_meshlets.push_back(
+            meshlet::build(indices, lod.first_index, lod.index_count, positions, groups));
+    }
+    cpu_indices = indices;
+}
+
+void Mesh::build_lods(const std::vector<vertex_t> &vertices, std::vector<UINT> &indices) {
+    std::vector<std::array<float, 3>> positions(vertices.size());
+    std::vector<std::array<float, 2>> tex_coords(vertices.size());
+    std::vector<unsigned int> groups(vertices.size());
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        std::copy(vertices[i].position, vertices[i].position + 3, positions[i].begin());
+        std::copy(vertices[i].tex_coord, vertices[i].tex_coord + 2, tex_coords[i].begin());
+        groups[i] = vertices[i].mat_index;
+    }
+
+    std::vector<UINT> full_indices(indices.begin(), indices.begin() + lods[0].index_count);
+    for (float ratio : lod_index_ratios) {
+        UINT target_index_count = static_cast<UINT>(full_indices.size() * ratio) / 3 * 3;
+        float error;
+        std::vector<unsigned int> lod_indices = mesh_simplifier::simplify(
+            full_indices, positions, tex_coords, groups, target_index_count, error);
+        if (lod_indices.size() > lods.back().index_count * min_lod_reduction) {
+            break;
+        }
+
+        std::vector<unsigned int> cluster_starts;
+        lod_indices =
+            mesh_optimizer::optimize_vertex_cache(lod_indices, vertices.size(), cluster_starts);
+        lods.push_back({.first_index = static_cast<UINT>(indices.size()),
+                        .index_count = static_cast<UINT>(lod_indices.size()),
+                        .error = error});
+        indices.insert(indices.end(), lod_indices.begin(), lod_indices.end());
+    }
+}
+
+bool Mesh::read_lod_file(const std::filesystem::path &lod_path, UINT64 source_stamp,
+                         UINT vertex_count, std::vector<UINT> &indices) {
+    std::ifstream lod_file(lod_path, std::ios::binary);
+    UINT version = 0, file_vertex_count = 0, lod_count = 0;
+    UINT64 file_source_stamp = 0;
+    lod_file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    lod_file.read(reinterpret_cast<char *>(&file_source_stamp), sizeof(file_source_stamp));
+    lod_file.read(reinterpret_cast<char *>(&file_vertex_count), sizeof(file_vertex_count));
+    lod_file.read(reinterpret_cast<char *>(&lod_count), sizeof(lod_count));
+    // build_lods() makes at most one lod per ratio after the full mesh
+    if (!lod_file || version != lod_file_version || file_source_stamp != source_stamp
+        || file_vertex_count != vertex_count || lod_count == 0
+        || lod_count > 1 + std::size(lod_index_ratios)) {
+        return false;
+    }
+
+    std::vector<lod_t> file_lods(lod_count);
+    lod_file.read(reinterpret_cast<char *>(file_lods.data()), sizeof(lod_t) * lod_count);
+    // the first lod is the full mesh, it has to match what was just loaded
+    if (!lod_file || file_lods[0].first_index != 0
+        || file_lods[0].index_count != lods[0].index_count) {
+        return false;
+    }
+    // the others follow it in turn, none larger than it, so the indices are at most
+    // lod_count full meshes
+    for (UINT i = 1; i < lod_count; i++) {
+        if (file_lods[i].first_index
+                != file_lods[i - 1].first_index + file_lods[i - 1].index_count
+            || file_lods[i].index_count > lods[0].index_count
+            || file_lods[i].index_count % 3 != 0) {
+            return false;
+        }
+    }
+
+    UINT64 index_count = UINT64(file_lods.back().first_index) + file_lods.back().index_count;
+    if (index_count < indices.size()) {
+        return false;
+    }
+    std::vector<UINT> file_indices(index_count);
+    lod_file.read(reinterpret_cast<char *>(file_indices.data()), sizeof(UINT) * index_count);
+    if (!lod_file || !std::equal(indices.begin(), indices.end(), file_indices.begin())
+        || std::any_of(file_indices.begin() + indices.size(), file_indices.end(),
+                       [vertex_count](UINT index) { return index >= vertex_count; })) {
+        return false;
+    }
+
+    lods = file_lods;
+    indices = file_indices;
+    return true;
+}
+
+void Mesh::write_lod_file(const std::filesystem::path &lod_path, UINT64 source_stamp,
+                          UINT vertex_count, const std::vector<UINT> &indices) {
+    std::ofstream lod_file(lod_path, std::ios::binary);
+    UINT lod_count = lods.size();
+    lod_file.write(reinterpret_cast<const char *>(&lod_file_version), sizeof(lod_file_version));
+    lod_file.write(reinterpret_cast<const char *>(&source_stamp), sizeof(source_stamp));
+    lod_file.write(reinterpret_cast<const char *>(&vertex_count), sizeof(vertex_count));
+    lod_file.write(reinterpret_cast<const char *>(&lod_count), sizeof(lod_count));
+    lod_file.write(reinterpret_cast<const char *>(lods.data()), sizeof(lod_t) * lod_count);
+    lod_file.write(reinterpret_cast<const char *>(indices.data()), sizeof(UINT) * indices.size());
+}
+
+void Mesh::load_lods(const std::vector<vertex_t> &vertices, std::vector<UINT> &indices,
+                     PCWSTR obj_filename, UINT64 source_stamp) {
+    lods = {
+        {.first_index = 0, .index_count = static_cast<UINT>(indices.size()), .error = 0}
+    };
+
+    std::filesystem::path lod_path(obj_filename);
+    lod_path += L".lod";
+
+    if (read_lod_file(lod_path, source_stamp, vertices.size(), indices)) {
+        return;
+    }
+    build_lods(vertices, indices);
+    write_lod_file(lod_path, source_stamp, vertices.size(), indices);
+}
+
+void Mesh::init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                const std::vector<char> &contents, PCWSTR obj_filename,
+                const D3D12_GPU_DESCRIPTOR_HANDLE &_texture_handle,
+                const texture_packer::placement_t &placement, Id_giver &id_giver) {
+    texture_handle = _texture_handle;
+
+    std::vector<std::array<float, 3>> vertex_coords;
+    std::vector<unsigned int> vertex_groups;
+    std::vector<bool> is_pivot;
+    std::vector<std::array<float, 3>> normals;
+    std::vector<std::array<float, 2>> tex_coords;
+
+
+    std::string current_object_name;
+    std::string current_group_name = "off";
+
+    unsigned int off_gid = Id_giver::no_id;
+
+    std::istringstream obj_file(std::string(contents.begin(), contents.end()));
+    std::string current_line;
+    while (std::getline(obj_file, current_line)) {
+        std::replace(current_line.begin(), current_line.end(), '/', ' ');
+        std::stringstream line_stream(current_line);
+        std::string current_token;
+        line_stream >> current_token;
+        if (current_token == "v") {
+            std::array<float, 3> coords;
+            line_stream >> coords[0] >> coords[1] >> coords[2];
+            vertex_coords.push_back(coords);
+            vertex_groups.push_back(Id_giver::no_id); // unused id
+            is_pivot.push_back(false);
+        } else if (current_token == "vt") {
+            std::array<float, 2> coords;
+            line_stream >> coords[0] >> coords[1];
+            tex_coords.push_back(coords);
+        } else if (current_token == "vn") {
+            std::array<float, 3> coords;
+            line_stream >> coords[0] >> coords[1] >> coords[2];
+            normals.push_back(coords);
+        } else if (current_token == "f") {
+            unsigned int current_gid =
+                id_giver.get_id(current_object_name + "." + current_group_name);
+
+
+            for (unsigned int i = 0; i < 3; i++) {
+                vertex_t current_vertex;
+                unsigned int v_index, vt_index, vn_index;
+                line_stream >> v_index >> vt_index >> vn_index;
+                if (vertex_groups[v_index - 1] != Id_giver::no_id
+                    && vertex_groups[v_index - 1] != current_gid) {
+                    is_pivot[v_index - 1] = true;
+                }
+                if (vertex_groups[v_index - 1] == Id_giver::no_id || current_gid != off_gid) {
+                    vertex_groups[v_index - 1] = current_gid;
+                }
+            }
+        } else if (current_token == "o") {
+            line_stream >> current_object_name;
+            off_gid = id_giver.get_id(current_object_name + ".off");
+            if (off_id == Id_giver::no_id) {
+                off_id = off_gid;
+            }
+        } else if (current_token == "g") {
+            line_stream >> current_group_name;
+        }
+    }
+    obj_file.clear();
+    obj_file.seekg(0, std::ios::beg);
+
+    std::vector<vertex_t> vertices;
+    std::vector<UINT> indices;
+    // the same v/vt/vn triple is shared between faces
+    std::map<std::array<unsigned int, 3>, UINT> corner_to_index;
+
+    while (std::getline(obj_file, current_line)) {
+
+        std::replace(current_line.begin(), current_line.end(), '/', ' ');
+        std::stringstream line_stream(current_line);
+        std::string current_token;
+        line_stream >> current_token;
+
+        if (current_token == "f") {
+            for (unsigned int i = 0; i < 3; i++) {
+                vertex_t current_vertex;
+                unsigned int v_index, vt_index, vn_index;
+                line_stream >> v_index >> vt_index >> vn_index;
+
+                auto [found, inserted] = corner_to_index.try_emplace(
+                    {v_index, vt_index, vn_index}, static_cast<UINT>(vertices.size()));
+                indices.push_back(found->second);
+                if (!inserted) {
+                    continue;
+                }
+
+                std::array<float, 3> &coords = vertex_coords[v_index - 1];
+                std::array<float, 3> &normal = normals[vn_index - 1];
+                std::array<float, 2> &tex = tex_coords[vt_index - 1];
+                std::copy(coords.begin(), coords.end(), current_vertex.position);
+                std::copy(normal.begin(), normal.end(), current_vertex.normal);
+                std::copy(tex.begin(), tex.end(), current_vertex.tex_coord);
+
+                current_vertex.mat_index = vertex_groups[v_index - 1];
+
+                vertices.push_back(current_vertex);
+            }
+        }
+    }
+    optimize_mesh(vertices, indices, obj_filename);
+    // the contents' hash, the .wobj may come from an archive without a file time
+    load_lods(vertices, indices, obj_filename,
+              Asset_source::hash(contents.data(), contents.size()));
+    build_meshlets(vertices, indices);
+
+    collision_mesh.indices.assign(indices.begin(), indices.begin() + lods[0].index_count);
+    for (vertex_t &vertex : vertices) {
+        const float *position = vertex.position;
+        collision_mesh.positions.push_back({position[0], position[1], position[2]});
+        collision_mesh.groups.push_back(vertex.mat_index);
+        auto [group_bounds, first] = id_to_bounds.try_emplace(
+            vertex.mat_index,
+            Aabb_tree::box_t{{position[0], position[1], position[2]},
+                             {position[0], position[1], position[2]}});
+        if (!first) {
+            Aabb_tree::box_t &box = group_bounds->second;
+            box.min = {(std::min)(box.min.x, position[0]), (std::min)(box.min.y, position[1]),
+                       (std::min)(box.min.z, position[2])};
+            box.max = {(std::max)(box.max.x, position[0]), (std::max)(box.max.y, position[1]),
+                       (std::max)(box.max.z, position[2])};
+        }
+
+        for (unsigned int j = 0; j < 2; j++) {
+            vertex.tex_coord[j] = vertex.tex_coord[j] * placement.scale[j] + placement.offset[j];
+        }
+        if (vertex.mat_index >= (1u << MAT_INDEX_BITS)) {
+            throw std::runtime_error("mat_index doesn't fit next to the texture slice");
+        }
+        vertex.mat_index |= placement.slice << MAT_INDEX_BITS;
+    }
+
+    cpu_vertices = vertices;
+    bounds = compute_bounds(vertices);
+#ifdef PACKED_VERTICES
+    vertex_buffer.init(device, upload_batch, pack_vertices(vertices, bounds));
+#else
+    vertex_buffer.init(device, upload_batch, vertices);
+#endif
+    index_buffer.init(device, upload_batch, indices);
+
+    std::map<unsigned int, unsigned int> id_to_num_pivot_points;
+    for (unsigned int i = 0; i < vertex_coords.size(); i++) {
+
+        if (!is_pivot[i]) {
+            continue;
+        }
+        id_to_num_pivot_points[vertex_groups[i]]++;
+        std::array<float, 3> &sum_array = id_to_pivot_point[vertex_groups[i]];
+        for (unsigned int j = 0; j < 3; j++) {
+            sum_array[j] += vertex_coords[i][j];
+        }
+    }
+
+    for (const auto &[id, num] : id_to_num_pivot_points) {
+        std::array<float, 3> &sum_array = id_to_pivot_point[id];
+        for (unsigned int j = 0; j < 3; j++) {
+            sum_array[j] /= num;
+        }
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "Windows_includes.hpp"
+#include "Upload_batch.hpp"
+#include "Texture_packer.hpp"
+#include "Id_giver.hpp"
+#include "Vertex_buffer.hpp"
+#include "Index_buffer.hpp"
+#include "Vertex.hpp"
+#include "Meshlet.hpp"
+#include "Aabb_tree.hpp"
+#include <map>
+#include <array>
+#include <filesystem>
+
+// what a .wobj turns into on the GPU, shared by every Object drawing it
+class Mesh {
+    public:
+        // every lod is a range of the index buffer over the same vertices
+        struct lod_t {
+            public:
+                UINT first_index;
+                UINT index_count;
+                float error; // largest distance from the full mesh, in mesh units
+        };
+
+        // the full detail triangles kept on the CPU, every vertex with its group so it can be
+        // placed by the group's transform
+        struct collision_mesh_t {
+            public:
+                std::vector<math::float3> positions;
+                std::vector<unsigned int> groups;
+                std::vector<UINT> indices;
+        };
+
+    private:
+        // the scene texture, this mesh's image is placed somewhere in it
+        D3D12_GPU_DESCRIPTOR_HANDLE texture_handle = {};
+        Vertex_buffer vertex_buffer;
+        Index_buffer index_buffer;
+        mesh_bounds_t bounds = {};
+
+        unsigned int off_id = Id_giver::no_id;
+
+        std::vector<lod_t> lods;
+
+        constexpr static float lod_index_ratios[] = {0.5f, 0.25f, 0.125f};
+        // a lod is kept only if it is at most this part of the previous one
+        constexpr static float min_lod_reduction = 0.9f;
+        constexpr static UINT lod_file_version = 2;
+
+        // large meshes get meshlets for every lod, culled per Object
+        constexpr static unsigned int meshlet_min_triangles = 1024;
+        std::vector<std::vector<meshlet::meshlet_t>> lod_meshlets;
+        std::vector<UINT> cpu_indices;
+        // as in the vertex buffer but unpacked, for copying the mesh into other meshes
+        std::vector<vertex_t> cpu_vertices;
+
+        std::map<unsigned int, std::array<float, 3>> id_to_pivot_point;
+        std::map<unsigned int, Aabb_tree::box_t> id_to_bounds;
+        collision_mesh_t collision_mesh;
+
+        // reorders for the vertex cache, overdraw and vertex fetch, reports the gains
+        void optimize_mesh(std::vector<vertex_t> &vertices, std::vector<UINT> &indices,
+                           PCWSTR obj_filename);
+
+        // appends the lods to indices, they are read from obj_filename.lod when it was written
+        // for the same source_stamp
+        void load_lods(const std::vector<vertex_t> &vertices, std::vector<UINT> &indices,
+                       PCWSTR obj_filename, UINT64 source_stamp);
+
+        void build_lods(const std::vector<vertex_t> &vertices, std::vector<UINT> &indices);
+
+        void build_meshlets(const std::vector<vertex_t> &vertices,
+                            const std::vector<UINT> &indices);
+
+        bool read_lod_file(const std::filesystem::path &lod_path, UINT64 source_stamp,
+                           UINT vertex_count, std::vector<UINT> &indices);
+
+        void write_lod_file(const std::filesystem::path &lod_path, UINT64 source_stamp,
+                            UINT vertex_count, const std::vector<UINT> &indices);
+
+    public:
+        // contents is the .wobj read from obj_filename, the uvs are moved to placement and
+        // its slice goes next to the mat_index
+        void init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                  const std::vector<char> &contents, PCWSTR obj_filename,
+                  const D3D12_GPU_DESCRIPTOR_HANDLE &_texture_handle,
+                  const texture_packer::placement_t &placement, Id_giver &id_giver);
+
+        // zero for ids without pivot points
+        const std::array<float, 3> &get_pivot(unsigned int id) const;
+
+        // every group's box in object space, by id
+        const std::map<unsigned int, Aabb_tree::box_t> &get_group_bounds() const;
+
+        const collision_mesh_t &get_collision_mesh() const;
+
+        // id of the mesh's off group, which places the whole mesh
+        unsigned int get_off_id() const;
+
+        // center and radius in object space
+        math::float4 get_bounding_sphere() const;
+
+        const mesh_bounds_t &get_bounds() const;
+
+        const D3D12_GPU_DESCRIPTOR_HANDLE &get_texture_handle() const;
+
+        const D3D12_VERTEX_BUFFER_VIEW &get_vertex_buffer_view() const;
+
+        const D3D12_INDEX_BUFFER_VIEW &get_index_buffer_view() const;
+
+        const std::vector<lod_t> &get_lods() const;
+
+        // empty for meshes too small to have meshlets
+        const std::vector<std::vector<meshlet::meshlet_t>> &get_lod_meshlets() const;
+
+        const std::vector<UINT> &get_cpu_indices() const;
+
+        // placed on the texture, with the slice next to the mat_index
+        const std::vector<vertex_t> &get_cpu_vertices() const;
+
+        // the GPU buffers and what is kept on the CPU
+        std::size_t get_memory_size() const;
+};
@@ -0,0 +1,276 @@
+#include "Mesh_optimizer.hpp"
+
+#include <cmath>
+#include <numeric>
+
+namespace mesh_optimizer {
+
+namespace {
+// triangles using every vertex, stored as one array with per vertex offsets
+struct adjacency_t {
+    public:
+        std::vector<unsigned int> offsets;
+        std::vector<unsigned int> triangles;
+        std::vector<unsigned int> live_counts;
+
+        adjacency_t(const std::vector<unsigned int> &indices, unsigned int vertex_count)
+            : offsets(vertex_count + 1, 0), triangles(indices.size()),
+              live_counts(vertex_count, 0) {
+            for (unsigned int index : indices) {
+                live_counts[index]++;
+            }
+            for (unsigned int i = 0; i < vertex_count; i++) {
+                offsets[i + 1] = offsets[i] + live_counts[i];
+            }
+            std::vector<unsigned int> filled(offsets.begin(), offsets.end() - 1);
+            for (unsigned int i = 0; i < indices.size(); i++) {
+                triangles[filled[indices[i]]++] = i / 3;
+            }
+        }
+};
+
+// FIFO cache as timestamps, a vertex is cached if it was inserted less than size insertions ago
+struct fifo_cache_t {
+    public:
+        std::vector<unsigned int> timestamps;
+        unsigned int size;
+        unsigned int time;
+
+        fifo_cache_t(unsigned int vertex_count, unsigned int cache_size)
+            : timestamps(vertex_count, 0), size(cache_size), time(cache_size + 1) {}
+
+        bool access(unsigned int vertex) {
+            if (time - timestamps[vertex] > size) {
+                timestamps[vertex] = time++;
+                return false;
+            }
+            return true;
+        }
+
+        void clear() {
+            time += size + 1;
+        }
+};
+
+std::array<float, 3> subtract(const std::array<float, 3> &a, const std::array<float, 3> &b) {
+    return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+std::array<float, 3> cross(const std::array<float, 3> &a, const std::array<float, 3> &b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+float dot(const std::array<float, 3> &a, const std::array<float, 3> &b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+} // namespace
+
+cache_statistics analyze_vertex_cache(const std::vector<unsigned int> &indices,
+                                      unsigned int vertex_count, unsigned int cache_size) {
+    cache_statistics result;
+    if (indices.empty()) {
+        return result;
+    }
+
+    fifo_cache_t cache(vertex_count, cache_size);
+    std::vector<bool> used(vertex_count, false);
+    unsigned int misses = 0, used_count = 0;
+    for (unsigned int index : indices) {
+        if (!cache.access(index)) {
+            misses++;
+        }
+        if (!used[index]) {
+            used[index] = true;
+            used_count++;
+        }
+    }
+
+    result.acmr = static_cast<float>(misses) / (indices.size() / 3);
+    result.atvr = static_cast<float>(misses) / used_count;
+    return result;
+}
+
+std::vector<unsigned int> optimize_vertex_cache(const std::vector<unsigned int> &indices,
+                                                unsigned int vertex_count,
+                                                std::vector<unsigned int> &cluster_starts,
+                                                unsigned int cache_size) {
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+    cluster_starts.clear();
+    if (indices.empty()) {
+        return result;
+    }
+
+    adjacency_t adjacency(indices, vertex_count);
+    std::vector<unsigned int> &live_counts = adjacency.live_counts;
+    std::vector<bool> emitted(indices.size() / 3, false);
+    fifo_cache_t cache(vertex_count, cache_size);
+
+    std::vector<unsigned int> dead_end_stack;
+    std::vector<unsigned int> candidates;
+    unsigned int input_cursor = 0;
+
+    unsigned int fanning_vertex = indices[0];
+    cluster_starts.push_back(0);
+
+    while (fanning_vertex != no_vertex) {
+        candidates.clear();
+
+        for (unsigned int i = adjacency.offsets[fanning_vertex];
+             i < adjacency.offsets[fanning_vertex + 1]; i++) {
+            unsigned int triangle = adjacency.triangles[i];
+            if (emitted[triangle]) {
+                continue;
+            }
+            emitted[triangle] = true;
+            for (unsigned int j = 0; j < 3; j++) {
+                unsigned int vertex = indices[triangle * 3 + j];
+                result.push_back(vertex);
+                dead_end_stack.push_back(vertex);
+                candidates.push_back(vertex);
+                live_counts[vertex]--;
+                cache.access(vertex);
+            }
+        }
+
+        // best candidate is the one staying longest in the cache after its fan is emitted
+        unsigned int best_vertex = no_vertex;
+        int best_priority = -1;
+        for (unsigned int vertex : candidates) {
+            if (live_counts[vertex] == 0) {
+                continue;
+            }
+            int priority = 0;
+            unsigned int age = cache.time - cache.timestamps[vertex];
+            if (age + 2 * live_counts[vertex] <= cache_size) {
+                priority = age;
+            }
+            if (priority > best_priority) {
+                best_priority = priority;
+                best_vertex = vertex;
+            }
+        }
+
+        if (best_vertex == no_vertex) {
+            // dead end, continue from a recently used vertex or from the input order
+            while (!dead_end_stack.empty() && best_vertex == no_vertex) {
+                unsigned int vertex = dead_end_stack.back();
+                dead_end_stack.pop_back();
+                if (live_counts[vertex] > 0) {
+                    best_vertex = vertex;
+                }
+            }
+            while (best_vertex == no_vertex && input_cursor < indices.size()) {
+                unsigned int vertex = indices[input_cursor++];
+                if (live_counts[vertex] > 0) {
+                    best_vertex = vertex;
+                }
+            }
+            if (best_vertex != no_vertex) {
+                cluster_starts.push_back(result.size() / 3);
+            }
+        }
+        fanning_vertex = best_vertex;
+    }
+    return result;
+}
+
+std::vector<unsigned int> optimize_overdraw(const std::vector<unsigned int> &indices,
+                                            const std::vector<std::array<float, 3>> &positions,
+                                            const std::vector<unsigned int> &cluster_starts,
+                                            unsigned int cache_size, float threshold) {
+    unsigned int triangle_count = indices.size() / 3;
+    if (triangle_count == 0) {
+        return indices;
+    }
+    unsigned int vertex_count = positions.size();
+
+    // soft boundaries, a cluster ends once its own ACMR gets close to the whole mesh's
+    float mesh_acmr = analyze_vertex_cache(indices, vertex_count, cache_size).acmr;
+    std::vector<unsigned int> soft_starts;
+    fifo_cache_t cache(vertex_count, cache_size);
+    for (unsigned int c = 0; c < cluster_starts.size(); c++) {
+        unsigned int cluster_end =
+            c + 1 < cluster_starts.size() ? cluster_starts[c + 1] : triangle_count;
+        unsigned int start = cluster_starts[c], misses = 0;
+        soft_starts.push_back(start);
+        cache.clear();
+        for (unsigned int triangle = start; triangle < cluster_end; triangle++) {
+            for (unsigned int j = 0; j < 3; j++) {
+                misses += !cache.access(indices[triangle * 3 + j]);
+            }
+            float cluster_acmr = static_cast<float>(misses) / (triangle - start + 1);
+            if (triangle + 1 < cluster_end && cluster_acmr <= threshold * mesh_acmr) {
+                start = triangle + 1;
+                misses = 0;
+                soft_starts.push_back(start);
+                cache.clear();
+            }
+        }
+    }
+
+    // sort key of a cluster is how much it faces away from the mesh center
+    std::array<float, 3> mesh_center = {0, 0, 0};
+    for (const std::array<float, 3> &position : positions) {
+        for (unsigned int j = 0; j < 3; j++) {
+            mesh_center[j] += position[j] / vertex_count;
+        }
+    }
+
+    std::vector<float> sort_keys(soft_starts.size());
+    for (unsigned int c = 0; c < soft_starts.size(); c++) {
+        unsigned int cluster_end = c + 1 < soft_starts.size() ? soft_starts[c + 1] : triangle_count;
+        std::array<float, 3> center = {0, 0, 0}, normal = {0, 0, 0};
+        float area_sum = 0;
+        for (unsigned int triangle = soft_starts[c]; triangle < cluster_end; triangle++) {
+            const std::array<float, 3> &a = positions[indices[triangle * 3]];
+            const std::array<float, 3> &b = positions[indices[triangle * 3 + 1]];
+            const std::array<float, 3> &d = positions[indices[triangle * 3 + 2]];
+            // length of the cross product is twice the area, so the sum is area weighted
+            std::array<float, 3> face_normal = cross(subtract(b, a), subtract(d, a));
+            float area = std::sqrt(dot(face_normal, face_normal));
+            for (unsigned int j = 0; j < 3; j++) {
+                center[j] += (a[j] + b[j] + d[j]) * area / 3;
+                normal[j] += face_normal[j];
+            }
+            area_sum += area;
+        }
+        if (area_sum > 0) {
+            for (unsigned int j = 0; j < 3; j++) {
+                center[j] /= area_sum;
+            }
+        }
+        float normal_length = std::sqrt(dot(normal, normal));
+        sort_keys[c] =
+            normal_length > 0 ? dot(subtract(center, mesh_center), normal) / normal_length : 0;
+    }
+
+    std::vector<unsigned int> cluster_order(soft_starts.size());
+    std::iota(cluster_order.begin(), cluster_order.end(), 0);
+    std::stable_sort(cluster_order.begin(), cluster_order.end(),
+                     [&](unsigned int a, unsigned int b) { return sort_keys[a] > sort_keys[b]; });
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+    for (unsigned int c : cluster_order) {
+        unsigned int cluster_end = c + 1 < soft_starts.size() ? soft_starts[c + 1] : triangle_count;
+        result.insert(result.end(), indices.begin() + soft_starts[c] * 3,
+                      indices.begin() + cluster_end * 3);
+    }
+    return result;
+}
+
+std::vector<unsigned int> optimize_vertex_fetch(std::vector<unsigned int> &indices,
+                                                unsigned int vertex_count) {
+    std::vector<unsigned int> remap(vertex_count, no_vertex);
+    unsigned int next_vertex = 0;
+    for (unsigned int &index : indices) {
+        if (remap[index] == no_vertex) {
+            remap[index] = next_vertex++;
+        }
+        index = remap[index];
+    }
+    return remap;
+}
+
+} // namespace mesh_optimizer
@@ -0,0 +1,65 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+// triangle list reordering for the post-transform vertex cache, overdraw and vertex fetch,
+// indices are 3 per triangle, positions are indexed by vertex
+namespace mesh_optimizer {
+
+constexpr unsigned int default_cache_size = 16;
+
+// remap value of vertices not referenced by any triangle
+constexpr unsigned int no_vertex = (std::numeric_limits<unsigned int>::max)();
+
+struct cache_statistics {
+    public:
+        float acmr = 0; // transformed vertices per triangle, 0.5 is the best possible
+        float atvr = 0; // transformed vertices per used vertex, 1 is the best possible
+};
+
+// FIFO cache simulation
+cache_statistics analyze_vertex_cache(const std::vector<unsigned int> &indices,
+                                      unsigned int vertex_count,
+                                      unsigned int cache_size = default_cache_size);
+
+// Tipsify, returns the reordered indices, cluster_starts gets the first triangle
+// of every cluster made between cache dead ends
+std::vector<unsigned int> optimize_vertex_cache(const std::vector<unsigned int> &indices,
+                                                unsigned int vertex_count,
+                                                std::vector<unsigned int> &cluster_starts,
+                                                unsigned int cache_size = default_cache_size);
+
+// splits the clusters further while keeping the cache efficiency within threshold
+// of the whole mesh, then sorts them so outward facing ones are drawn first
+std::vector<unsigned int> optimize_overdraw(const std::vector<unsigned int> &indices,
+                                            const std::vector<std::array<float, 3>> &positions,
+                                            const std::vector<unsigned int> &cluster_starts,
+                                            unsigned int cache_size = default_cache_size,
+                                            float threshold = 1.05f);
+
+// renumbers vertices in order of first use, indices are rewritten in place,
+// returns the new position of every old vertex
+std::vector<unsigned int> optimize_vertex_fetch(std::vector<unsigned int> &indices,
+                                                unsigned int vertex_count);
+
+template <typename VERTEX_TYPE>
+std::vector<VERTEX_TYPE> remap_vertices(const std::vector<VERTEX_TYPE> &vertices,
+                                        const std::vector<unsigned int> &remap) {
+    unsigned int new_vertex_count = 0;
+    for (unsigned int new_index : remap) {
+        if (new_index != no_vertex) {
+            new_vertex_count = (std::max)(new_vertex_count, new_index + 1);
+        }
+    }
+    std::vector<VERTEX_TYPE> result(new_vertex_count);
+    for (unsigned int i = 0; i < remap.size(); i++) {
+        if (remap[i] != no_vertex) {
+            result[remap[i]] = vertices[i];
+        }
+    }
+    return result;
+}
+
+} // namespace mesh_optimizer
@@ -0,0 +1,100 @@
+#include "Mesh_optimizer_benchmark.hpp"
+#include "Mesh_optimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+using triangle_t = std::array<unsigned int, 3>;
+
+double milliseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end_point - start_point).count();
+}
+
+// by the vertices' positions, each turned to start at its smallest corner, then sorted
+std::vector<std::array<std::array<float, 3>, 3>>
+get_triangles(const std::vector<unsigned int> &indices,
+              const std::vector<std::array<float, 3>> &positions) {
+    std::vector<std::array<std::array<float, 3>, 3>> triangles(indices.size() / 3);
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        triangle_t corners = {indices[i * 3], indices[i * 3 + 1], indices[i * 3 + 2]};
+        unsigned int first = 0;
+        for (unsigned int j = 1; j < 3; j++) {
+            first = positions[corners[j]] < positions[corners[first]] ? j : first;
+        }
+        for (unsigned int j = 0; j < 3; j++) {
+            triangles[i][j] = positions[corners[(first + j) % 3]];
+        }
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+} // namespace
+
+std::string benchmark_mesh_optimizer(unsigned int triangle_count) {
+    using namespace mesh_optimizer;
+
+    unsigned int side = static_cast<unsigned int>(std::sqrt(triangle_count / 2.0));
+    std::vector<std::array<float, 3>> positions;
+    for (unsigned int z = 0; z <= side; z++) {
+        for (unsigned int x = 0; x <= side; x++) {
+            float height = std::sin(x * 0.05f) * std::cos(z * 0.07f) * 4;
+            positions.push_back({static_cast<float>(x), height, static_cast<float>(z)});
+        }
+    }
+    std::vector<triangle_t> grid;
+    for (unsigned int z = 0; z < side; z++) {
+        for (unsigned int x = 0; x < side; x++) {
+            unsigned int a = z * (side + 1) + x, b = a + 1, c = a + side + 1, d = c + 1;
+            grid.push_back({a, c, b});
+            grid.push_back({b, c, d});
+        }
+    }
+    std::mt19937 generator(3);
+    std::shuffle(grid.begin(), grid.end(), generator);
+    std::vector<unsigned int> indices;
+    for (const triangle_t &triangle : grid) {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+    unsigned int vertex_count = static_cast<unsigned int>(positions.size());
+
+    cache_statistics before = analyze_vertex_cache(indices, vertex_count);
+    auto start_point = std::chrono::high_resolution_clock::now();
+    std::vector<unsigned int> cluster_starts;
+    std::vector<unsigned int> tipsified =
+        optimize_vertex_cache(indices, vertex_count, cluster_starts);
+    double tipsify_milliseconds = milliseconds_since(start_point);
+    cache_statistics after_tipsify = analyze_vertex_cache(tipsified, vertex_count);
+
+    start_point = std::chrono::high_resolution_clock::now();
+    std::vector<unsigned int> sorted = optimize_overdraw(tipsified, positions, cluster_starts);
+    double overdraw_milliseconds = milliseconds_since(start_point);
+    cache_statistics after_overdraw = analyze_vertex_cache(sorted, vertex_count);
+
+    start_point = std::chrono::high_resolution_clock::now();
+    std::vector<unsigned int> fetched = sorted;
+    std::vector<std::array<float, 3>> fetched_positions =
+        remap_vertices(positions, optimize_vertex_fetch(fetched, vertex_count));
+    double fetch_milliseconds = milliseconds_since(start_point);
+    cache_statistics after_fetch =
+        analyze_vertex_cache(fetched, static_cast<unsigned int>(fetched_positions.size()));
+
+    bool same = get_triangles(fetched, fetched_positions) == get_triangles(indices, positions);
+
+    std::stringstream s;
+    s << "mesh optimizer: " << indices.size() / 3 << " triangles, " << vertex_count
+      << " vertices, ACMR " << before.acmr << " -> " << after_tipsify.acmr << " after Tipsify -> "
+      << after_overdraw.acmr << " after the overdraw pass, ATVR " << before.atvr << " -> "
+      << after_fetch.atvr << "\n";
+    s << "mesh optimizer: Tipsify " << tipsify_milliseconds << " ms, " << cluster_starts.size()
+      << " clusters, overdraw " << overdraw_milliseconds << " ms, vertex fetch "
+      << fetch_milliseconds << " ms, "
+      << (same ? "the same triangles" : "the triangles differ") << "\n";
+    return s.str();
+}
@@ -0,0 +1,7 @@
+#pragma once
+#include <string>
+
+// a bumpy grid of about triangle_count triangles in shuffled order, like an exporter may leave
+// it: the ACMR and ATVR before, after Tipsify and after the overdraw pass, how long each pass and
+// the vertex fetch reorder take, and whether the triangles are still the same ones, one line each
+std::string benchmark_mesh_optimizer(unsigned int triangle_count);
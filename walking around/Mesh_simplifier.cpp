@@ -0,0 +1,329 @@
+#include "Mesh_simplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace mesh_simplifier {
+
+namespace {
+// sum of squared distances to planes, weighted by the planes' triangle areas
+struct quadric_t {
+    public:
+        double a00 = 0, a01 = 0, a02 = 0, a03 = 0, a11 = 0, a12 = 0, a13 = 0, a22 = 0, a23 = 0,
+               a33 = 0;
+        double weight = 0;
+
+        void add_plane(double nx, double ny, double nz, double d, double area) {
+            a00 += area * nx * nx;
+            a01 += area * nx * ny;
+            a02 += area * nx * nz;
+            a03 += area * nx * d;
+            a11 += area * ny * ny;
+            a12 += area * ny * nz;
+            a13 += area * ny * d;
+            a22 += area * nz * nz;
+            a23 += area * nz * d;
+            a33 += area * d * d;
+            weight += area;
+        }
+
+        void add(const quadric_t &other) {
+            a00 += other.a00;
+            a01 += other.a01;
+            a02 += other.a02;
+            a03 += other.a03;
+            a11 += other.a11;
+            a12 += other.a12;
+            a13 += other.a13;
+            a22 += other.a22;
+            a23 += other.a23;
+            a33 += other.a33;
+            weight += other.weight;
+        }
+
+        // mean squared distance of the point to the planes
+        double evaluate(const std::array<float, 3> &p) const {
+            double x = p[0], y = p[1], z = p[2];
+            double error = a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z + 2 * a03 * x
+                           + a11 * y * y + 2 * a12 * y * z + 2 * a13 * y + a22 * z * z
+                           + 2 * a23 * z + a33;
+            return weight > 0 ? std::abs(error) / weight : 0;
+        }
+};
+
+struct collapse_t {
+    public:
+        unsigned int from, to;
+        double error;
+};
+
+std::array<float, 3> triangle_normal(const std::array<float, 3> &a, const std::array<float, 3> &b,
+                                     const std::array<float, 3> &c) {
+    float e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    float e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    return {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+            e1[0] * e2[1] - e1[1] * e2[0]};
+}
+
+float dot(const std::array<float, 3> &a, const std::array<float, 3> &b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// the vertices sharing a position are one corner of the surface, split for their normals on
+// hard edges, for their uvs on seams or for their groups
+struct welded_t {
+    public:
+        // by vertex
+        std::vector<unsigned int> ids;
+        // by welded id
+        std::vector<std::array<float, 3>> positions;
+        std::vector<std::vector<unsigned int>> copies;
+        // the copies don't all have the same uv
+        std::vector<bool> seams;
+};
+
+welded_t weld(const std::vector<std::array<float, 3>> &positions,
+              const std::vector<std::array<float, 2>> &tex_coords) {
+    welded_t welded;
+    welded.ids.resize(positions.size());
+    std::map<std::array<float, 3>, unsigned int> position_ids;
+    for (unsigned int i = 0; i < positions.size(); i++) {
+        unsigned int next_id = static_cast<unsigned int>(welded.positions.size());
+        auto [it, inserted] = position_ids.try_emplace(positions[i], next_id);
+        if (inserted) {
+            welded.positions.push_back(positions[i]);
+            welded.copies.emplace_back();
+            welded.seams.push_back(false);
+        }
+        welded.ids[i] = it->second;
+        welded.copies[it->second].push_back(i);
+        if (tex_coords[i] != tex_coords[welded.copies[it->second][0]]) {
+            welded.seams[it->second] = true;
+        }
+    }
+    return welded;
+}
+
+// by welded id
+std::vector<bool> find_locked_vertices(const std::vector<unsigned int> &indices,
+                                       const welded_t &welded,
+                                       const std::vector<unsigned int> &groups) {
+    std::vector<bool> locked(welded.positions.size(), false);
+
+    // between groups, copies that don't agree on their group
+    for (unsigned int i = 0; i < welded.copies.size(); i++) {
+        for (unsigned int copy : welded.copies[i]) {
+            if (groups[copy] != groups[welded.copies[i][0]]) {
+                locked[i] = true;
+            }
+        }
+    }
+
+    // borders, edges used by a single triangle
+    std::map<std::pair<unsigned int, unsigned int>, unsigned int> edge_uses;
+    for (unsigned int i = 0; i < indices.size(); i += 3) {
+        for (unsigned int j = 0; j < 3; j++) {
+            unsigned int a = welded.ids[indices[i + j]];
+            unsigned int b = welded.ids[indices[i + (j + 1) % 3]];
+            edge_uses[{(std::min)(a, b), (std::max)(a, b)}]++;
+        }
+    }
+    for (const auto &[edge, uses] : edge_uses) {
+        if (uses == 1) {
+            locked[edge.first] = locked[edge.second] = true;
+        }
+    }
+
+    // group boundaries, triangles joining differently transformed parts
+    for (unsigned int i = 0; i < indices.size(); i += 3) {
+        unsigned int a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        if (groups[a] != groups[b] || groups[a] != groups[c]) {
+            locked[welded.ids[a]] = locked[welded.ids[b]] = locked[welded.ids[c]] = true;
+        }
+    }
+    return locked;
+}
+
+// which of to's copies the vertex copy of from goes to: the one it shares a triangle with, so
+// it stays on its side of hard edges and seams, or else to's only copy unless from is on a seam,
+// which keeps seams moving along themselves, false when there is neither
+bool find_target(const std::vector<unsigned int> &indices, const welded_t &welded,
+                 const std::vector<unsigned int> &from_triangles, unsigned int from,
+                 unsigned int copy, unsigned int to, unsigned int &target) {
+    bool used = false;
+    for (unsigned int triangle : from_triangles) {
+        const unsigned int *corners = &indices[triangle * 3];
+        if (corners[0] != copy && corners[1] != copy && corners[2] != copy) {
+            continue;
+        }
+        used = true;
+        for (unsigned int j = 0; j < 3; j++) {
+            if (welded.ids[corners[j]] == to) {
+                target = corners[j];
+                return true;
+            }
+        }
+    }
+    // a copy no triangle uses anymore can go anywhere
+    target = welded.copies[to][0];
+    return !used || (welded.copies[to].size() == 1 && !welded.seams[from]);
+}
+
+// moving from onto to must not turn any of from's other triangles around
+bool collapse_flips(const std::vector<unsigned int> &indices,
+                    const std::vector<std::array<float, 3>> &positions,
+                    const std::vector<std::vector<unsigned int>> &vertex_triangles,
+                    unsigned int from, unsigned int to) {
+    for (unsigned int triangle : vertex_triangles[from]) {
+        const unsigned int *corners = &indices[triangle * 3];
+        if (corners[0] == to || corners[1] == to || corners[2] == to) {
+            continue;
+        }
+        std::array<std::array<float, 3>, 3> moved = {positions[corners[0]], positions[corners[1]],
+                                                     positions[corners[2]]};
+        for (unsigned int j = 0; j < 3; j++) {
+            if (corners[j] == from) {
+                moved[j] = positions[to];
+            }
+        }
+        std::array<float, 3> before = triangle_normal(
+            positions[corners[0]], positions[corners[1]], positions[corners[2]]);
+        std::array<float, 3> after = triangle_normal(moved[0], moved[1], moved[2]);
+        if (dot(before, after) <= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+std::vector<unsigned int> simplify(const std::vector<unsigned int> &indices,
+                                   const std::vector<std::array<float, 3>> &positions,
+                                   const std::vector<std::array<float, 2>> &tex_coords,
+                                   const std::vector<unsigned int> &groups,
+                                   unsigned int target_index_count, float &result_error) {
+    welded_t welded = weld(positions, tex_coords);
+    unsigned int vertex_count = welded.positions.size();
+    std::vector<bool> locked = find_locked_vertices(indices, welded, groups);
+
+    std::vector<quadric_t> quadrics(vertex_count);
+    for (unsigned int i = 0; i < indices.size(); i += 3) {
+        const std::array<float, 3> &a = positions[indices[i]];
+        std::array<float, 3> normal =
+            triangle_normal(a, positions[indices[i + 1]], positions[indices[i + 2]]);
+        double length = std::sqrt(dot(normal, normal));
+        if (length == 0) {
+            continue;
+        }
+        double nx = normal[0] / length, ny = normal[1] / length, nz = normal[2] / length;
+        double d = -(nx * a[0] + ny * a[1] + nz * a[2]);
+        for (unsigned int j = 0; j < 3; j++) {
+            quadrics[welded.ids[indices[i + j]]].add_plane(nx, ny, nz, d, length / 2);
+        }
+    }
+
+    double max_error = 0;
+    std::vector<unsigned int> result = indices;
+    std::vector<unsigned int> welded_result;
+    std::vector<collapse_t> collapses;
+    std::vector<std::vector<unsigned int>> vertex_triangles(vertex_count);
+    std::vector<bool> touched(vertex_count);
+    std::vector<unsigned int> remap(positions.size());
+    std::vector<unsigned int> targets;
+
+    // every pass collapses the cheapest edges that don't share vertices, all on welded ids
+    while (result.size() > target_index_count) {
+        welded_result.resize(result.size());
+        for (unsigned int i = 0; i < result.size(); i++) {
+            welded_result[i] = welded.ids[result[i]];
+        }
+        for (std::vector<unsigned int> &triangles : vertex_triangles) {
+            triangles.clear();
+        }
+        collapses.clear();
+        for (unsigned int i = 0; i < welded_result.size(); i += 3) {
+            for (unsigned int j = 0; j < 3; j++) {
+                unsigned int from = welded_result[i + j];
+                vertex_triangles[from].push_back(i / 3);
+                for (unsigned int to :
+                     {welded_result[i + (j + 1) % 3], welded_result[i + (j + 2) % 3]}) {
+                    if (locked[from] || to == from) {
+                        continue;
+                    }
+                    quadric_t combined = quadrics[from];
+                    combined.add(quadrics[to]);
+                    collapses.push_back({from, to, combined.evaluate(welded.positions[to])});
+                }
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(),
+                  [](const collapse_t &a, const collapse_t &b) { return a.error < b.error; });
+
+        std::fill(touched.begin(), touched.end(), false);
+        for (unsigned int i = 0; i < remap.size(); i++) {
+            remap[i] = i;
+        }
+
+        unsigned int triangles_to_remove = (result.size() - target_index_count + 2) / 3;
+        unsigned int triangles_removed = 0;
+        for (const collapse_t &collapse : collapses) {
+            if (triangles_removed >= triangles_to_remove) {
+                break;
+            }
+            if (touched[collapse.from] || touched[collapse.to]
+                || collapse_flips(welded_result, welded.positions, vertex_triangles,
+                                  collapse.from, collapse.to)) {
+                continue;
+            }
+            // every copy of from moves, each onto a copy of to
+            const std::vector<unsigned int> &copies = welded.copies[collapse.from];
+            targets.resize(copies.size());
+            bool found = true;
+            for (unsigned int i = 0; i < copies.size() && found; i++) {
+                found = find_target(result, welded, vertex_triangles[collapse.from],
+                                    collapse.from, copies[i], collapse.to, targets[i]);
+            }
+            if (!found) {
+                continue;
+            }
+            for (unsigned int i = 0; i < copies.size(); i++) {
+                remap[copies[i]] = targets[i];
+            }
+            quadrics[collapse.to].add(quadrics[collapse.from]);
+            max_error = (std::max)(max_error, collapse.error);
+
+            // the neighborhood changes shape, so it waits for the next pass
+            for (unsigned int triangle : vertex_triangles[collapse.from]) {
+                bool has_to = false;
+                for (unsigned int j = 0; j < 3; j++) {
+                    touched[welded_result[triangle * 3 + j]] = true;
+                    has_to |= welded_result[triangle * 3 + j] == collapse.to;
+                }
+                triangles_removed += has_to;
+            }
+        }
+        if (triangles_removed == 0) {
+            break;
+        }
+
+        unsigned int written = 0;
+        for (unsigned int i = 0; i < result.size(); i += 3) {
+            unsigned int a = remap[result[i]], b = remap[result[i + 1]], c = remap[result[i + 2]];
+            unsigned int welded_a = welded.ids[a], welded_b = welded.ids[b],
+                         welded_c = welded.ids[c];
+            if (welded_a == welded_b || welded_b == welded_c || welded_a == welded_c) {
+                continue;
+            }
+            result[written++] = a;
+            result[written++] = b;
+            result[written++] = c;
+        }
+        result.resize(written);
+    }
+
+    result_error = static_cast<float>(std::sqrt(max_error));
+    return result;
+}
+
+} // namespace mesh_simplifier
@@ -0,0 +1,19 @@
+#pragma once
+#include <array>
+#include <vector>
+
+// quadric error metric edge collapse, vertices are only ever moved onto other existing vertices
+// so the result indexes the same vertex buffer as the input
+namespace mesh_simplifier {
+
+// the vertices at one position move together, each onto the copy of the vertex they collapse
+// to on its side of any hard edge or UV seam, so seams only move along themselves, the ones on
+// mesh borders and between groups are never moved, result_error gets the largest collapse error
+// as a distance in mesh units
+std::vector<unsigned int> simplify(const std::vector<unsigned int> &indices,
+                                   const std::vector<std::array<float, 3>> &positions,
+                                   const std::vector<std::array<float, 2>> &tex_coords,
+                                   const std::vector<unsigned int> &groups,
+                                   unsigned int target_index_count, float &result_error);
+
+} // namespace mesh_simplifier
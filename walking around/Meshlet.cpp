@@ -0,0 +1,188 @@
+#include "Meshlet.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace meshlet {
+
+namespace {
+// group of triangles whose corners are in different groups, never culled
+constexpr unsigned int mixed_group = (std::numeric_limits<unsigned int>::max)();
+
+// below this the normals spread over more than a hemisphere, so no viewer sees only backs
+constexpr float min_cone_dot = 0.1f;
+
+float length(const std::array<float, 3> &v) {
+    return std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+}
+
+meshlet_t make_meshlet(const std::vector<unsigned int> &indices, unsigned int first_index,
+                       unsigned int end_index, const std::vector<std::array<float, 3>> &positions,
+                       unsigned int group) {
+    meshlet_t result = {.first_index = first_index,
+                        .index_count = end_index - first_index,
+                        .group = group,
+                        .center = {},
+                        .radius = 0,
+                        .cone_axis = {0, 0, 0},
+                        .cone_cutoff = 1};
+
+    std::array<float, 3> min = positions[indices[first_index]], max = min;
+    for (unsigned int i = first_index; i < end_index; i++) {
+        for (unsigned int j = 0; j < 3; j++) {
+            min[j] = (std::min)(min[j], positions[indices[i]][j]);
+            max[j] = (std::max)(max[j], positions[indices[i]][j]);
+        }
+    }
+    for (unsigned int j = 0; j < 3; j++) {
+        result.center[j] = (min[j] + max[j]) / 2;
+    }
+    for (unsigned int i = first_index; i < end_index; i++) {
+        const std::array<float, 3> &p = positions[indices[i]];
+        result.radius = (std::max)(result.radius, length({p[0] - result.center[0],
+                                                          p[1] - result.center[1],
+                                                          p[2] - result.center[2]}));
+    }
+
+    // front faces are clockwise, so (b - a) x (c - a) points outward
+    std::vector<std::array<float, 3>> normals;
+    std::array<float, 3> axis = {0, 0, 0};
+    for (unsigned int i = first_index; i < end_index; i += 3) {
+        const std::array<float, 3> &a = positions[indices[i]];
+        const std::array<float, 3> &b = positions[indices[i + 1]];
+        const std::array<float, 3> &c = positions[indices[i + 2]];
+        std::array<float, 3> e1 = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        std::array<float, 3> e2 = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+        std::array<float, 3> normal = {e1[1] * e2[2] - e1[2] * e2[1],
+                                       e1[2] * e2[0] - e1[0] * e2[2],
+                                       e1[0] * e2[1] - e1[1] * e2[0]};
+        float normal_length = length(normal);
+        if (normal_length == 0) {
+            continue;
+        }
+        for (unsigned int j = 0; j < 3; j++) {
+            normal[j] /= normal_length;
+            axis[j] += normal[j];
+        }
+        normals.push_back(normal);
+    }
+
+    float axis_length = length(axis);
+    if (axis_length == 0) {
+        return result;
+    }
+    for (unsigned int j = 0; j < 3; j++) {
+        result.cone_axis[j] = axis[j] / axis_length;
+    }
+    float min_dot = 1;
+    for (const std::array<float, 3> &normal : normals) {
+        float dot = normal[0] * result.cone_axis[0] + normal[1] * result.cone_axis[1]
+                    + normal[2] * result.cone_axis[2];
+        min_dot = (std::min)(min_dot, dot);
+    }
+    if (min_dot > min_cone_dot) {
+        result.cone_cutoff = std::sqrt(1 - min_dot * min_dot);
+    }
+    return result;
+}
+} // namespace
+
+void cull_statistics::add(const cull_statistics &other) {
+    total += other.total;
+    frustum_culled += other.frustum_culled;
+    backface_culled += other.backface_culled;
+    cull_microseconds += other.cull_microseconds;
+}
+
+std::vector<meshlet_t> build(const std::vector<unsigned int> &indices, unsigned int first_index,
+                             unsigned int index_count,
+                             const std::vector<std::array<float, 3>> &positions,
+                             const std::vector<unsigned int> &groups) {
+    std::vector<meshlet_t> result;
+    if (index_count == 0) {
+        return result;
+    }
+
+    // a vertex belongs to the current meshlet if its mark is the current stamp
+    std::vector<unsigned int> vertex_marks(positions.size(), 0);
+    unsigned int stamp = 1;
+    unsigned int start = first_index, vertex_count = 0;
+    unsigned int current_group = groups[indices[first_index]];
+    unsigned int end_index = first_index + index_count;
+
+    for (unsigned int i = first_index; i < end_index; i += 3) {
+        unsigned int a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        unsigned int group = groups[a] == groups[b] && groups[a] == groups[c] ? groups[a]
+                                                                               : mixed_group;
+        unsigned int new_vertices = (vertex_marks[a] != stamp) + (vertex_marks[b] != stamp)
+                                    + (vertex_marks[c] != stamp);
+
+        if (i > start
+            && (vertex_count + new_vertices > max_vertices
+                || (i - start) / 3 >= max_triangles || group != current_group)) {
+            result.push_back(make_meshlet(indices, start, i, positions, current_group));
+            start = i;
+            stamp++;
+            vertex_count = 0;
+            new_vertices = 3 - (a == b) - (b == c) - (a == c && a != b);
+        }
+        if (i == start) {
+            current_group = group;
+        }
+        vertex_marks[a] = vertex_marks[b] = vertex_marks[c] = stamp;
+        vertex_count += new_vertices;
+    }
+    result.push_back(make_meshlet(indices, start, end_index, positions, current_group));
+    return result;
+}
+
+unsigned int cull(const std::vector<meshlet_t> &meshlets, const std::vector<unsigned int> &indices,
+                  const std::array<std::array<float, 4>, 6> &planes,
+                  const std::array<float, 3> &camera_position, unsigned int cull_group,
+                  unsigned int *output, cull_statistics &statistics) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+
+    unsigned int written = 0;
+    for (const meshlet_t &meshlet : meshlets) {
+        statistics.total++;
+
+        if (meshlet.group == cull_group) {
+            bool outside = false;
+            for (const std::array<float, 4> &plane : planes) {
+                float distance = plane[0] * meshlet.center[0] + plane[1] * meshlet.center[1]
+                                 + plane[2] * meshlet.center[2] + plane[3];
+                outside |= distance < -meshlet.radius;
+            }
+            if (outside) {
+                statistics.frustum_culled++;
+                continue;
+            }
+
+            std::array<float, 3> to_center = {meshlet.center[0] - camera_position[0],
+                                              meshlet.center[1] - camera_position[1],
+                                              meshlet.center[2] - camera_position[2]};
+            float along_axis = to_center[0] * meshlet.cone_axis[0]
+                               + to_center[1] * meshlet.cone_axis[1]
+                               + to_center[2] * meshlet.cone_axis[2];
+            if (meshlet.cone_cutoff < 1
+                && along_axis >= meshlet.cone_cutoff * length(to_center) + meshlet.radius) {
+                statistics.backface_culled++;
+                continue;
+            }
+        }
+
+        std::copy(indices.begin() + meshlet.first_index,
+                  indices.begin() + meshlet.first_index + meshlet.index_count, output + written);
+        written += meshlet.index_count;
+    }
+
+    auto end_point = std::chrono::high_resolution_clock::now();
+    statistics.cull_microseconds +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+        / 1'000.0;
+    return written;
+}
+
+} // namespace meshlet
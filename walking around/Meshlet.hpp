@@ -0,0 +1,50 @@
+#pragma once
+#include <array>
+#include <vector>
+
+// clusters of consecutive triangles with bounds for culling on the CPU
+namespace meshlet {
+
+constexpr unsigned int max_vertices = 64;
+constexpr unsigned int max_triangles = 124;
+
+struct meshlet_t {
+    public:
+        unsigned int first_index;
+        unsigned int index_count;
+        unsigned int group; // every triangle in a meshlet has the same group
+
+        std::array<float, 3> center;
+        float radius;
+
+        // the meshlet is backfacing for every viewer inside the cone opposite to the axis
+        std::array<float, 3> cone_axis;
+        float cone_cutoff; // 1 disables the cone test
+};
+
+struct cull_statistics {
+    public:
+        unsigned int total = 0;
+        unsigned int frustum_culled = 0;
+        unsigned int backface_culled = 0;
+        double cull_microseconds = 0;
+
+        void add(const cull_statistics &other);
+};
+
+// splits indices[first_index, first_index + index_count) in the given order,
+// groups are indexed by vertex
+std::vector<meshlet_t> build(const std::vector<unsigned int> &indices, unsigned int first_index,
+                             unsigned int index_count,
+                             const std::vector<std::array<float, 3>> &positions,
+                             const std::vector<unsigned int> &groups);
+
+// planes are ax + by + cz + d >= 0 inside, normalized, in the same space as the meshlets,
+// meshlets of other groups than cull_group are always kept,
+// visible triangles are written to output which must fit all of them, returns the index count
+unsigned int cull(const std::vector<meshlet_t> &meshlets, const std::vector<unsigned int> &indices,
+                  const std::array<std::array<float, 4>, 6> &planes,
+                  const std::array<float, 3> &camera_position, unsigned int cull_group,
+                  unsigned int *output, cull_statistics &statistics);
+
+} // namespace meshlet
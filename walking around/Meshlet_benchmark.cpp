@@ -0,0 +1,181 @@
+#include "Meshlet_benchmark.hpp"
+#include "Math.hpp"
+#include "Mesh_optimizer.hpp"
+#include "Meshlet.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int rings = 192, segments = 288;
+constexpr float rock_radius = 10;
+
+double microseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end_point - start_point).count();
+}
+
+float dot(const std::array<float, 3> &a, const std::array<float, 3> &b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+std::array<float, 3> subtract(const std::array<float, 3> &a, const std::array<float, 3> &b) {
+    return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+// a sphere with bumps, the poles are fans so no triangle is degenerate
+void make_rock(std::vector<std::array<float, 3>> &positions, std::vector<unsigned int> &indices) {
+    positions.push_back({0, rock_radius, 0});
+    for (unsigned int ring = 1; ring < rings; ring++) {
+        float polar = math::pi * ring / rings;
+        for (unsigned int segment = 0; segment < segments; segment++) {
+            float azimuth = math::two_pi * segment / segments;
+            float radius = rock_radius
+                           * (1 + 0.08f * std::sin(polar * 9) * std::cos(azimuth * 7)
+                              + 0.01f * std::sin(polar * 31 + azimuth * 23));
+            positions.push_back({radius * std::sin(polar) * std::cos(azimuth),
+                                 radius * std::cos(polar),
+                                 radius * std::sin(polar) * std::sin(azimuth)});
+        }
+    }
+    positions.push_back({0, -rock_radius, 0});
+    unsigned int bottom = static_cast<unsigned int>(positions.size() - 1);
+
+    // clockwise seen from outside, as Meshlet expects front faces
+    auto ring_vertex = [](unsigned int ring, unsigned int segment) {
+        return 1 + (ring - 1) * segments + segment % segments;
+    };
+    for (unsigned int segment = 0; segment < segments; segment++) {
+        indices.insert(indices.end(), {0, ring_vertex(1, segment + 1), ring_vertex(1, segment)});
+        for (unsigned int ring = 1; ring + 1 < rings; ring++) {
+            unsigned int a = ring_vertex(ring, segment), b = ring_vertex(ring, segment + 1);
+            unsigned int c = ring_vertex(ring + 1, segment), d = ring_vertex(ring + 1, segment + 1);
+            indices.insert(indices.end(), {a, b, c, b, d, c});
+        }
+        indices.insert(indices.end(), {bottom, ring_vertex(rings - 1, segment),
+                                       ring_vertex(rings - 1, segment + 1)});
+    }
+}
+
+// normalized, inside where ax + by + cz + d >= 0, like Object::cull_meshlets makes them
+std::array<std::array<float, 4>, 6> get_planes(const math::matrix &view_proj) {
+    math::matrix columns = math::transpose(view_proj);
+    math::vector x = columns.r[0], y = columns.r[1], z = columns.r[2], w = columns.r[3];
+    math::vector planes[] = {math::add(w, x),      math::subtract(w, x), math::add(w, y),
+                             math::subtract(w, y), z,                    math::subtract(w, z)};
+    std::array<std::array<float, 4>, 6> result;
+    for (unsigned int i = 0; i < 6; i++) {
+        math::float4 plane;
+        math::store(plane, math::scale(planes[i], 1 / math::length3(planes[i])));
+        result[i] = {plane.x, plane.y, plane.z, plane.w};
+    }
+    return result;
+}
+
+// front facing and not wholly outside one of the planes
+bool is_visible(const std::array<float, 3> &a, const std::array<float, 3> &b,
+                const std::array<float, 3> &c, const std::array<std::array<float, 4>, 6> &planes,
+                const std::array<float, 3> &camera_position) {
+    std::array<float, 3> e1 = subtract(b, a), e2 = subtract(c, a);
+    std::array<float, 3> normal = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+                                   e1[0] * e2[1] - e1[1] * e2[0]};
+    if (dot(normal, subtract(a, camera_position)) >= 0) {
+        return false;
+    }
+    for (const std::array<float, 4> &plane : planes) {
+        std::array<float, 3> inward = {plane[0], plane[1], plane[2]};
+        if (dot(inward, a) + plane[3] < 0 && dot(inward, b) + plane[3] < 0
+            && dot(inward, c) + plane[3] < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+std::string benchmark_meshlets(unsigned int view_count) {
+    using namespace mesh_optimizer;
+
+    std::vector<std::array<float, 3>> positions;
+    std::vector<unsigned int> indices;
+    make_rock(positions, indices);
+    unsigned int vertex_count = static_cast<unsigned int>(positions.size());
+    std::vector<unsigned int> cluster_starts;
+    indices = optimize_vertex_cache(indices, vertex_count, cluster_starts);
+    indices = optimize_overdraw(indices, positions, cluster_starts);
+    positions = remap_vertices(positions, optimize_vertex_fetch(indices, vertex_count));
+    unsigned int index_count = static_cast<unsigned int>(indices.size());
+    std::vector<unsigned int> groups(positions.size(), 0);
+
+    auto start_point = std::chrono::high_resolution_clock::now();
+    std::vector<meshlet::meshlet_t> meshlets =
+        meshlet::build(indices, 0, index_count, positions, groups);
+    double build_microseconds = microseconds_since(start_point);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distance(1.2f * rock_radius, 6 * rock_radius);
+    std::uniform_real_distribution<float> angle(-math::pi, math::pi);
+    // off the center by up to about half the field of view, so the frustum cuts the rock
+    std::uniform_real_distribution<float> look_off(-0.5f, 0.5f);
+    math::matrix proj = math::perspective_fov_lh(0.8f, 1.5f, 0.1f, 1'000);
+
+    meshlet::cull_statistics statistics;
+    std::vector<unsigned int> output(indices.size());
+    std::vector<meshlet::meshlet_t> single(1);
+    std::vector<unsigned int> single_output(meshlet::max_triangles * 3);
+    std::uint64_t kept = 0, visible = 0, hidden_kept = 0, visible_dropped = 0, mismatches = 0;
+    for (unsigned int view = 0; view < view_count; view++) {
+        float pitch = angle(generator) / 2, yaw = angle(generator), away = distance(generator);
+        std::array<float, 3> camera_position = {
+            -away * std::cos(pitch) * std::sin(yaw), away * std::sin(pitch),
+            -away * std::cos(pitch) * std::cos(yaw)};
+        // the camera looks down its z, turned to the rock and then a little off it
+        math::matrix world = math::multiply(
+            math::multiply(math::rotation_x(pitch + look_off(generator)),
+                           math::rotation_y(yaw + look_off(generator))),
+            math::translation(camera_position[0], camera_position[1], camera_position[2]));
+        std::array<std::array<float, 4>, 6> planes =
+            get_planes(math::multiply(math::inverse(world), proj));
+
+        unsigned int written = meshlet::cull(meshlets, indices, planes, camera_position, 0,
+                                             output.data(), statistics);
+        kept += written / 3;
+
+        // culled one at a time to know which were kept
+        unsigned int single_written = 0;
+        meshlet::cull_statistics single_statistics;
+        for (const meshlet::meshlet_t &m : meshlets) {
+            single[0] = m;
+            bool was_kept = meshlet::cull(single, indices, planes, camera_position, 0,
+                                          single_output.data(), single_statistics)
+                            > 0;
+            single_written += was_kept ? m.index_count : 0;
+            for (unsigned int i = m.first_index; i < m.first_index + m.index_count; i += 3) {
+                bool is = is_visible(positions[indices[i]], positions[indices[i + 1]],
+                                     positions[indices[i + 2]], planes, camera_position);
+                visible += is;
+                hidden_kept += was_kept && !is;
+                visible_dropped += !was_kept && is;
+            }
+        }
+        mismatches += single_written != written;
+    }
+
+    std::stringstream s;
+    s << "meshlets: " << index_count / 3 << " triangles, " << meshlets.size() << " meshlets of "
+      << index_count / 3.0 / meshlets.size() << " triangles mean, built in "
+      << build_microseconds / 1'000 << " ms\n";
+    s << "meshlets: " << view_count << " views, cull " << statistics.cull_microseconds / view_count
+      << " us mean, " << 100.0 * statistics.frustum_culled / statistics.total
+      << "% frustum culled, " << 100.0 * statistics.backface_culled / statistics.total
+      << "% backface culled, " << kept / view_count << " triangles kept a view\n";
+    s << "meshlets: " << visible / view_count << " triangles visible a view, "
+      << 100.0 * hidden_kept / kept << "% of the kept ones hidden, " << visible_dropped
+      << " visible triangles dropped, " << mismatches << " views culled differently alone\n";
+    return s.str();
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include <string>
+
+// a lumpy rock of about a hundred thousand triangles in the order Mesh leaves them, seen from
+// view_count random cameras around it: how long meshlet::build takes and how many meshlets it
+// makes, how long meshlet::cull takes and how much it culls, and against testing every triangle
+// on its own, the triangles it kept that were hidden and the visible ones it dropped, one line each
+std::string benchmark_meshlets(unsigned int view_count);
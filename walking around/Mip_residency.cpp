@@ -0,0 +1,206 @@
+#include "Mip_residency.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+void Local_gpu_memory::init(std::uint64_t _budget) {
+    budget = _budget;
+    usage = 0;
+    allocations.clear();
+}
+
+bool Local_gpu_memory::allocate(unsigned int texture, unsigned int mip, std::uint64_t size) {
+    if (usage + size > budget) {
+        return false;
+    }
+    if (!allocations.try_emplace({texture, mip}, size).second) {
+        throw std::runtime_error("the mip is already allocated");
+    }
+    usage += size;
+    return true;
+}
+
+void Local_gpu_memory::release(unsigned int texture, unsigned int mip) {
+    auto it = allocations.find({texture, mip});
+    if (it == allocations.end()) {
+        throw std::runtime_error("the mip isn't allocated");
+    }
+    usage -= it->second;
+    allocations.erase(it);
+}
+
+std::uint64_t Local_gpu_memory::get_usage() const {
+    return usage;
+}
+
+std::uint64_t Local_gpu_memory::get_budget() const {
+    return budget;
+}
+
+unsigned int Mip_residency::get_desired_mip(const texture_t &texture) {
+    float lod = (std::max)(texture.wanted_lod, 0.0f);
+    if (lod >= texture.desc.tail_mip) {
+        return texture.desc.tail_mip;
+    }
+    return static_cast<unsigned int>(std::floor(lod));
+}
+
+bool Mip_residency::evict(unsigned int requester, float priority,
+                          std::vector<mip_t> &evictions) {
+    unsigned int victim = 0;
+    bool found = false, victim_unused = false;
+
+    for (unsigned int i = 0; i < textures.size(); i++) {
+        const texture_t &texture = textures[i];
+        if (i == requester || texture.loading || texture.resident_mip >= texture.desc.tail_mip) {
+            continue;
+        }
+        bool unused = get_desired_mip(texture) > texture.resident_mip;
+        if (!unused && texture.priority >= priority) {
+            continue;
+        }
+
+        bool better;
+        if (!found || unused != victim_unused) {
+            better = !found || unused;
+        } else if (unused) {
+            better = texture.last_used < textures[victim].last_used;
+        } else {
+            better = texture.priority < textures[victim].priority;
+        }
+        if (better) {
+            victim = i;
+            victim_unused = unused;
+            found = true;
+        }
+    }
+    if (!found) {
+        return false;
+    }
+
+    texture_t &texture = textures[victim];
+    memory->release(victim, texture.resident_mip);
+    evictions.push_back({victim, texture.resident_mip});
+    texture.resident_mip++;
+    statistics.evictions++;
+    return true;
+}
+
+void Mip_residency::init(Gpu_memory &_memory, const std::vector<texture_desc_t> &descs,
+                         unsigned int _max_loads_in_flight) {
+    memory = &_memory;
+    max_loads_in_flight = _max_loads_in_flight;
+    textures.clear();
+    statistics = {};
+    frame = 0;
+
+    for (unsigned int i = 0; i < descs.size(); i++) {
+        const texture_desc_t &desc = descs[i];
+        if (desc.mip_sizes.size() <= desc.tail_mip) {
+            throw std::runtime_error("the texture has no size for its mip tail");
+        }
+        if (!memory->allocate(i, desc.tail_mip, desc.mip_sizes[desc.tail_mip])) {
+            throw std::runtime_error("the mip tails don't fit the texture budget");
+        }
+        textures.push_back({.desc = desc,
+                            .resident_mip = desc.tail_mip,
+                            .loading = false,
+                            .wanted_lod = std::numeric_limits<float>::infinity(),
+                            .priority = 0,
+                            .last_used = 0});
+    }
+}
+
+void Mip_residency::want(unsigned int texture, float lod, float priority) {
+    texture_t &wanted = textures.at(texture);
+    wanted.wanted_lod = (std::min)(wanted.wanted_lod, lod);
+    wanted.priority = (std::max)(wanted.priority, priority);
+}
+
+Mip_residency::changes_t Mip_residency::update() {
+    changes_t changes;
+    frame++;
+
+    std::vector<unsigned int> candidates;
+    for (unsigned int i = 0; i < textures.size(); i++) {
+        texture_t &texture = textures[i];
+        unsigned int desired_mip = get_desired_mip(texture);
+        if (desired_mip <= texture.resident_mip) {
+            texture.last_used = frame;
+        }
+        if (!texture.loading && desired_mip < texture.resident_mip) {
+            candidates.push_back(i);
+        }
+    }
+
+    // one mip at a time, so the biggest textures on screen sharpen first
+    std::stable_sort(candidates.begin(), candidates.end(), [&](unsigned int a, unsigned int b) {
+        return textures[a].priority > textures[b].priority;
+    });
+
+    for (unsigned int candidate : candidates) {
+        if (statistics.loads_in_flight >= max_loads_in_flight) {
+            break;
+        }
+        texture_t &texture = textures[candidate];
+        unsigned int mip = texture.resident_mip - 1;
+
+        bool allocated = false;
+        while (!(allocated = memory->allocate(candidate, mip, texture.desc.mip_sizes[mip]))) {
+            if (!evict(candidate, texture.priority, changes.evictions)) {
+                break;
+            }
+        }
+        if (!allocated) {
+            // lower priorities won't find anything to evict either
+            break;
+        }
+
+        texture.loading = true;
+        changes.loads.push_back({candidate, mip});
+        statistics.loads_in_flight++;
+    }
+
+    for (texture_t &texture : textures) {
+        texture.wanted_lod = std::numeric_limits<float>::infinity();
+        texture.priority = 0;
+    }
+    return changes;
+}
+
+void Mip_residency::finish_load(unsigned int texture) {
+    texture_t &loaded = textures.at(texture);
+    if (!loaded.loading) {
+        throw std::runtime_error("the texture has no load in flight");
+    }
+    loaded.loading = false;
+    loaded.resident_mip--;
+    loaded.last_used = frame;
+    statistics.loads_in_flight--;
+    statistics.loads++;
+}
+
+unsigned int Mip_residency::get_resident_mip(unsigned int texture) {
+    return textures.at(texture).resident_mip;
+}
+
+const Mip_residency::statistics_t &Mip_residency::get_statistics() {
+    return statistics;
+}
+
+std::vector<std::uint64_t> Mip_residency::get_mip_sizes(unsigned int width, unsigned int height,
+                                                        unsigned int pixel_size,
+                                                        unsigned int tail_mip) {
+    std::vector<std::uint64_t> sizes(tail_mip + 1, 0);
+    for (unsigned int mip = 0;; mip++) {
+        std::uint64_t size = std::uint64_t((std::max)(width >> mip, 1u))
+                             * (std::max)(height >> mip, 1u) * pixel_size;
+        sizes[(std::min)(mip, tail_mip)] += size;
+        if ((width >> mip) <= 1 && (height >> mip) <= 1) {
+            break;
+        }
+    }
+    return sizes;
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+// where mip levels live, allocations are per texture and mip
+class Gpu_memory {
+    public:
+        virtual ~Gpu_memory() = default;
+
+        // false when size would go over the budget
+        virtual bool allocate(unsigned int texture, unsigned int mip, std::uint64_t size) = 0;
+
+        virtual void release(unsigned int texture, unsigned int mip) = 0;
+
+        virtual std::uint64_t get_usage() const = 0;
+
+        virtual std::uint64_t get_budget() const = 0;
+};
+
+// only counts bytes, stands in for video memory where there is no GPU
+class Local_gpu_memory : public Gpu_memory {
+    private:
+        std::uint64_t budget = 0;
+        std::uint64_t usage = 0;
+        std::map<std::pair<unsigned int, unsigned int>, std::uint64_t> allocations;
+
+    public:
+        void init(std::uint64_t _budget);
+
+        bool allocate(unsigned int texture, unsigned int mip, std::uint64_t size) override;
+
+        void release(unsigned int texture, unsigned int mip) override;
+
+        std::uint64_t get_usage() const override;
+
+        std::uint64_t get_budget() const override;
+};
+
+// decides which mips of which textures are resident under the memory's budget,
+// every texture keeps the mips from its resident mip down to the coarsest one
+class Mip_residency {
+    public:
+        struct texture_desc_t {
+            public:
+                // bytes of every mip, mip_sizes[tail_mip] covers all the coarser ones too
+                std::vector<std::uint64_t> mip_sizes;
+                // the coarsest mips, resident from init() on
+                unsigned int tail_mip;
+        };
+
+        struct mip_t {
+            public:
+                unsigned int texture;
+                unsigned int mip;
+        };
+
+        struct changes_t {
+            public:
+                // memory is already allocated, finish_load() makes them resident
+                std::vector<mip_t> loads;
+                // released already, the mips must no longer be sampled
+                std::vector<mip_t> evictions;
+        };
+
+        struct statistics_t {
+            public:
+                unsigned int loads_in_flight = 0;
+                unsigned int loads = 0;
+                unsigned int evictions = 0;
+        };
+
+    private:
+        struct texture_t {
+            public:
+                texture_desc_t desc;
+                unsigned int resident_mip;
+                bool loading = false;
+                // what this frame's want() calls asked for
+                float wanted_lod;
+                float priority;
+                // the last frame the finest resident mip was wanted
+                std::uint64_t last_used = 0;
+        };
+
+        Gpu_memory *memory = nullptr;
+        std::vector<texture_t> textures;
+        unsigned int max_loads_in_flight = 0;
+        std::uint64_t frame = 0;
+        statistics_t statistics;
+
+        unsigned int get_desired_mip(const texture_t &texture);
+
+        // frees the finest mip of the texture that is needed least, unused ones go first
+        // in least recently used order, then ones wanted less than priority,
+        // false when there is nothing to evict
+        bool evict(unsigned int requester, float priority, std::vector<mip_t> &evictions);
+
+    public:
+        // allocates the mip tails, throws when they don't fit the budget
+        void init(Gpu_memory &_memory, const std::vector<texture_desc_t> &descs,
+                  unsigned int _max_loads_in_flight);
+
+        // lod is log2 of texels per screen pixel, priority is how big the texture is on
+        // screen, several calls a frame keep the finest lod and the highest priority
+        void want(unsigned int texture, float lod, float priority);
+
+        // after the frame's want() calls, textures that weren't wanted drop to their tail
+        // when memory is needed
+        changes_t update();
+
+        // the load update() asked for is done
+        void finish_load(unsigned int texture);
+
+        unsigned int get_resident_mip(unsigned int texture);
+
+        const statistics_t &get_statistics();
+
+        // sizes of an uncompressed mip chain, for textures not placed by the GPU
+        static std::vector<std::uint64_t> get_mip_sizes(unsigned int width, unsigned int height,
+                                                        unsigned int pixel_size,
+                                                        unsigned int tail_mip);
+};
@@ -0,0 +1,186 @@
+#include "Mip_residency_benchmark.hpp"
+#include "Mip_residency.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int frame_count = 2'000;
+constexpr unsigned int max_loads_in_flight = 4;
+constexpr unsigned int load_frames = 3;
+constexpr unsigned int pixel_size = 4;
+// the mips of 32x32 and coarser are the tail
+constexpr unsigned int tail_side = 32;
+constexpr float spacing = 4, view_distance = 120;
+// closer than this the finest mip is wanted
+constexpr float sharp_distance = 2;
+constexpr float walk_speed = 2;
+
+double microseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end_point - start_point).count();
+}
+
+// as Mip_residency picks it
+unsigned int get_desired_mip(float lod, unsigned int tail_mip) {
+    lod = (std::max)(lod, 0.0f);
+    return lod >= tail_mip ? tail_mip : static_cast<unsigned int>(std::floor(lod));
+}
+
+// what the policy is checked against, kept alongside Mip_residency from the same calls
+struct model_t {
+    public:
+        std::vector<Mip_residency::texture_desc_t> descs;
+        std::vector<unsigned int> resident;
+        std::vector<char> loading;
+        std::vector<std::uint64_t> last_used;
+        std::uint64_t frame = 0;
+
+        // the resident mips and the ones being loaded
+        std::uint64_t get_usage() const {
+            std::uint64_t usage = 0;
+            for (std::size_t i = 0; i < descs.size(); i++) {
+                for (unsigned int mip = resident[i]; mip <= descs[i].tail_mip; mip++) {
+                    usage += descs[i].mip_sizes[mip];
+                }
+                usage += loading[i] ? descs[i].mip_sizes[resident[i] - 1] : 0;
+            }
+            return usage;
+        }
+};
+} // namespace
+
+std::string benchmark_mip_residency(unsigned int texture_count) {
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<unsigned int> size_shift(1, 5);
+    model_t model;
+    std::uint64_t tails = 0, everything = 0;
+    for (unsigned int i = 0; i < texture_count; i++) {
+        unsigned int shift = size_shift(generator);
+        unsigned int side = tail_side << shift;
+        model.descs.push_back({Mip_residency::get_mip_sizes(side, side, pixel_size, shift), shift});
+        tails += model.descs.back().mip_sizes[shift];
+        for (std::uint64_t size : model.descs.back().mip_sizes) {
+            everything += size;
+        }
+    }
+    std::uint64_t budget = tails + (everything - tails) / 4;
+    Local_gpu_memory memory;
+    memory.init(budget);
+    Mip_residency residency;
+    residency.init(memory, model.descs, max_loads_in_flight);
+    for (const Mip_residency::texture_desc_t &desc : model.descs) {
+        model.resident.push_back(desc.tail_mip);
+    }
+    model.loading.assign(texture_count, false);
+    model.last_used.assign(texture_count, 0);
+
+    struct load_t {
+        public:
+            unsigned int texture;
+            unsigned int done_frame;
+    };
+    std::deque<load_t> loads;
+    std::vector<float> lods(texture_count), priorities(texture_count);
+    std::vector<unsigned int> candidates;
+    unsigned int usage_off = 0, out_of_order = 0, out_of_lru = 0;
+    std::uint64_t max_usage = 0;
+    double total_microseconds = 0, max_microseconds = 0;
+    float row_length = texture_count * spacing;
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        for (; !loads.empty() && loads.front().done_frame <= frame; loads.pop_front()) {
+            unsigned int texture = loads.front().texture;
+            residency.finish_load(texture);
+            model.loading[texture] = false;
+            model.resident[texture]--;
+            model.last_used[texture] = model.frame;
+        }
+
+        float walked = std::fmod(frame * walk_speed, 2 * row_length);
+        float camera = walked < row_length ? walked : 2 * row_length - walked;
+        for (unsigned int i = 0; i < texture_count; i++) {
+            float distance = std::abs(i * spacing - camera);
+            lods[i] = std::numeric_limits<float>::infinity();
+            priorities[i] = 0;
+            if (distance <= view_distance) {
+                lods[i] = std::log2((distance + 1) / sharp_distance);
+                priorities[i] = 1 / (distance + 1);
+                residency.want(i, lods[i], priorities[i]);
+            }
+        }
+
+        model.frame++;
+        candidates.clear();
+        for (unsigned int i = 0; i < texture_count; i++) {
+            unsigned int desired = get_desired_mip(lods[i], model.descs[i].tail_mip);
+            if (desired <= model.resident[i]) {
+                model.last_used[i] = model.frame;
+            }
+            if (!model.loading[i] && desired < model.resident[i]) {
+                candidates.push_back(i);
+            }
+        }
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [&](unsigned int a, unsigned int b) {
+                             return priorities[a] > priorities[b];
+                         });
+
+        auto start_point = std::chrono::high_resolution_clock::now();
+        Mip_residency::changes_t changes = residency.update();
+        double microseconds = microseconds_since(start_point);
+        total_microseconds += microseconds;
+        max_microseconds = (std::max)(max_microseconds, microseconds);
+
+        // the loads go down the candidates from the highest priority, one mip each
+        for (std::size_t i = 0; i < changes.loads.size(); i++) {
+            const Mip_residency::mip_t &load = changes.loads[i];
+            out_of_order += i >= candidates.size()
+                            || priorities[load.texture] != priorities[candidates[i]]
+                            || load.mip + 1 != model.resident[load.texture];
+        }
+
+        // the unused mips go first, the least recently used of them first
+        for (const Mip_residency::mip_t &eviction : changes.evictions) {
+            unsigned int victim = eviction.texture;
+            auto unused = [&](unsigned int i) {
+                return !model.loading[i] && model.resident[i] < model.descs[i].tail_mip
+                       && get_desired_mip(lods[i], model.descs[i].tail_mip) > model.resident[i];
+            };
+            bool victim_unused = unused(victim);
+            bool in_order = !model.loading[victim] && eviction.mip == model.resident[victim]
+                            && eviction.mip < model.descs[victim].tail_mip;
+            for (unsigned int i = 0; i < texture_count && in_order; i++) {
+                if (i != victim && unused(i)) {
+                    in_order = victim_unused && model.last_used[victim] <= model.last_used[i];
+                }
+            }
+            out_of_lru += !in_order;
+            model.resident[victim]++;
+        }
+        for (const Mip_residency::mip_t &load : changes.loads) {
+            model.loading[load.texture] = true;
+            loads.push_back({load.texture, frame + load_frames});
+        }
+
+        std::uint64_t usage = memory.get_usage();
+        usage_off += usage > memory.get_budget() || usage != model.get_usage();
+        max_usage = (std::max)(max_usage, usage);
+    }
+
+    const Mip_residency::statistics_t &statistics = residency.get_statistics();
+    std::stringstream s;
+    s << "mip residency: " << texture_count << " textures, " << frame_count << " frames, "
+      << statistics.loads << " loads, " << statistics.evictions << " evictions, at most "
+      << (max_usage >> 10) << " of " << (budget >> 10) << " KB, update "
+      << total_microseconds / frame_count << " us mean, " << max_microseconds << " us max\n";
+    s << "mip residency: " << usage_off << " frames over the budget or off the mips, "
+      << out_of_order << " loads out of priority order, " << out_of_lru
+      << " evictions out of least recently used order\n";
+    return s.str();
+}
@@ -0,0 +1,10 @@
+#pragma once
+#include <string>
+
+// texture_count textures of random sizes in a row beside a walk there and back, wanted by how
+// far they are, under a Local_gpu_memory budget that holds about a quarter of their finer mips,
+// with the loads finishing a few frames after they start: how long update() takes, and against
+// a model of the policy, the frames the memory's usage was over the budget or off the resident
+// and loading mips, the loads out of priority order and the evictions that didn't take the
+// least recently used unused mip first, one line each
+std::string benchmark_mip_residency(unsigned int texture_count);
@@ -1,132 +1,146 @@
 #include "Object.hpp"
 
-#include <fstream>
-#include <sstream>
-#include <algorithm>
-#include <array>
-
 const std::array<float, 3> &Object::get_pivot(unsigned int id) {
-    return id_to_pivot_point[id];
+    return mesh->get_pivot(id);
+}
+
+const Asset_cache<Mesh>::handle_t &Object::get_mesh() {
+    return mesh;
+}
+
+const std::map<unsigned int, Aabb_tree::box_t> &Object::get_group_bounds() {
+    return mesh->get_group_bounds();
+}
+
+const Mesh::collision_mesh_t &Object::get_collision_mesh() {
+    return mesh->get_collision_mesh();
 }
 
-void Object::init(ComPtr<ID3D12Device> &device, Texture_loader &texture_loader,
-                         PCWSTR texture_filename, PCWSTR obj_filename,
-                         const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
-                         const D3D12_GPU_DESCRIPTOR_HANDLE &gpu_handle, Id_giver &id_giver) {
-    texture = texture_loader.load_texture(device, texture_filename, cpu_handle, gpu_handle);
-
-    std::vector<std::array<float, 3>> vertex_coords;
-    std::vector<unsigned int> vertex_groups;
-    std::vector<bool> is_pivot;
-    std::vector<std::array<float, 3>> normals;
-    std::vector<std::array<float, 2>> tex_coords;
-
-
-    std::string current_object_name;
-    std::string current_group_name = "off";
-
-    unsigned int off_gid = Id_giver::no_id;
-
-    std::ifstream obj_file(obj_filename);
-    std::string current_line;
-    while (std::getline(obj_file, current_line)) {
-        std::replace(current_line.begin(), current_line.end(), '/', ' ');
-        std::stringstream line_stream(current_line);
-        std::string current_token;
-        line_stream >> current_token;
-        if (current_token == "v") {
-            std::array<float, 3> coords;
-            line_stream >> coords[0] >> coords[1] >> coords[2];
-            vertex_coords.push_back(coords);
-            vertex_groups.push_back(Id_giver::no_id); // unused id
-            is_pivot.push_back(false);
-        } else if (current_token == "vt") {
-            std::array<float, 2> coords;
-            line_stream >> coords[0] >> coords[1];
-            tex_coords.push_back(coords);
-        } else if (current_token == "vn") {
-            std::array<float, 3> coords;
-            line_stream >> coords[0] >> coords[1] >> coords[2];
-            normals.push_back(coords);
-        } else if (current_token == "f") {
-            unsigned int current_gid =
-                id_giver.get_id(current_object_name + "." + current_group_name);
-
-
-            for (unsigned int i = 0; i < 3; i++) {
-                vertex_t current_vertex;
-                unsigned int v_index, vt_index, vn_index;
-                line_stream >> v_index >> vt_index >> vn_index;
-                if (vertex_groups[v_index - 1] != Id_giver::no_id
-                    && vertex_groups[v_index - 1] != current_gid) {
-                    is_pivot[v_index - 1] = true;
-                }
-                if (vertex_groups[v_index - 1] == Id_giver::no_id || current_gid != off_gid) {
-                    vertex_groups[v_index - 1] = current_gid;
-                }
-            }
-        } else if (current_token == "o") {
-            line_stream >> current_object_name;
-            off_gid = id_giver.get_id(current_object_name + ".off");
-        } else if (current_token == "g") {
-            line_stream >> current_group_name;
+unsigned int Object::get_off_id() {
+    return mesh->get_off_id();
+}
+
+math::float4 Object::get_bounding_sphere() {
+    return mesh->get_bounding_sphere();
+}
+
+void Object::select_lod(float pixels_per_unit) {
+    const std::vector<Mesh::lod_t> &lods = mesh->get_lods();
+    current_lod = 0;
+    for (unsigned int i = 1; i < lods.size(); i++) {
+        if (lods[i].error * pixels_per_unit <= max_lod_error_pixels) {
+            current_lod = i;
         }
     }
-    obj_file.clear();
-    obj_file.seekg(0, std::ios::beg);
-
-    std::vector<vertex_t> vertices;
-
-    while (std::getline(obj_file, current_line)) {
-
-        std::replace(current_line.begin(), current_line.end(), '/', ' ');
-        std::stringstream line_stream(current_line);
-        std::string current_token;
-        line_stream >> current_token;
-
-        if (current_token == "f") {
-            for (unsigned int i = 0; i < 3; i++) {
-                vertex_t current_vertex;
-                unsigned int v_index, vt_index, vn_index;
-                line_stream >> v_index >> vt_index >> vn_index;
-                std::array<float, 3> &coords = vertex_coords[v_index - 1];
-                std::array<float, 3> &normal = normals[vn_index - 1];
-                std::array<float, 2> &tex = tex_coords[vt_index - 1];
-                std::copy(coords.begin(), coords.end(), current_vertex.position);
-                std::copy(normal.begin(), normal.end(), current_vertex.normal);
-                std::copy(tex.begin(), tex.end(), current_vertex.tex_coord);
-
-                current_vertex.mat_index = vertex_groups[v_index - 1];
-
-                vertices.push_back(current_vertex);
-            }
-        }
+}
+
+void Object::cull_meshlets(const math::matrix &world, const math::matrix &view_proj,
+                           math::vector camera_position, meshlet::cull_statistics &statistics) {
+    const std::vector<std::vector<meshlet::meshlet_t>> &lod_meshlets = mesh->get_lod_meshlets();
+    if (lod_meshlets.empty()) {
+        return;
     }
-    vertex_buffer.init(device, vertices);
 
-    std::map<unsigned int, unsigned int> id_to_num_pivot_points;
-    for (unsigned int i = 0; i < vertex_coords.size(); i++) {
+    // frustum planes in object space, taken from the columns of world * view * proj
+    math::matrix columns = math::transpose(math::multiply(world, view_proj));
+    math::vector plane_vectors[6] = {
+        math::add(columns.r[3], columns.r[0]),
+        math::subtract(columns.r[3], columns.r[0]),
+        math::add(columns.r[3], columns.r[1]),
+        math::subtract(columns.r[3], columns.r[1]),
+        columns.r[2],
+        math::subtract(columns.r[3], columns.r[2]),
+    };
+    std::array<std::array<float, 4>, 6> planes;
+    for (unsigned int i = 0; i < 6; i++) {
+        // normalize3 divides w by the normal's length too, like XMPlaneNormalize
+        math::float4 plane;
+        math::store(plane, math::normalize3(plane_vectors[i]));
+        planes[i] = {plane.x, plane.y, plane.z, plane.w};
+    }
 
-        if (!is_pivot[i]) {
-            continue;
-        }
-        id_to_num_pivot_points[vertex_groups[i]]++;
-        std::array<float, 3> &sum_array = id_to_pivot_point[vertex_groups[i]];
-        for (unsigned int j = 0; j < 3; j++) {
-            sum_array[j] += vertex_coords[i][j];
-        }
+    math::float3 camera;
+    math::store(camera, math::transform3(camera_position, math::inverse(world)));
+    std::array<float, 3> object_camera_position = {camera.x, camera.y, camera.z};
+
+    unsigned int index_count =
+        meshlet::cull(lod_meshlets[current_lod], mesh->get_cpu_indices(), planes,
+                      object_camera_position, mesh->get_off_id(), culled_index_buffer.data(),
+                      statistics);
+    culled_index_buffer.set_index_count(index_count);
+    use_culled_indices = true;
+}
+
+void Object::init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                  Asset_cache<Mesh> &mesh_cache, PCWSTR obj_filename,
+                  const D3D12_GPU_DESCRIPTOR_HANDLE &texture_handle,
+                  const texture_packer::placement_t &placement, Id_giver &id_giver) {
+    swap_mesh(load_mesh(device, upload_batch, mesh_cache, obj_filename, texture_handle, placement,
+                        id_giver));
+}
+
+Object::loaded_mesh_t Object::load_mesh(ComPtr<ID3D12Device> &device,
+                                        Upload_batch &upload_batch,
+                                        Asset_cache<Mesh> &mesh_cache, PCWSTR obj_filename,
+                                        const D3D12_GPU_DESCRIPTOR_HANDLE &texture_handle,
+                                        const texture_packer::placement_t &placement,
+                                        Id_giver &id_giver) {
+    // the placement and texture are baked into the vertices, so they are part of the key
+    std::uint64_t variant = Asset_cache<Mesh>::hash(&placement, sizeof(placement),
+                                                    texture_handle.ptr);
+    loaded_mesh_t loaded;
+    loaded.mesh = mesh_cache.get(obj_filename, variant,
+                                 [&](Mesh &mesh, const std::vector<char> &contents) {
+                                     mesh.init(device, upload_batch, contents, obj_filename,
+                                               texture_handle, placement, id_giver);
+                                 });
+
+    if (!loaded.mesh->get_lod_meshlets().empty()) {
+        loaded.culled_index_buffer.init_dynamic(device, loaded.mesh->get_lods()[0].index_count);
     }
+    return loaded;
+}
+
+Object::loaded_mesh_t Object::swap_mesh(loaded_mesh_t loaded) {
+    std::swap(mesh, loaded.mesh);
+    std::swap(culled_index_buffer, loaded.culled_index_buffer);
+    // the new mesh may have fewer lods, select_lod() and cull_meshlets() run before drawing
+    current_lod = 0;
+    use_culled_indices = false;
+    return loaded;
+}
+
+Render_queue::draw_t Object::get_draw(ID3D12PipelineState *pipeline_state) {
+    const Mesh::lod_t &lod = mesh->get_lods()[current_lod];
+    Render_queue::draw_t draw = {.pipeline_state = pipeline_state,
+                                 .texture = mesh->get_texture_handle(),
+                                 .vertex_buffer = &mesh->get_vertex_buffer_view(),
+                                 .index_buffer = &mesh->get_index_buffer_view(),
+                                 .root_constants = nullptr,
+                                 .root_constant_count = 0,
+                                 .index_count = lod.index_count,
+                                 .first_index = lod.first_index};
+#ifdef PACKED_VERTICES
+    draw.root_constants = &mesh->get_bounds();
+    draw.root_constant_count = sizeof(mesh_bounds_t) / 4;
+#endif
+    return draw;
+}
 
-    for (const auto &[id, num] : id_to_num_pivot_points) {
-        std::array<float, 3> &sum_array = id_to_pivot_point[id];
-        for (unsigned int j = 0; j < 3; j++) {
-            sum_array[j] /= num;
+void Object::submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                    float depth) {
+    Render_queue::draw_t draw = get_draw(pipeline_state);
+    if (use_culled_indices) {
+        if (culled_index_buffer.get_index_count() == 0) {
+            return;
         }
+        draw.index_buffer = &culled_index_buffer.get_view();
+        draw.index_count = culled_index_buffer.get_index_count();
+        draw.first_index = 0;
     }
+    render_queue.submit(draw, depth);
 }
 
-void Object::draw(ComPtr<ID3D12GraphicsCommandList> &command_list) {
-    texture.use(command_list, 1); // 1 is the texture argument number
-    command_list->IASetVertexBuffers(0, 1, &vertex_buffer.get_view());
-    command_list->DrawInstanced(vertex_buffer.get_vertex_count(), 1, 0, 0);
+void Object::submit_caster(Render_queue &render_queue, ID3D12PipelineState *pipeline_state) {
+    render_queue.submit(get_draw(pipeline_state), 0);
 }
@@ -1,35 +1,87 @@
 #pragma once
 #include "Windows_includes.hpp"
-#include "Texture.hpp"
-#include "Texture_loader.hpp"
+#include "Upload_batch.hpp"
+#include "Texture_packer.hpp"
 #include "Id_giver.hpp"
-#include "Vertex_buffer.hpp"
-#include <map>
+#include "Index_buffer.hpp"
+#include "Mesh.hpp"
+#include "Asset_cache.hpp"
+#include "Meshlet.hpp"
+#include "Render_queue.hpp"
 #include <array>
 
+// one placed mesh, the mesh itself is shared through the cache with every Object using it
 class Object {
     private:
-        struct vertex_t {
-            public:
-                FLOAT position[3];
-                FLOAT normal[3];
-                FLOAT tex_coord[2];
-                UINT mat_index;
-        };
+        Asset_cache<Mesh>::handle_t mesh;
+
+        unsigned int current_lod = 0;
+
+        constexpr static float max_lod_error_pixels = 1.0f;
 
-        Texture texture;
-        Vertex_buffer vertex_buffer;
+        // large meshes are drawn from culled_index_buffer, filled every frame with the meshlets
+        // of the current lod that survive culling
+        Index_buffer culled_index_buffer;
+        bool use_culled_indices = false;
 
-        std::map<unsigned int, std::array<float, 3>> id_to_pivot_point;
+        // the current lod's draw from the mesh's own indices
+        Render_queue::draw_t get_draw(ID3D12PipelineState *pipeline_state);
 
     public:
+        // what init() loads, the mesh and the culled index buffer sized for it
+        struct loaded_mesh_t {
+            public:
+                Asset_cache<Mesh>::handle_t mesh;
+                Index_buffer culled_index_buffer;
+        };
 
         const std::array<float, 3> &get_pivot(unsigned int id);
 
-        void init(ComPtr<ID3D12Device> &device, Texture_loader &texture_loader,
-                  PCWSTR texture_filename, PCWSTR obj_filename,
-                  const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
-                  const D3D12_GPU_DESCRIPTOR_HANDLE &gpu_handle, Id_giver &id_giver);
+        // shared with everyone loading the same .wobj contents and placement
+        const Asset_cache<Mesh>::handle_t &get_mesh();
+
+        // every group's box in object space, by id
+        const std::map<unsigned int, Aabb_tree::box_t> &get_group_bounds();
+
+        const Mesh::collision_mesh_t &get_collision_mesh();
+
+        // id of the object's off group, which places the whole object
+        unsigned int get_off_id();
+
+        // center and radius in object space
+        math::float4 get_bounding_sphere();
+
+        // picks the coarsest lod that stays within max_lod_error_pixels
+        void select_lod(float pixels_per_unit);
+
+        // world is the off group's transform, camera_position is in world space,
+        // does nothing for meshes too small to have meshlets
+        void cull_meshlets(const math::matrix &world, const math::matrix &view_proj,
+                           math::vector camera_position, meshlet::cull_statistics &statistics);
+
+        // the mesh is loaded through mesh_cache, see Mesh::init(), objects with the same
+        // .wobj contents and placement share it
+        void init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                  Asset_cache<Mesh> &mesh_cache, PCWSTR obj_filename,
+                  const D3D12_GPU_DESCRIPTOR_HANDLE &texture_handle,
+                  const texture_packer::placement_t &placement, Id_giver &id_giver);
+
+        // what init() loads without touching any object, so it can run on another thread
+        // while the objects are drawn
+        static loaded_mesh_t load_mesh(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                                       Asset_cache<Mesh> &mesh_cache, PCWSTR obj_filename,
+                                       const D3D12_GPU_DESCRIPTOR_HANDLE &texture_handle,
+                                       const texture_packer::placement_t &placement,
+                                       Id_giver &id_giver);
+
+        // draws loaded from now on, returns the previous mesh, which the GPU may still be using
+        loaded_mesh_t swap_mesh(loaded_mesh_t loaded);
+
+        // depth is the distance in front of the camera, nothing is submitted when culled away
+        void submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                    float depth);
 
-        void draw(ComPtr<ID3D12GraphicsCommandList> &command_list);
-};
\ No newline at end of file
+        // the whole lod into a shadow cascade's queue, the indices culled for the camera would
+        // leave holes in the shadow
+        void submit_caster(Render_queue &render_queue, ID3D12PipelineState *pipeline_state);
+};
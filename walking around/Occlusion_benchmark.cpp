@@ -0,0 +1,143 @@
+#include "Occlusion_benchmark.hpp"
+#include "Occlusion_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int buffer_width = 256, buffer_height = 128;
+constexpr unsigned int frame_count = 100;
+constexpr float eye_height = 1.7f;
+
+using box_t = Aabb_tree::box_t;
+
+// their near faces at min.z, every one apart from the others on the screen
+constexpr box_t walls[] = {{{-8, 0, 20}, {8, 5, 21}},
+                           {{-30, 0, 30}, {-14, 6, 31}},
+                           {{14, 0, 30}, {30, 6, 31}}};
+
+// the 8 corners and 12 triangles of a box
+void add_box(const box_t &box, std::vector<math::float3> &positions,
+             std::vector<unsigned int> &indices) {
+    unsigned int first = static_cast<unsigned int>(positions.size());
+    for (unsigned int corner = 0; corner < 8; corner++) {
+        positions.push_back({corner & 1 ? box.max.x : box.min.x,
+                             corner & 2 ? box.max.y : box.min.y,
+                             corner & 4 ? box.max.z : box.min.z});
+    }
+    const unsigned int faces[6][4] = {{0, 1, 3, 2}, {4, 6, 7, 5}, {0, 4, 5, 1},
+                                      {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 5, 7, 3}};
+    for (const unsigned int(&face)[4] : faces) {
+        for (unsigned int corner : {face[0], face[1], face[2], face[0], face[2], face[3]}) {
+            indices.push_back(first + corner);
+        }
+    }
+}
+
+// the line from the eye to every corner goes into the wall on the way, the corners' screen
+// points are then inside the wall's outline, which is convex, and so is the whole box
+bool behind(const box_t &box, const box_t &wall) {
+    const float mins[3] = {wall.min.x, wall.min.y - eye_height, wall.min.z};
+    const float maxes[3] = {wall.max.x, wall.max.y - eye_height, wall.max.z};
+    for (unsigned int corner = 0; corner < 8; corner++) {
+        const float to[3] = {corner & 1 ? box.max.x : box.min.x,
+                             (corner & 2 ? box.max.y : box.min.y) - eye_height,
+                             corner & 4 ? box.max.z : box.min.z};
+        // the slabs, along the line from 0 at the eye to 1 at the corner
+        float enter = 0, leave = 1;
+        for (unsigned int axis = 0; axis < 3; axis++) {
+            if (to[axis] == 0) {
+                if (mins[axis] > 0 || maxes[axis] < 0) {
+                    return false;
+                }
+                continue;
+            }
+            float t0 = mins[axis] / to[axis], t1 = maxes[axis] / to[axis];
+            enter = (std::max)(enter, (std::min)(t0, t1));
+            leave = (std::min)(leave, (std::max)(t0, t1));
+        }
+        if (enter > leave || enter >= 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// draws the walls and tests every box, true in visible for the ones that may be seen
+void run_frame(Occlusion_buffer &buffer, const math::matrix &view_proj,
+               const std::vector<math::float3> &positions,
+               const std::vector<unsigned int> &indices, const std::vector<box_t> &boxes,
+               std::vector<char> &visible) {
+    buffer.clear(view_proj);
+    buffer.add_occluder(positions.data(), indices.data(), indices.size(), math::identity());
+    buffer.build_pyramid();
+    visible.resize(boxes.size());
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        visible[i] = buffer.is_visible(boxes[i]);
+    }
+}
+} // namespace
+
+std::string benchmark_occlusion(unsigned int box_count) {
+    std::vector<math::float3> positions;
+    std::vector<unsigned int> indices;
+    for (const box_t &wall : walls) {
+        add_box(wall, positions, indices);
+    }
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> along(-40, 40), ahead(2, 60), size(0.3f, 2),
+        tall(0.3f, 3);
+    std::vector<box_t> boxes(box_count);
+    for (box_t &box : boxes) {
+        float x = along(generator), z = ahead(generator), half = size(generator) / 2;
+        box = {{x - half, 0, z - half}, {x + half, tall(generator), z + half}};
+    }
+
+    math::matrix view_proj =
+        math::multiply(math::translation(0, -eye_height, 0),
+                       math::perspective_fov_lh(math::pi / 4, 2, 0.1f, 100));
+    Occlusion_buffer buffer;
+    buffer.init(buffer_width, buffer_height);
+    std::vector<char> visible;
+    unsigned int triangles = 0;
+    double rasterize_microseconds = 0, test_microseconds = 0;
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        run_frame(buffer, view_proj, positions, indices, boxes, visible);
+        const Occlusion_buffer::statistics_t &statistics = buffer.get_statistics();
+        triangles = statistics.triangles;
+        rasterize_microseconds += statistics.rasterize_microseconds;
+        test_microseconds += statistics.test_microseconds;
+    }
+    std::vector<float> depth = buffer.get_depth();
+
+    unsigned int hidden = 0, culled = 0, wrongly_culled = 0;
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        bool is_hidden = false;
+        for (const box_t &wall : walls) {
+            is_hidden = is_hidden || behind(boxes[i], wall);
+        }
+        hidden += is_hidden;
+        culled += !visible[i];
+        wrongly_culled += !visible[i] && !is_hidden;
+    }
+
+    std::vector<char> second_visible;
+    run_frame(buffer, view_proj, positions, indices, boxes, second_visible);
+    bool same = second_visible == visible
+                && std::memcmp(depth.data(), buffer.get_depth().data(),
+                               depth.size() * sizeof(float))
+                       == 0;
+
+    std::stringstream s;
+    s << "occlusion: " << buffer_width << "x" << buffer_height << " on " << math::backend
+      << ", " << triangles << " occluder triangles drawn with the pyramid in "
+      << rasterize_microseconds / frame_count << " us, " << box_count << " boxes tested in "
+      << test_microseconds / frame_count << " us\n";
+    s << "occlusion: " << culled << " culled of " << hidden << " wholly behind a wall, "
+      << wrongly_culled << " culled that aren't, a second run "
+      << (same ? "gives the same depths and results" : "differs") << "\n";
+    return s.str();
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include <string>
+
+// box_count boxes on the ground in front of a camera with three walls for occluders, none of
+// which overlap on the screen: how long drawing the walls and building the pyramid takes, how
+// many boxes are culled against how many are wholly behind one wall, counting any culled box
+// that isn't, and whether a second run gives the same depths and results, one line each
+std::string benchmark_occlusion(unsigned int box_count);
@@ -0,0 +1,275 @@
+#include "Occlusion_buffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+double microseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end_point - start_point).count();
+}
+
+bool is_power_of_two(unsigned int value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+math::float4 to_float4(math::vector v) {
+    return {math::get_x(v), math::get_y(v), math::get_z(v), math::get_w(v)};
+}
+
+// where the edge from a to b crosses z = 0
+math::float4 near_crossing(const math::float4 &a, const math::float4 &b) {
+    float t = a.z / (a.z - b.z);
+    return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, 0, a.w + (b.w - a.w) * t};
+}
+
+} // namespace
+
+void Occlusion_buffer::rasterize(const screen_vertex_t &a, const screen_vertex_t &b,
+                                 const screen_vertex_t &c) {
+    // twice the signed area, what the edge functions are divided by for the barycentrics
+    float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (area == 0) {
+        return;
+    }
+    // every edge as e(x, y) = ex * x + ey * y + e0, the one opposite a vertex is its weight
+    const screen_vertex_t *corners[3] = {&a, &b, &c};
+    float ex[3], ey[3], e0[3];
+    for (unsigned int i = 0; i < 3; i++) {
+        const screen_vertex_t &p = *corners[(i + 1) % 3], &q = *corners[(i + 2) % 3];
+        ex[i] = (p.y - q.y) / area;
+        ey[i] = (q.x - p.x) / area;
+        e0[i] = (p.x * q.y - p.y * q.x) / area;
+    }
+    // the depth's plane
+    float zx = ex[0] * a.z + ex[1] * b.z + ex[2] * c.z;
+    float zy = ey[0] * a.z + ey[1] * b.z + ey[2] * c.z;
+    float z0 = e0[0] * a.z + e0[1] * b.z + e0[2] * c.z;
+
+    // the pixels whose centers are inside the triangle's bounds
+    float min_y = (std::min)({a.y, b.y, c.y}), max_y = (std::max)({a.y, b.y, c.y});
+    int first_y = (std::max)(static_cast<int>(std::ceil(min_y - 0.5f)), 0);
+    int last_y = (std::min)(static_cast<int>(std::floor(max_y - 0.5f)),
+                            static_cast<int>(height) - 1);
+
+    std::vector<float> &depth = levels[0];
+    for (int y = first_y; y <= last_y; y++) {
+        float center_y = y + 0.5f;
+        float row[3], row_z = zy * center_y + z0;
+        // where the row's pixel centers can be inside every edge, a pixel wider on both sides,
+        // the pixels are still tested one by one in blocks of 4 from a multiple of 4
+        float span_min = 0, span_max = static_cast<float>(width - 1);
+        for (unsigned int i = 0; i < 3; i++) {
+            row[i] = ey[i] * center_y + e0[i];
+            if (ex[i] > 0) {
+                span_min = (std::max)(span_min, -row[i] / ex[i] - 1.5f);
+            } else if (ex[i] < 0) {
+                span_max = (std::min)(span_max, -row[i] / ex[i] + 0.5f);
+            } else if (row[i] < 0) {
+                span_max = -1;
+            }
+        }
+        if (span_min > span_max) {
+            continue;
+        }
+        int first_x = static_cast<int>(span_min) & ~3;
+        int last_x = static_cast<int>(span_max) | 3;
+        float *pixels = &depth[y * width];
+#ifdef MATH_SSE
+        const __m128 lanes = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+        const __m128 zero = _mm_setzero_ps();
+        for (int x = first_x; x <= last_x; x += 4) {
+            __m128 center_x = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lanes);
+            __m128 e[3];
+            for (unsigned int i = 0; i < 3; i++) {
+                e[i] = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(ex[i]), center_x), _mm_set1_ps(row[i]));
+            }
+            __m128 inside = _mm_and_ps(_mm_cmpge_ps(e[0], zero), _mm_cmpge_ps(e[1], zero));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(e[2], zero));
+            if (_mm_movemask_ps(inside) == 0) {
+                continue;
+            }
+            __m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(zx), center_x), _mm_set1_ps(row_z));
+            __m128 old = _mm_loadu_ps(pixels + x);
+            __m128 nearer = _mm_min_ps(old, z);
+            _mm_storeu_ps(pixels + x,
+                          _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, old)));
+        }
+#else
+        for (int x = first_x; x <= last_x; x++) {
+            float center_x = static_cast<float>(x) + 0.5f;
+            bool inside = true;
+            for (unsigned int i = 0; i < 3; i++) {
+                inside = inside && ex[i] * center_x + row[i] >= 0;
+            }
+            if (inside) {
+                pixels[x] = (std::min)(pixels[x], zx * center_x + row_z);
+            }
+        }
+#endif
+    }
+}
+
+void Occlusion_buffer::init(unsigned int _width, unsigned int _height) {
+    if (!is_power_of_two(_width) || !is_power_of_two(_height) || _width < 4) {
+        throw std::runtime_error("the occlusion buffer's sides must be powers of two");
+    }
+    width = _width;
+    height = _height;
+    levels.clear();
+    unsigned int w = width, h = height;
+    levels.emplace_back(w * h, 1.0f);
+    while (w > 1 || h > 1) {
+        w = (std::max)(w / 2, 1u);
+        h = (std::max)(h / 2, 1u);
+        levels.emplace_back(w * h, 1.0f);
+    }
+    statistics = {};
+}
+
+void Occlusion_buffer::clear(const math::matrix &_view_proj) {
+    view_proj = _view_proj;
+    std::fill(levels[0].begin(), levels[0].end(), 1.0f);
+    statistics = {};
+}
+
+void Occlusion_buffer::add_occluder(const math::float3 *positions, const unsigned int *indices,
+                                    std::size_t index_count, const math::matrix &world) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    math::matrix world_view_proj = math::multiply(world, view_proj);
+    for (std::size_t i = 0; i + 2 < index_count; i += 3) {
+        math::float4 clip[3];
+        unsigned int behind = 0;
+        for (unsigned int j = 0; j < 3; j++) {
+            const math::float3 &p = positions[indices[i + j]];
+            clip[j] = to_float4(math::transform3(math::set(p.x, p.y, p.z, 1), world_view_proj));
+            behind += clip[j].z < 0;
+        }
+        if (behind == 3) {
+            continue;
+        }
+        // cut at the near plane into a triangle or a quad
+        math::float4 polygon[4];
+        unsigned int count = 0;
+        for (unsigned int j = 0; j < 3; j++) {
+            const math::float4 &p = clip[j], &q = clip[(j + 1) % 3];
+            if (p.z >= 0) {
+                polygon[count++] = p;
+            }
+            if ((p.z >= 0) != (q.z >= 0)) {
+                polygon[count++] = near_crossing(p, q);
+            }
+        }
+        screen_vertex_t screen[4];
+        for (unsigned int j = 0; j < count; j++) {
+            const math::float4 &p = polygon[j];
+            screen[j] = {(p.x / p.w * 0.5f + 0.5f) * width, (0.5f - p.y / p.w * 0.5f) * height,
+                         p.z / p.w};
+        }
+        for (unsigned int j = 2; j < count; j++) {
+            rasterize(screen[0], screen[j - 1], screen[j]);
+        }
+        statistics.triangles++;
+    }
+    statistics.occluders++;
+    statistics.rasterize_microseconds += microseconds_since(start_point);
+}
+
+void Occlusion_buffer::build_pyramid() {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    unsigned int w = width, h = height;
+    for (std::size_t level = 1; level < levels.size(); level++) {
+        const std::vector<float> &below = levels[level - 1];
+        std::vector<float> &texels = levels[level];
+        // a side already at 1 isn't halved, its texel is read twice
+        unsigned int next_w = (std::max)(w / 2, 1u), next_h = (std::max)(h / 2, 1u);
+        unsigned int step_x = w > 1 ? 1 : 0, step_y = h > 1 ? w : 0;
+        for (unsigned int y = 0; y < next_h; y++) {
+            for (unsigned int x = 0; x < next_w; x++) {
+                const float *quad = &below[2 * (y * step_y + x * step_x)];
+                texels[y * next_w + x] = (std::max)(
+                    (std::max)(quad[0], quad[step_x]),
+                    (std::max)(quad[step_y], quad[step_y + step_x]));
+            }
+        }
+        w = next_w;
+        h = next_h;
+    }
+    statistics.rasterize_microseconds += microseconds_since(start_point);
+}
+
+bool Occlusion_buffer::is_visible(const Aabb_tree::box_t &box) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    statistics.tested++;
+    float min_x = static_cast<float>(width), max_x = 0;
+    float min_y = static_cast<float>(height), max_y = 0;
+    float nearest = 1;
+    bool visible = false;
+    for (unsigned int corner = 0; corner < 8 && !visible; corner++) {
+        math::float4 p = to_float4(math::transform3(
+            math::set(corner & 1 ? box.max.x : box.min.x, corner & 2 ? box.max.y : box.min.y,
+                      corner & 4 ? box.max.z : box.min.z, 1),
+            view_proj));
+        if (p.z < 0) {
+            visible = true;
+            break;
+        }
+        float x = (p.x / p.w * 0.5f + 0.5f) * width, y = (0.5f - p.y / p.w * 0.5f) * height;
+        min_x = (std::min)(min_x, x);
+        max_x = (std::max)(max_x, x);
+        min_y = (std::min)(min_y, y);
+        max_y = (std::max)(max_y, y);
+        nearest = (std::min)(nearest, p.z / p.w);
+    }
+    // grown by half a pixel, so a box past an occluder's edge reaches the first pixel whose
+    // center the occluder doesn't cover
+    min_x -= 0.5f;
+    min_y -= 0.5f;
+    max_x += 0.5f;
+    max_y += 0.5f;
+    if (!visible && (min_x < 0 || min_y < 0 || max_x >= width || max_y >= height)) {
+        visible = true;
+    }
+    if (!visible) {
+        // every pixel the rectangle touches, in the level where they are at most 4 texels wide
+        unsigned int x0 = static_cast<unsigned int>(min_x), x1 = static_cast<unsigned int>(max_x);
+        unsigned int y0 = static_cast<unsigned int>(min_y), y1 = static_cast<unsigned int>(max_y);
+        unsigned int level = 0;
+        while (level + 1 < levels.size() && ((x1 >> level) - (x0 >> level) > 3
+                                             || (y1 >> level) - (y0 >> level) > 3)) {
+            level++;
+        }
+        unsigned int level_width = (std::max)(width >> level, 1u);
+        float farthest = 0;
+        for (unsigned int y = y0 >> level; y <= y1 >> level; y++) {
+            for (unsigned int x = x0 >> level; x <= x1 >> level; x++) {
+                farthest = (std::max)(farthest, levels[level][y * level_width + x]);
+            }
+        }
+        visible = nearest <= farthest;
+    }
+    if (!visible) {
+        statistics.culled++;
+    }
+    statistics.test_microseconds += microseconds_since(start_point);
+    return visible;
+}
+
+unsigned int Occlusion_buffer::get_width() const {
+    return width;
+}
+
+unsigned int Occlusion_buffer::get_height() const {
+    return height;
+}
+
+const std::vector<float> &Occlusion_buffer::get_depth() const {
+    return levels[0];
+}
+
+const Occlusion_buffer::statistics_t &Occlusion_buffer::get_statistics() const {
+    return statistics;
+}
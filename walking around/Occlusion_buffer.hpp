@@ -0,0 +1,71 @@
+#pragma once
+#include "Aabb_tree.hpp"
+#include "Math.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// a small depth buffer on the CPU that a few large occluders are rasterized into, four pixels at
+// a time where the SSE backend is, then a pyramid of it where every texel holds the farthest
+// depth of the four under it, so a box is tested against at most 4 by 4 texels of the level its
+// rectangle on the screen fits in: it is hidden when its nearest point is behind all of them
+//
+// the occluders are clipped at the near plane, and a box reaching in front of it or off the
+// screen is always visible, the results only depend on what was drawn, in any order, and
+// which backend is used doesn't change them
+class Occlusion_buffer {
+    public:
+        struct statistics_t {
+            public:
+                unsigned int occluders = 0;
+                unsigned int triangles = 0;
+                unsigned int tested = 0;
+                unsigned int culled = 0;
+                // drawing the occluders and building the pyramid, and the tests
+                double rasterize_microseconds = 0;
+                double test_microseconds = 0;
+        };
+
+    private:
+        // in pixels from the top left corner, z from 0 at the near plane to 1 at the far one
+        struct screen_vertex_t {
+            public:
+                float x, y, z;
+        };
+
+        unsigned int width = 0, height = 0;
+        // level 0 is the depth buffer, every level after it half as wide and high
+        std::vector<std::vector<float>> levels;
+        math::matrix view_proj = {};
+        statistics_t statistics;
+
+        void rasterize(const screen_vertex_t &a, const screen_vertex_t &b,
+                       const screen_vertex_t &c);
+
+    public:
+        // the sides are powers of two, the width at least 4
+        void init(unsigned int _width, unsigned int _height);
+
+        // nothing drawn or tested, for a frame seen through view_proj, untransposed with the
+        // depth from 0 to 1 like math::perspective_fov_lh()
+        void clear(const math::matrix &_view_proj);
+
+        // the triangles of positions placed by world
+        void add_occluder(const math::float3 *positions, const unsigned int *indices,
+                          std::size_t index_count, const math::matrix &world);
+
+        // after the occluders, before the tests
+        void build_pyramid();
+
+        // false only when the whole box is behind the occluders
+        bool is_visible(const Aabb_tree::box_t &box);
+
+        unsigned int get_width() const;
+        unsigned int get_height() const;
+
+        // level 0 row by row, 1 where nothing was drawn
+        const std::vector<float> &get_depth() const;
+
+        // since clear()
+        const statistics_t &get_statistics() const;
+};
@@ -0,0 +1,47 @@
+#include "Parallel_recorder.hpp"
+#include "Utility.hpp"
+
+void Parallel_recorder::init(ComPtr<ID3D12Device> &device, unsigned int frame_count,
+                             unsigned int worker_count) {
+    workers.resize(worker_count);
+    for (worker_t &worker : workers) {
+        worker.allocators.resize(frame_count);
+        worker.command_lists.resize(frame_count);
+        for (unsigned int i = 0; i < frame_count; i++) {
+            check_output(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                                        IID_PPV_ARGS(&worker.allocators[i])));
+            check_output(device->CreateCommandList(
+                0, D3D12_COMMAND_LIST_TYPE_DIRECT, worker.allocators[i].Get(), nullptr,
+                IID_PPV_ARGS(&worker.command_lists[i])));
+            check_output(worker.command_lists[i]->Close());
+        }
+    }
+}
+
+void Parallel_recorder::record(Job_system &job_system, unsigned int frame_index,
+                               ID3D12PipelineState *pipeline_state,
+                               const record_function &record) {
+    job_system.parallel_for(0, workers.size(), 1, [&](unsigned int first, unsigned int end) {
+        for (unsigned int worker = first; worker < end; worker++) {
+            ComPtr<ID3D12CommandAllocator> &allocator = workers[worker].allocators[frame_index];
+            ComPtr<ID3D12GraphicsCommandList> &command_list =
+                workers[worker].command_lists[frame_index];
+
+            check_output(allocator->Reset());
+            check_output(command_list->Reset(allocator.Get(), pipeline_state));
+            record(command_list, worker, workers.size());
+            check_output(command_list->Close());
+        }
+    });
+}
+
+void Parallel_recorder::append_command_lists(unsigned int frame_index,
+                                             std::vector<ID3D12CommandList *> &lists) {
+    for (worker_t &worker : workers) {
+        lists.push_back(worker.command_lists[frame_index].Get());
+    }
+}
+
+unsigned int Parallel_recorder::get_worker_count() {
+    return workers.size();
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Windows_includes.hpp"
+
+#include "Job_system.hpp"
+
+#include <functional>
+#include <vector>
+
+// command lists recorded at the same time on the job system, one allocator per list and frame
+class Parallel_recorder {
+    public:
+        // called once for every list, which records its part of the frame into command_list
+        using record_function = std::function<void(ComPtr<ID3D12GraphicsCommandList> &command_list,
+                                                   unsigned int worker, unsigned int worker_count)>;
+
+    private:
+        struct worker_t {
+            public:
+                std::vector<ComPtr<ID3D12CommandAllocator>> allocators;
+                std::vector<ComPtr<ID3D12GraphicsCommandList>> command_lists;
+        };
+
+        std::vector<worker_t> workers;
+
+    public:
+        void init(ComPtr<ID3D12Device> &device, unsigned int frame_count,
+                  unsigned int worker_count);
+
+        // returns once every list is closed, rethrows the first exception of the recording
+        void record(Job_system &job_system, unsigned int frame_index,
+                    ID3D12PipelineState *pipeline_state, const record_function &record);
+
+        // the lists of the last record() of the frame, in worker order
+        void append_command_lists(unsigned int frame_index,
+                                  std::vector<ID3D12CommandList *> &lists);
+
+        unsigned int get_worker_count();
+};
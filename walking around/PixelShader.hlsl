@@ -5,6 +5,10 @@ cbuffer vs_const_buffer_t
     float4x4 matProj;
     float4 colLight;
     float4 dirLight;
+    float4 sliceMinLod[2]; // MIN_LOD_SLICES / 4
+    float4x4 matShadow[4]; // SHADOW_CASCADE_COUNT
+    float4 cascadeSplits;
+    float4 cascadeTexelSizes;
 };
 
 struct ps_input_t
@@ -13,11 +17,45 @@ struct ps_input_t
     float4 viewer : VIEWER;
     float2 tex : TEXCOORD;
     float3 norm : NORMAL_PS;
+    nointerpolation uint slice : SLICE;
+    float3 world : WORLD;
 };
 
-Texture2D texture_ps;
+// one slice per image, or a single atlas slice
+Texture2DArray texture_ps : register(t0);
 SamplerState sampler_ps;
 
+// a slice per cascade, compared with the depths along the light
+Texture2DArray shadow_map_ps : register(t1);
+SamplerComparisonState shadow_sampler_ps : register(s1);
+
+// 1 where the light reaches, 0 in the shadow, from the first cascade the point is on, 3 by 3
+// filtered comparisons around it soften the edges
+float get_light(float3 world, float3 normal, float view_depth)
+{
+    for (uint i = 0; i < 4; i++)
+    {
+        // pushed off the surface by a texel and a half, so it doesn't shadow itself
+        float3 offset = world + normal * cascadeTexelSizes[i] * 1.5f;
+        float4 map = mul(float4(offset, 1.0f), matShadow[i]);
+        if (view_depth <= cascadeSplits[i] && all(abs(map.xy) <= 1.0f))
+        {
+            float2 uv = float2(map.x * 0.5f + 0.5f, 0.5f - map.y * 0.5f);
+            float light = 0;
+            [unroll] for (int y = -1; y <= 1; y++)
+            {
+                [unroll] for (int x = -1; x <= 1; x++)
+                {
+                    light += shadow_map_ps.SampleCmpLevelZero(
+                        shadow_sampler_ps, float3(uv, i), map.z, int2(x, y));
+                }
+            }
+            return light / 9;
+        }
+    }
+    return 1;
+}
+
 float4 main(ps_input_t input) : SV_TARGET
 {
     float3 light_dir = normalize(mul(dirLight, matView));
@@ -25,7 +63,12 @@ float4 main(ps_input_t input) : SV_TARGET
     float dir_light = max(0, dot(input.norm, light_dir));
     float3 h = normalize(normalize(input.viewer.xyz) + light_dir);
     float spec_light = pow(dot(h, input.norm), 2)/2;
-    return (amb_light + dir_light) * texture_ps.Sample(
-         sampler_ps, input.tex) + spec_light * colLight;
+    // the normal is turned back from the view into the world
+    float light = get_light(input.world, mul((float3x3)matView, input.norm), -input.viewer.z);
+    // finer mips of the slice may not be streamed in yet
+    float min_lod = sliceMinLod[input.slice / 4][input.slice % 4];
+    float4 tex_color =
+        texture_ps.Sample(sampler_ps, float3(input.tex, input.slice), int2(0, 0), min_lod);
+    return (amb_light + dir_light * light) * tex_color + spec_light * light * colLight;
 
 }
@@ -1,54 +1,35 @@
 #include "Player.hpp"
 
-void Player::fill_view_matrix(Shader_const_buffer &buffer) {
+#include <algorithm>
 
-    DirectX::XMMATRIX view;
-    view = DirectX::XMMatrixMultiply(DirectX::XMMatrixTranslation(-x, -y, -z),
-                                     DirectX::XMMatrixRotationY(-angle));
-    view = DirectX::XMMatrixMultiply(view, DirectX::XMMatrixTranslation(0, 0, camera_back_dist));
-    view = DirectX::XMMatrixMultiply(view, DirectX::XMMatrixRotationX(viewing_down_angle));
-
-    view = XMMatrixTranspose(view);
-    XMStoreFloat4x4(&buffer.matView, view);
+math::affine Player::get_view_transform() {
+    math::affine view =
+        math::then_rotation_y(math::affine_translation(-x, -y - eye_height, -z), -angle);
+    view = math::then_translation(view, 0, 0, camera_dist);
+    return math::then_rotation_x(view, viewing_down_angle);
 }
 
-DirectX::XMMATRIX Player::rotate_by_y_pivot(float pivot, float rotation) {
-    DirectX::XMMATRIX rotation_matrix = DirectX::XMMatrixTranslation(0, -pivot, 0);
-    rotation_matrix =
-        DirectX::XMMatrixMultiply(rotation_matrix, DirectX::XMMatrixRotationX(rotation));
-    rotation_matrix =
-        DirectX::XMMatrixMultiply(rotation_matrix, DirectX::XMMatrixTranslation(0, pivot, 0));
-    return rotation_matrix;
+math::matrix Player::get_view_matrix() {
+    return math::to_matrix(get_view_transform());
 }
 
-void Player::fill_person_matrices(Shader_const_buffer &buffer) {
-    DirectX::XMMATRIX off;
-
-    off = DirectX::XMMatrixMultiply(DirectX::XMMatrixRotationY(angle),
-                                    DirectX::XMMatrixTranslation(x, 0, z));
-
-    DirectX::XMMATRIX left_hand_matrix = rotate_by_y_pivot(hand_pivot_y, limb_angle);
-    left_hand_matrix = DirectX::XMMatrixMultiply(left_hand_matrix, off);
-
-    DirectX::XMMATRIX right_hand_matrix = rotate_by_y_pivot(hand_pivot_y, -limb_angle);
-    right_hand_matrix = DirectX::XMMatrixMultiply(right_hand_matrix, off);
-
-    DirectX::XMMATRIX left_leg_matrix = rotate_by_y_pivot(leg_pivot_y, -limb_angle);
-    left_leg_matrix = DirectX::XMMatrixMultiply(left_leg_matrix, off);
-
-    DirectX::XMMATRIX right_leg_matrix = rotate_by_y_pivot(leg_pivot_y, limb_angle);
-    right_leg_matrix = DirectX::XMMatrixMultiply(right_leg_matrix, off);
-
-    off = XMMatrixTranspose(off);
-    left_leg_matrix = XMMatrixTranspose(left_leg_matrix);
-    right_leg_matrix = XMMatrixTranspose(right_leg_matrix);
-    left_hand_matrix = XMMatrixTranspose(left_hand_matrix);
-    right_hand_matrix = XMMatrixTranspose(right_hand_matrix);
-    XMStoreFloat4x4(&buffer.matWorld[off_mat_id], off);
-    XMStoreFloat4x4(&buffer.matWorld[left_leg_mat_id], left_leg_matrix);
-    XMStoreFloat4x4(&buffer.matWorld[right_leg_mat_id], right_leg_matrix);
-    XMStoreFloat4x4(&buffer.matWorld[left_hand_mat_id], left_hand_matrix);
-    XMStoreFloat4x4(&buffer.matWorld[right_hand_mat_id], right_hand_matrix);
+void Player::fill_person_transforms(math::affine (&world_transforms)[WORLD_MATRIX_COUNT]) {
+    math::affine off = math::then_translation(
+        math::then_rotation_y(math::affine_identity(), angle), x, y, z);
+
+    // the limbs swing about their pivots, then move with the whole person
+    math::affine limbs[] = {math::affine_pivot_rotation_x(hand_pivot_y, limb_angle),
+                            math::affine_pivot_rotation_x(hand_pivot_y, -limb_angle),
+                            math::affine_pivot_rotation_x(leg_pivot_y, -limb_angle),
+                            math::affine_pivot_rotation_x(leg_pivot_y, limb_angle)};
+    math::then(limbs, 4, off, limbs);
+    unsigned int limb_mat_ids[] = {left_hand_mat_id, right_hand_mat_id, left_leg_mat_id,
+                                   right_leg_mat_id};
+
+    world_transforms[off_mat_id] = off;
+    for (unsigned int i = 0; i < 4; i++) {
+        world_transforms[limb_mat_ids[i]] = limbs[i];
+    }
 }
 
 float Player::limb_angle_function(float current_limb_time) {
@@ -64,11 +45,11 @@ float Player::limb_angle_function_inv(float current_limb_angle) {
     return 2 + current_limb_angle / 2;
 }
 
-void Player::init(ComPtr<ID3D12Device> &device, Texture_loader &texture_loader,
-                         const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
-                         const D3D12_GPU_DESCRIPTOR_HANDLE &gpu_handle, Id_giver &id_giver) {
-    person_obj.init(device, texture_loader, LR"(resources/person.png)", LR"(resources/person.wobj)",
-                    cpu_handle, gpu_handle, id_giver);
+void Player::init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                  Asset_cache<Mesh> &mesh_cache, const D3D12_GPU_DESCRIPTOR_HANDLE &texture_handle,
+                  const texture_packer::placement_t &texture_placement, Id_giver &id_giver) {
+    person_obj.init(device, upload_batch, mesh_cache, obj_filename, texture_handle,
+                    texture_placement, id_giver);
 
     off_mat_id = id_giver.get_id("person.off");
     left_leg_mat_id = id_giver.get_id("person.left_leg");
@@ -80,6 +61,13 @@ void Player::init(ComPtr<ID3D12Device> &device, Texture_loader &texture_loader,
     leg_pivot_y = person_obj.get_pivot(right_leg_mat_id)[1];
 }
 
+Object::loaded_mesh_t Player::swap_mesh(Object::loaded_mesh_t loaded) {
+    Object::loaded_mesh_t previous = person_obj.swap_mesh(std::move(loaded));
+    hand_pivot_y = person_obj.get_pivot(right_hand_mat_id)[1];
+    leg_pivot_y = person_obj.get_pivot(right_leg_mat_id)[1];
+    return previous;
+}
+
 void Player::key_down(WPARAM key_code) {
     switch (key_code) {
         case 'W':
@@ -126,7 +114,7 @@ void Player::key_up(WPARAM key_code) {
     }
 }
 
-void Player::update(float delta_time) {
+void Player::update(float delta_time, const Collision_world &collision_world) {
 
     time += delta_time;
 
@@ -139,8 +127,12 @@ void Player::update(float delta_time) {
     float forward_x = sin_angle, forward_z = cos_angle;
     float left_x = cos_angle, left_z = -sin_angle;
 
-    x += (left_x * velocity_x + forward_x * velocity_z) * delta_time * movement_speed;
-    z += (forward_z * velocity_z + left_z * velocity_x) * delta_time * movement_speed;
+    collision_world.move_circle(
+        x, z, collision_radius,
+        (left_x * velocity_x + forward_x * velocity_z) * delta_time * movement_speed,
+        (forward_z * velocity_z + left_z * velocity_x) * delta_time * movement_speed,
+        nearby_walls);
+    y = terrain::get_height(x, z);
 
     angle += angular_velocity * delta_time;
     if (angle > 2 * std::numbers::pi_v<float>) {
@@ -165,11 +157,46 @@ void Player::update(float delta_time) {
     }
 }
 
-void Player::fill_const_buffer(Shader_const_buffer &buffer) {
-    fill_view_matrix(buffer);
-    fill_person_matrices(buffer);
+math::vector Player::get_camera_position() {
+    // the view matrix's steps undone on its origin, the person's turn and place after stepping
+    // back from them
+    return math::transform3(
+        math::set(0, 0, -camera_dist, 1),
+        math::multiply(math::rotation_y(angle), math::translation(x, y + eye_height, z)));
+}
+
+void Player::get_camera_ray(math::float3 &origin, math::float3 &direction, float &length) {
+    float sin, cos;
+    math::sin_cos(angle, sin, cos);
+    origin = {x, y + eye_height, z};
+    // 0, 0, -1 turned with the person
+    direction = {-sin, 0, -cos};
+    length = camera_back_dist;
+}
+
+void Player::limit_camera_distance(float distance) {
+    camera_dist = (std::clamp)(distance, min_camera_dist, camera_back_dist);
+}
+
+void Player::fill_const_buffer(Shader_const_buffer &buffer,
+                               math::affine (&world_transforms)[WORLD_MATRIX_COUNT]) {
+    math::store_column_major(buffer.matView, get_view_transform());
+    fill_person_transforms(world_transforms);
+}
+
+math::vector Player::get_position() {
+    return math::set(x, y, z, 1);
+}
+
+float Player::get_bounding_radius() {
+    return person_obj.get_bounding_sphere().w;
+}
+
+void Player::submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state) {
+    float depth = math::get_z(math::transform3(get_position(), get_view_matrix()));
+    person_obj.submit(render_queue, pipeline_state, depth);
 }
 
-void Player::draw(ComPtr<ID3D12GraphicsCommandList> &command_list) {
-    person_obj.draw(command_list);
+void Player::submit_caster(Render_queue &render_queue, ID3D12PipelineState *pipeline_state) {
+    person_obj.submit_caster(render_queue, pipeline_state);
 }
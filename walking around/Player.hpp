@@ -2,6 +2,9 @@
 #include "Windows_includes.hpp"
 #include "Object.hpp"
 #include "Shader_const_buffer.hpp"
+#include "Affine.hpp"
+#include "Collision_world.hpp"
+#include "Terrain.hpp"
 
 
 #include <numbers>
@@ -11,10 +14,16 @@
 class Player {
     private:
         float time = 0;
-        float x = 0, z = 0;
-        constexpr static float y = 5, camera_back_dist = 3;
+        // y is the ground's height under the person, the camera turns about eye_height above it
+        float x = 0, y = 0, z = 0;
+        constexpr static float eye_height = 5, camera_back_dist = 3, min_camera_dist = 0.5f;
+        // camera_back_dist unless something stands between the camera and the person
+        float camera_dist = camera_back_dist;
         constexpr static float viewing_down_angle = -0.6;
         constexpr static float movement_speed = 5;
+        // the circle the person takes up on the ground
+        constexpr static float collision_radius = 0.4f;
+        std::vector<unsigned int> nearby_walls;
         float angle = 0;
         float velocity_x_forward = 0, velocity_x_backward = 0, velocity_z_forward = 0,
               velocity_z_backward = 0, angular_velocity_left = 0, angular_velocity_right = 0;
@@ -28,28 +37,55 @@ class Player {
         unsigned int off_mat_id = 0, left_leg_mat_id = 0, right_leg_mat_id = 0,
                      left_hand_mat_id = 0, right_hand_mat_id = 0;
 
-        void fill_view_matrix(Shader_const_buffer &buffer);
+        math::affine get_view_transform();
 
-        DirectX::XMMATRIX rotate_by_y_pivot(float pivot, float rotation);
-
-        void fill_person_matrices(Shader_const_buffer &buffer);
+        void fill_person_transforms(math::affine (&world_transforms)[WORLD_MATRIX_COUNT]);
 
         float limb_angle_function(float current_limb_time);
 
         float limb_angle_function_inv(float current_limb_angle);
 
     public:
-        void init(ComPtr<ID3D12Device> &device, Texture_loader &texture_loader,
-                  const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
-                  const D3D12_GPU_DESCRIPTOR_HANDLE &gpu_handle, Id_giver &id_giver);
+        constexpr static PCWSTR texture_filename = LR"(resources/person.png)";
+        constexpr static PCWSTR obj_filename = LR"(resources/person.wobj)";
+
+        void init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                  Asset_cache<Mesh> &mesh_cache, const D3D12_GPU_DESCRIPTOR_HANDLE &texture_handle,
+                  const texture_packer::placement_t &texture_placement, Id_giver &id_giver);
+
+        // the person's mesh reloaded, the pivots are read again from it
+        Object::loaded_mesh_t swap_mesh(Object::loaded_mesh_t loaded);
 
         void key_down(WPARAM key_code);
 
         void key_up(WPARAM key_code);
 
-        void update(float delta_time);
+        // walks as far as the walls of collision_world let the person, on the terrain's ground
+        void update(float delta_time, const Collision_world &collision_world);
+
+        // world to view, untransposed
+        math::matrix get_view_matrix();
+
+        math::vector get_camera_position();
+
+        // from the point the camera turns about towards where it stands when nothing is in the
+        // way, direction is a unit vector
+        void get_camera_ray(math::float3 &origin, math::float3 &direction, float &length);
+
+        // the camera comes no further back than distance along the ray
+        void limit_camera_distance(float distance);
+
+        // where the person stands, in world space
+        math::vector get_position();
+
+        // radius of the person's bounding sphere
+        float get_bounding_radius();
+
+        // the view matrix into buffer, the person's groups into world_transforms by their ids
+        void fill_const_buffer(Shader_const_buffer &buffer,
+                               math::affine (&world_transforms)[WORLD_MATRIX_COUNT]);
 
-        void fill_const_buffer(Shader_const_buffer &buffer);
+        void submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state);
 
-        void draw(ComPtr<ID3D12GraphicsCommandList> &command_list);
+        void submit_caster(Render_queue &render_queue, ID3D12PipelineState *pipeline_state);
 };
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "Recording_benchmark.hpp"
+#include "Parallel_recorder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <sstream>
+
+namespace {
+constexpr unsigned int repeats = 5;
+constexpr float max_depth = 100;
+
+double milliseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end_point - start_point).count();
+}
+} // namespace
+
+std::string benchmark_recording(ComPtr<ID3D12Device> &device, Job_system &job_system,
+                                ID3D12PipelineState *pipeline_state,
+                                const std::vector<Render_queue::draw_t> &draws,
+                                unsigned int draw_count,
+                                const std::function<void(ComPtr<ID3D12GraphicsCommandList> &)>
+                                    &set_state) {
+    if (draws.empty()) {
+        return "recording: nothing to draw\n";
+    }
+
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<std::size_t> pick(0, draws.size() - 1);
+    std::uniform_real_distribution<float> depth(0, max_depth);
+    Render_queue queue;
+    for (unsigned int i = 0; i < draw_count; i++) {
+        queue.submit(draws[pick(generator)], depth(generator));
+    }
+    queue.sort();
+
+    std::stringstream s;
+    double single_worker_time = 0;
+    for (unsigned int worker_count = 1; worker_count <= job_system.get_thread_count();
+         worker_count++) {
+        Parallel_recorder recorder;
+        recorder.init(device, 1, worker_count);
+        std::vector<Render_queue::statistics_t> statistics(worker_count);
+
+        double time = 1e30;
+        for (unsigned int i = 0; i < repeats; i++) {
+            std::fill(statistics.begin(), statistics.end(), Render_queue::statistics_t());
+            auto start_point = std::chrono::high_resolution_clock::now();
+            recorder.record(job_system, 0, pipeline_state,
+                            [&](ComPtr<ID3D12GraphicsCommandList> &command_list,
+                                unsigned int worker, unsigned int workers) {
+                                set_state(command_list);
+                                queue.record(command_list, pipeline_state,
+                                             worker * draw_count / workers,
+                                             (worker + 1) * draw_count / workers,
+                                             statistics[worker]);
+                            });
+            time = (std::min)(time, milliseconds_since(start_point));
+        }
+
+        if (worker_count == 1) {
+            single_worker_time = time;
+            s << "recording: " << draw_count << " draws from " << draws.size()
+              << " different ones, state changes " << statistics[0].state_changes << " sorted, "
+              << statistics[0].unsorted_state_changes << " unsorted\n";
+        }
+        s << "recording: " << worker_count << " workers " << time << " ms ("
+          << single_worker_time / time << "x)\n";
+    }
+    return s.str();
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "Windows_includes.hpp"
+
+#include "Job_system.hpp"
+#include "Render_queue.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// draw_count draws made from the given ones at random depths, sorted in a Render_queue and
+// recorded the way the parallel main pass records them, split between 1 to the job system's
+// thread count of workers each on its own command list, the lists are never executed: the
+// queue's state changes, then how long the recording takes for every count of workers, one line
+// each, set_state binds what the lists need before their draws
+std::string benchmark_recording(ComPtr<ID3D12Device> &device, Job_system &job_system,
+                                ID3D12PipelineState *pipeline_state,
+                                const std::vector<Render_queue::draw_t> &draws,
+                                unsigned int draw_count,
+                                const std::function<void(ComPtr<ID3D12GraphicsCommandList> &)>
+                                    &set_state);
@@ -0,0 +1,144 @@
+#include "Render_queue.hpp"
+
+#include <algorithm>
+#include <array>
+
+void Render_queue::statistics_t::add(const statistics_t &other) {
+    draws += other.draws;
+    unsorted_state_changes += other.unsorted_state_changes;
+    state_changes += other.state_changes;
+}
+
+UINT64 Render_queue::get_id(std::unordered_map<UINT64, UINT64> &ids, UINT64 value,
+                            unsigned int bits) {
+    auto [it, inserted] = ids.try_emplace(value, ids.size());
+    // past the limit ids repeat, which only costs some extra bindings
+    return it->second & ((UINT64(1) << bits) - 1);
+}
+
+UINT64 Render_queue::make_key(UINT64 pipeline_id, UINT64 texture_id, UINT64 vertex_buffer_id,
+                              float depth) {
+    constexpr UINT64 max_depth_value = (UINT64(1) << depth_bits) - 1;
+    float depth_part = (std::clamp)(depth / max_depth, 0.0f, 1.0f);
+    UINT64 depth_value = static_cast<UINT64>(depth_part * max_depth_value);
+
+    UINT64 key = pipeline_id;
+    key = (key << texture_bits) | texture_id;
+    key = (key << vertex_buffer_bits) | vertex_buffer_id;
+    key = (key << depth_bits) | depth_value;
+    return key;
+}
+
+void Render_queue::radix_sort(std::vector<sort_entry_t> &entries,
+                              std::vector<sort_entry_t> &scratch) {
+    constexpr unsigned int digit_bits = 8, bucket_count = 1 << digit_bits;
+
+    scratch.resize(entries.size());
+    for (unsigned int shift = 0; shift < 64; shift += digit_bits) {
+        std::array<UINT, bucket_count> offsets = {};
+        for (const sort_entry_t &entry : entries) {
+            offsets[(entry.key >> shift) & (bucket_count - 1)]++;
+        }
+        if (!entries.empty()
+            && offsets[(entries[0].key >> shift) & (bucket_count - 1)] == entries.size()) {
+            continue;
+        }
+
+        UINT sum = 0;
+        for (UINT &offset : offsets) {
+            UINT count = offset;
+            offset = sum;
+            sum += count;
+        }
+        for (const sort_entry_t &entry : entries) {
+            scratch[offsets[(entry.key >> shift) & (bucket_count - 1)]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+void Render_queue::init(const D3D12_VERTEX_BUFFER_VIEW &_identity_instance) {
+    identity_instance = &_identity_instance;
+}
+
+void Render_queue::clear() {
+    draws.clear();
+    entries.clear();
+}
+
+void Render_queue::submit(const draw_t &draw, float depth) {
+    UINT64 pipeline_id =
+        get_id(pipeline_ids, reinterpret_cast<UINT64>(draw.pipeline_state), pipeline_bits);
+    UINT64 texture_id = get_id(texture_ids, draw.texture.ptr, texture_bits);
+    UINT64 vertex_buffer_id = get_id(
+        vertex_buffer_ids, reinterpret_cast<UINT64>(draw.vertex_buffer), vertex_buffer_bits);
+
+    entries.push_back({make_key(pipeline_id, texture_id, vertex_buffer_id, depth),
+                       static_cast<UINT>(draws.size())});
+    draws.push_back(draw);
+    if (!draw.instance_buffer) {
+        draws.back().instance_buffer = identity_instance;
+        draws.back().instance_count = 1;
+    }
+}
+
+void Render_queue::sort() {
+    radix_sort(entries, scratch);
+}
+
+unsigned int Render_queue::size() {
+    return entries.size();
+}
+
+const Render_queue::draw_t &Render_queue::get_sorted_draw(unsigned int i) {
+    return draws[entries[i].draw];
+}
+
+void Render_queue::record(ComPtr<ID3D12GraphicsCommandList> &command_list,
+                          ID3D12PipelineState *pipeline_state, unsigned int first,
+                          unsigned int end, statistics_t &statistics) {
+    // nothing is bound at the start of a command list
+    UINT64 texture = 0;
+    const D3D12_VERTEX_BUFFER_VIEW *vertex_buffer = nullptr, *instance_buffer = nullptr;
+    const D3D12_INDEX_BUFFER_VIEW *index_buffer = nullptr;
+    const void *root_constants = nullptr;
+
+    for (unsigned int i = first; i < end; i++) {
+        const draw_t &draw = draws[entries[i].draw];
+        statistics.draws++;
+        statistics.unsorted_state_changes += 3 + (draw.root_constants != nullptr);
+
+        if (draw.pipeline_state != pipeline_state) {
+            pipeline_state = draw.pipeline_state;
+            command_list->SetPipelineState(pipeline_state);
+            statistics.state_changes++;
+        }
+        if (draw.texture.ptr != texture) {
+            texture = draw.texture.ptr;
+            command_list->SetGraphicsRootDescriptorTable(texture_argument, draw.texture);
+            statistics.state_changes++;
+        }
+        if (draw.root_constants && draw.root_constants != root_constants) {
+            root_constants = draw.root_constants;
+            command_list->SetGraphicsRoot32BitConstants(
+                root_constants_argument, draw.root_constant_count, draw.root_constants, 0);
+            statistics.state_changes++;
+        }
+        // the vertices and their instances are set together
+        if (draw.vertex_buffer != vertex_buffer || draw.instance_buffer != instance_buffer) {
+            vertex_buffer = draw.vertex_buffer;
+            instance_buffer = draw.instance_buffer;
+            D3D12_VERTEX_BUFFER_VIEW views[] = {*vertex_buffer, *instance_buffer};
+            command_list->IASetVertexBuffers(0, 2, views);
+            statistics.state_changes++;
+        }
+        if (draw.index_buffer != index_buffer) {
+            index_buffer = draw.index_buffer;
+            command_list->IASetIndexBuffer(index_buffer);
+            statistics.state_changes++;
+        }
+
+        command_list->DrawIndexedInstanced(draw.index_count, draw.instance_count,
+                                           draw.first_index, 0, 0);
+    }
+}
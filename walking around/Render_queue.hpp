@@ -0,0 +1,95 @@
+#pragma once
+#include "Windows_includes.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+// the frame's draws, sorted by a key of pipeline, texture, vertex buffer and depth so that
+// recording them binds only the state that changes between neighbours
+class Render_queue {
+    public:
+        // root parameters the queue binds
+        constexpr static UINT texture_argument = 1;
+        constexpr static UINT root_constants_argument = 2;
+
+        struct draw_t {
+            public:
+                ID3D12PipelineState *pipeline_state;
+                D3D12_GPU_DESCRIPTOR_HANDLE texture;
+                const D3D12_VERTEX_BUFFER_VIEW *vertex_buffer;
+                const D3D12_INDEX_BUFFER_VIEW *index_buffer;
+                const void *root_constants; // nullptr when the draw has none
+                UINT root_constant_count;
+                UINT index_count;
+                UINT first_index;
+                // the instances' transforms, math::affine each, bound to the second slot,
+                // nullptr for a draw of one untransformed instance
+                const D3D12_VERTEX_BUFFER_VIEW *instance_buffer;
+                UINT instance_count;
+        };
+
+        struct statistics_t {
+            public:
+                unsigned int draws = 0;
+                // what the draws would cost if each one set all of its state
+                unsigned int unsorted_state_changes = 0;
+                unsigned int state_changes = 0;
+
+                void add(const statistics_t &other);
+        };
+
+    private:
+        struct sort_entry_t {
+            public:
+                UINT64 key;
+                UINT draw;
+        };
+
+        // from the most to the least significant bits of the key
+        constexpr static unsigned int pipeline_bits = 8;
+        constexpr static unsigned int texture_bits = 16;
+        constexpr static unsigned int vertex_buffer_bits = 16;
+        constexpr static unsigned int depth_bits = 24;
+        constexpr static float max_depth = 100; // the far plane
+
+        std::vector<draw_t> draws;
+        std::vector<sort_entry_t> entries, scratch;
+        // one identity transform, the instance of the draws that have none
+        const D3D12_VERTEX_BUFFER_VIEW *identity_instance = nullptr;
+
+        // small ids stay the same from frame to frame, so equal state gets equal key bits
+        std::unordered_map<UINT64, UINT64> pipeline_ids, texture_ids, vertex_buffer_ids;
+
+        static UINT64 get_id(std::unordered_map<UINT64, UINT64> &ids, UINT64 value,
+                             unsigned int bits);
+
+        // stable least significant digit first sort on the keys, 8 bits per pass,
+        // passes where every key has the same digit are skipped
+        static void radix_sort(std::vector<sort_entry_t> &entries,
+                               std::vector<sort_entry_t> &scratch);
+
+    public:
+        // depth is the view space distance, it only orders draws with equal state, front first
+        static UINT64 make_key(UINT64 pipeline_id, UINT64 texture_id, UINT64 vertex_buffer_id,
+                               float depth);
+
+        // _identity_instance must outlive the queue
+        void init(const D3D12_VERTEX_BUFFER_VIEW &_identity_instance);
+
+        void clear();
+
+        // after init(), draws without instances are given the identity instance
+        void submit(const draw_t &draw, float depth);
+
+        void sort();
+
+        unsigned int size();
+
+        // i-th draw in sorted order, valid after sort()
+        const draw_t &get_sorted_draw(unsigned int i);
+
+        // records the sorted draws [first, end), pipeline_state is what the list starts with
+        void record(ComPtr<ID3D12GraphicsCommandList> &command_list,
+                    ID3D12PipelineState *pipeline_state, unsigned int first, unsigned int end,
+                    statistics_t &statistics);
+};
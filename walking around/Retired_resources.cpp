@@ -0,0 +1,24 @@
+#include "Retired_resources.hpp"
+#include "Utility.hpp"
+
+void Retired_resources::init(ComPtr<ID3D12Device> &device) {
+    check_output(device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence)));
+}
+
+void Retired_resources::retire(ComPtr<ID3D12CommandQueue> &command_queue,
+                               std::shared_ptr<void> resource) {
+    fence_value++;
+    check_output(command_queue->Signal(fence.Get(), fence_value));
+    retired.push_back({fence_value, std::move(resource)});
+}
+
+void Retired_resources::collect() {
+    UINT64 completed = fence->GetCompletedValue();
+    while (!retired.empty() && retired.front().fence_value <= completed) {
+        retired.pop_front();
+    }
+}
+
+unsigned int Retired_resources::get_count() {
+    return static_cast<unsigned int>(retired.size());
+}
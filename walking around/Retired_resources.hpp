@@ -0,0 +1,31 @@
+#pragma once
+#include "Windows_includes.hpp"
+
+#include <deque>
+#include <memory>
+
+// keeps resources that were replaced alive until the GPU has finished every command list
+// submitted before they were retired
+class Retired_resources {
+    private:
+        struct retired_t {
+            public:
+                UINT64 fence_value;
+                std::shared_ptr<void> resource;
+        };
+
+        ComPtr<ID3D12Fence> fence;
+        UINT64 fence_value = 0;
+        std::deque<retired_t> retired;
+
+    public:
+        void init(ComPtr<ID3D12Device> &device);
+
+        // resource may hold anything with GPU resources inside
+        void retire(ComPtr<ID3D12CommandQueue> &command_queue, std::shared_ptr<void> resource);
+
+        // frees what the GPU is done with, call it once a frame
+        void collect();
+
+        unsigned int get_count();
+};
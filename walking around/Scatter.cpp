@@ -0,0 +1,129 @@
+#include "Scatter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace scatter {
+namespace {
+
+// candidates tried around a point before it stops being active, Bridson's k, spread evenly
+// around it from a random angle so one sin and cos serve them all
+constexpr unsigned int attempts = 16;
+// cos and sin of the turn from one candidate to the next
+const float step_cos = std::cos(6.283185307f / attempts);
+const float step_sin = std::sin(6.283185307f / attempts);
+
+bool occupied_at(const std::vector<circle_t> &occupied, float footprint, float x, float z) {
+    for (const circle_t &circle : occupied) {
+        float dx = x - circle.x, dz = z - circle.z, reach = circle.radius + footprint;
+        if (dx * dx + dz * dz < reach * reach) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+std::uint64_t random_t::next() {
+    std::uint64_t z = state += 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+float random_t::next_unit() {
+    return static_cast<float>(next() >> 40) / static_cast<float>(1u << 24);
+}
+
+std::uint64_t hash(std::uint64_t a, std::uint64_t b) {
+    random_t random = {a ^ (b * 0xd6e8feb86659fd93ull)};
+    return random.next();
+}
+
+void sample(const layer_t &layer, std::uint64_t seed, float min_x, float min_z, float size,
+            const std::vector<circle_t> &occupied, std::vector<point_t> &points) {
+    float spacing = layer.spacing, extent = size - spacing;
+    if (extent < 0) {
+        return;
+    }
+    float low_x = min_x + spacing / 2, low_z = min_z + spacing / 2;
+    // a grid square's diagonal is the spacing, so it holds at most one point, the grid keeps the
+    // points themselves with two empty squares around it, so the 5 by 5 squares around any
+    // point are read without indirections or clamps
+    float step = spacing / std::sqrt(2.0f);
+    int side = (std::max)(static_cast<int>(std::ceil(extent / step)), 1), padded = side + 4;
+    constexpr float far_away = -1e18f;
+    std::vector<point_t> grid(padded * padded, {far_away, far_away});
+    std::vector<point_t> samples;
+    std::vector<unsigned int> active;
+    random_t random = {seed};
+
+    auto grid_index = [&](float x, float z) {
+        int i = (std::min)(static_cast<int>((x - low_x) / step), side - 1);
+        int j = (std::min)(static_cast<int>((z - low_z) / step), side - 1);
+        return (j + 2) * padded + i + 2;
+    };
+    auto add = [&](float x, float z) {
+        grid[grid_index(x, z)] = {x, z};
+        active.push_back(static_cast<unsigned int>(samples.size()));
+        samples.push_back({x, z});
+    };
+    auto fits = [&](float x, float z) {
+        if (x < low_x || x > low_x + extent || z < low_z || z > low_z + extent) {
+            return false;
+        }
+        const point_t *row = &grid[grid_index(x, z) - 2 * padded - 2];
+        for (int j = 0; j < 5; j++, row += padded) {
+            // most candidates fail, a row at a time finds it soon enough without a branch per
+            // square
+            bool close = false;
+            for (int i = 0; i < 5; i++) {
+                float dx = row[i].x - x, dz = row[i].z - z;
+                close |= dx * dx + dz * dz < spacing * spacing;
+            }
+            if (close) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    add(low_x + random.next_unit() * extent, low_z + random.next_unit() * extent);
+    while (!active.empty()) {
+        unsigned int slot = static_cast<unsigned int>(random.next_unit() * active.size());
+        point_t center = samples[active[slot]];
+        bool added = false;
+        float angle = random.next_unit() * 6.283185307f;
+        float cos = std::cos(angle), sin = std::sin(angle);
+        for (unsigned int attempt = 0; attempt < attempts && !added; attempt++) {
+            // uniform over the ring from one to two spacings around the center
+            float distance = spacing * std::sqrt(1 + 3 * random.next_unit());
+            float x = center.x + cos * distance, z = center.z + sin * distance;
+            float next_cos = cos * step_cos - sin * step_sin;
+            sin = sin * step_cos + cos * step_sin;
+            cos = next_cos;
+            if (fits(x, z)) {
+                add(x, z);
+                added = true;
+            }
+        }
+        if (!added) {
+            active[slot] = active.back();
+            active.pop_back();
+        }
+    }
+
+    // thinned after sampling, so the density draws don't change where the points are
+    for (const point_t &point : samples) {
+        float keep = random.next_unit();
+        if (layer.density && keep >= layer.density(point.x, point.z)) {
+            continue;
+        }
+        if (!occupied_at(occupied, layer.footprint, point.x, point.z)) {
+            points.push_back(point);
+        }
+    }
+}
+
+} // namespace scatter
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// blue noise placements in the squares of a grid, made from a seed alone so any thread makes the
+// same ones: Bridson's Poisson-disk sampling fills the square no closer than the spacing, kept
+// half the spacing inside its sides so the points of neighbouring squares are never closer
+// either, then a density map thins them and what lands on an occupied circle is dropped
+namespace scatter {
+
+// splitmix64, its whole state is the seed
+struct random_t {
+    public:
+        std::uint64_t state;
+
+        std::uint64_t next();
+
+        // in [0, 1)
+        float next_unit();
+};
+
+// mixes b into the seed a, for the seeds of cells, layers and points
+std::uint64_t hash(std::uint64_t a, std::uint64_t b);
+
+// a circle nothing of a layer stands in, grown by the layer's footprint
+struct circle_t {
+    public:
+        float x, z, radius;
+};
+
+struct layer_t {
+    public:
+        // how close the layer's points can be to each other
+        float spacing;
+        // how far the layer's points keep from the occupied circles
+        float footprint;
+        // the chance in [0, 1] that a point at x, z is kept, null keeps every point
+        std::function<float(float x, float z)> density;
+};
+
+struct point_t {
+    public:
+        float x, z;
+};
+
+// the layer's points in the square from min_x, min_z with sides of size, appended to points
+void sample(const layer_t &layer, std::uint64_t seed, float min_x, float min_z, float size,
+            const std::vector<circle_t> &occupied, std::vector<point_t> &points);
+
+} // namespace scatter
@@ -0,0 +1,131 @@
+#include "Scatter_benchmark.hpp"
+#include "Scatter.hpp"
+#include "Terrain.hpp"
+#include "World_cells.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace {
+// about a thousand points a cell, so a thousand cells place a million
+constexpr float dense_spacing = 1;
+constexpr float dense_cell_size = 32;
+constexpr std::uint64_t seed = 0x243f6a8885a308d3ull;
+
+double seconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end_point - start_point).count();
+}
+
+// the closest two points, found with a grid of squares as wide as the spacing
+float closest_distance(const std::vector<std::vector<scatter::point_t>> &cells, float extent) {
+    int side = static_cast<int>(std::ceil(extent / dense_spacing));
+    std::vector<int> heads(side * side, -1);
+    std::vector<int> next;
+    std::vector<scatter::point_t> points;
+    auto square_of = [side](float value) {
+        return (std::clamp)(static_cast<int>(value / dense_spacing), 0, side - 1);
+    };
+    for (const std::vector<scatter::point_t> &cell : cells) {
+        for (const scatter::point_t &point : cell) {
+            int square = square_of(point.z) * side + square_of(point.x);
+            next.push_back(heads[square]);
+            heads[square] = static_cast<int>(points.size());
+            points.push_back(point);
+        }
+    }
+    float closest = extent;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        int x = square_of(points[i].x), z = square_of(points[i].z);
+        for (int j = (std::max)(z - 1, 0); j <= (std::min)(z + 1, side - 1); j++) {
+            for (int k = (std::max)(x - 1, 0); k <= (std::min)(x + 1, side - 1); k++) {
+                for (int other = heads[j * side + k]; other >= 0; other = next[other]) {
+                    if (other == static_cast<int>(i)) {
+                        continue;
+                    }
+                    float dx = points[other].x - points[i].x, dz = points[other].z - points[i].z;
+                    closest = (std::min)(closest, std::sqrt(dx * dx + dz * dz));
+                }
+            }
+        }
+    }
+    return closest;
+}
+} // namespace
+
+std::string benchmark_scatter(unsigned int cell_count, Job_system &job_system) {
+    unsigned int side = 1;
+    while (side * side < cell_count) {
+        side++;
+    }
+    scatter::layer_t layer = {dense_spacing, 0, nullptr};
+    auto sample_cell = [&](unsigned int i, std::vector<scatter::point_t> &points) {
+        scatter::sample(layer, scatter::hash(seed, i), (i % side) * dense_cell_size,
+                        (i / side) * dense_cell_size, dense_cell_size, {}, points);
+    };
+
+    std::vector<std::vector<scatter::point_t>> points(cell_count);
+    auto start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < cell_count; i++) {
+        sample_cell(i, points[i]);
+    }
+    double serial_seconds = seconds_since(start_point);
+    std::size_t point_count = 0;
+    for (const std::vector<scatter::point_t> &cell : points) {
+        point_count += cell.size();
+    }
+
+    std::vector<std::vector<scatter::point_t>> parallel_points(cell_count);
+    start_point = std::chrono::high_resolution_clock::now();
+    job_system.parallel_for(0, cell_count, 8, [&](unsigned int first, unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            sample_cell(i, parallel_points[i]);
+        }
+    });
+    double parallel_seconds = seconds_since(start_point);
+    unsigned int differing = 0;
+    for (unsigned int i = 0; i < cell_count; i++) {
+        differing += !std::equal(points[i].begin(), points[i].end(), parallel_points[i].begin(),
+                                 parallel_points[i].end(),
+                                 [](const scatter::point_t &a, const scatter::point_t &b) {
+                                     return a.x == b.x && a.z == b.z;
+                                 });
+    }
+
+    std::stringstream s;
+    s << "scatter: " << point_count << " points in " << cell_count << " cells, "
+      << point_count / serial_seconds / 1e6 << " M/s on one thread, "
+      << point_count / parallel_seconds / 1e6 << " M/s on " << job_system.get_thread_count()
+      << " threads, " << differing << " cells differ, closest two "
+      << closest_distance(points, side * dense_cell_size) << " apart at a spacing of "
+      << dense_spacing << "\n";
+
+    // every cell of the terrain, as the streamer asks for them
+    int reach = static_cast<int>(std::ceil(terrain::size / 2 / world_cells::cell_size));
+    unsigned int world_side = 2 * reach;
+    std::vector<world_cells::placements_t> placements(world_side * world_side);
+    start_point = std::chrono::high_resolution_clock::now();
+    job_system.parallel_for(0, world_side * world_side, 4, [&](unsigned int first,
+                                                               unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            Cell_residency::cell_t cell = {static_cast<int>(i % world_side) - reach,
+                                           static_cast<int>(i / world_side) - reach};
+            world_cells::get_placements(cell, {}, placements[i]);
+        }
+    });
+    double world_seconds = seconds_since(start_point);
+    std::size_t counts[world_cells::kind_count] = {};
+    for (const world_cells::placements_t &cell : placements) {
+        for (unsigned int kind = 0; kind < world_cells::kind_count; kind++) {
+            counts[kind] += cell.transforms[kind].size();
+        }
+    }
+    s << "scatter: the world's " << placements.size() << " cells, " << counts[world_cells::house]
+      << " houses, " << counts[world_cells::stone] << " stones, " << counts[world_cells::tree]
+      << " trees, " << world_seconds * 1e6 / placements.size() << " us a cell on "
+      << job_system.get_thread_count() << " threads\n";
+    return s.str();
+}
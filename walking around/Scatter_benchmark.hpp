@@ -0,0 +1,10 @@
+#pragma once
+#include "Job_system.hpp"
+
+#include <string>
+
+// a dense layer scattered over cell_count cells on one thread and on the job system, whether
+// both placed the same points and whether any two points of the whole square, across the
+// cells' sides too, are closer than the spacing, then the world's own layers over the terrain's
+// cells, one line each
+std::string benchmark_scatter(unsigned int cell_count, Job_system &job_system);
@@ -1,11 +1,26 @@
 #pragma once
-#include "Windows_includes.hpp"
+#include "Math.hpp"
 
 
+// mat_index values a vertex can have, the shaders' matWorld is as long
+constexpr unsigned int WORLD_MATRIX_COUNT = 10;
+
+// scene texture slices that can have a streamed mip clamp
+constexpr unsigned int MIN_LOD_SLICES = 8;
+
+// the directional light's shadow maps, as many as a float4 holds
+constexpr unsigned int SHADOW_CASCADE_COUNT = 4;
+
 struct Shader_const_buffer {
     public:
-        DirectX::XMFLOAT4X4 matWorld[10];
-        DirectX::XMFLOAT4X4 matView;
-        DirectX::XMFLOAT4X4 matProj;
-        DirectX::XMFLOAT4 colLight, dirLight;
+        math::float4x4 matWorld[WORLD_MATRIX_COUNT];
+        math::float4x4 matView;
+        math::float4x4 matProj;
+        math::float4 colLight, dirLight;
+        // the finest mip of every slice, four to a float4 like HLSL packs them
+        math::float4 sliceMinLod[MIN_LOD_SLICES / 4];
+        // from the world to every cascade's map, the view depth it ends at and its texels'
+        // side in the world
+        math::float4x4 matShadow[SHADOW_CASCADE_COUNT];
+        math::float4 cascadeSplits, cascadeTexelSizes;
 };
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "Vertex_format.h"
+
+cbuffer vs_const_buffer_t
+{
+    float4x4 matWorld[10];
+    float4x4 matView;
+    float4x4 matProj;
+    float4 colLight;
+    float4 dirLight;
+    float4 sliceMinLod[2]; // MIN_LOD_SLICES / 4
+    float4x4 matShadow[4]; // SHADOW_CASCADE_COUNT
+};
+
+// the cascade the pass draws into
+cbuffer shadow_pass_t : register(b3)
+{
+    uint cascade;
+};
+
+// a draw's instance, a math::affine's rows from the second vertex buffer, placed before matWorld
+struct instance_t
+{
+    float3 row0 : INSTANCE0;
+    float3 row1 : INSTANCE1;
+    float3 row2 : INSTANCE2;
+    float3 row3 : INSTANCE3;
+};
+
+float4x3 get_transform(instance_t instance)
+{
+    return float4x3(instance.row0, instance.row1, instance.row2, instance.row3);
+}
+
+#ifdef PACKED_VERTICES
+cbuffer mesh_bounds_t : register(b1)
+{
+    float4 bounds_min;
+    float4 bounds_extent;
+};
+
+float4 main(
+        uint4 packed_pos : POSITION,
+        float2 packed_norm : NORMAL,
+        float2 tex : TEXCOORD,
+        instance_t instance) : SV_POSITION
+{
+    float3 pos = bounds_min.xyz + packed_pos.xyz * (bounds_extent.xyz / 65535.0f);
+    uint packed_index = packed_pos.w;
+#else
+float4 main(
+        float3 pos : POSITION,
+        float3 norm : NORMAL,
+        float2 tex : TEXCOORD,
+        uint packed_index : MAT_INDEX,
+        instance_t instance) : SV_POSITION
+{
+#endif
+    uint mat_index = packed_index & ((1 << MAT_INDEX_BITS) - 1);
+    float3 placed_pos = mul(float4(pos, 1.0f), get_transform(instance));
+    return mul(mul(float4(placed_pos, 1.0f), matWorld[mat_index]), matShadow[cascade]);
+}
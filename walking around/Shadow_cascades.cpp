@@ -0,0 +1,74 @@
+#include "Shadow_cascades.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace shadow_cascades {
+namespace {
+
+math::vector cross3(math::vector a, math::vector b) {
+    float ax = math::get_x(a), ay = math::get_y(a), az = math::get_z(a);
+    float bx = math::get_x(b), by = math::get_y(b), bz = math::get_z(b);
+    return math::set(ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx, 0);
+}
+
+} // namespace
+
+void get_splits(float near_z, float far_z, unsigned int count, float lambda, float *splits) {
+    for (unsigned int i = 1; i < count; i++) {
+        float t = static_cast<float>(i) / count;
+        float logarithmic = near_z * std::pow(far_z / near_z, t);
+        float uniform = near_z + (far_z - near_z) * t;
+        splits[i - 1] = lambda * logarithmic + (1 - lambda) * uniform;
+    }
+    splits[count - 1] = far_z;
+}
+
+cascade_t fit(const math::matrix &view, const math::matrix &proj, float near_z, float far_z,
+              math::vector light_direction, unsigned int resolution) {
+    // the slice's corners at depth d are d * tan_x and d * tan_y off the view's axis, the
+    // sphere's center is on the axis where the near and far corners are as far from it, or
+    // at the far end when that is closer
+    float tan_x = 1 / math::get_x(proj.r[0]), tan_y = 1 / math::get_y(proj.r[1]);
+    float spread = tan_x * tan_x + tan_y * tan_y;
+    float center_z = (std::min)((near_z + far_z) * (1 + spread) / 2, far_z);
+    float to_near = center_z - near_z, to_far = far_z - center_z;
+    float radius = std::sqrt((std::max)(near_z * near_z * spread + to_near * to_near,
+                                        far_z * far_z * spread + to_far * to_far));
+    // on a grid of its own, so the texels' size is the same every frame to the bit
+    radius = std::ceil(radius * 16) / 16;
+    // the map is a texel wider than the sphere, which then stays on it wherever the center
+    // is moved to in its texel
+    float texel_size = 2 * radius / (resolution - 1);
+    float half_width = texel_size * resolution / 2;
+    math::vector center = math::transform3(math::set(0, 0, center_z, 1), math::inverse(view));
+
+    // the light's axes only depend on its direction, so does the grid of texels
+    math::vector forward = math::scale(math::normalize3(light_direction), -1);
+    math::vector up = std::abs(math::get_y(forward)) > 0.99f ? math::set(0, 0, 1, 0)
+                                                             : math::set(0, 1, 0, 0);
+    math::vector right = math::normalize3(cross3(up, forward));
+    up = cross3(forward, right);
+    math::matrix axes = {{right, up, forward, math::set(0, 0, 0, 1)}};
+    math::matrix light_view = math::transpose(axes);
+
+    // the middle of the texel the center is in
+    float center_x = (std::floor(math::dot3(center, right) / texel_size) + 0.5f) * texel_size;
+    float center_y = (std::floor(math::dot3(center, up) / texel_size) + 0.5f) * texel_size;
+    float near_light = math::dot3(center, forward) - radius;
+    float depth_scale = 1 / (2 * radius);
+    math::matrix ortho = {{math::set(1 / half_width, 0, 0, 0),
+                           math::set(0, 1 / half_width, 0, 0), math::set(0, 0, depth_scale, 0),
+                           math::set(-center_x / half_width, -center_y / half_width,
+                                     -near_light * depth_scale, 1)}};
+    return {near_z, far_z, math::multiply(light_view, ortho), radius, texel_size};
+}
+
+Aabb_tree::frustum_t get_caster_frustum(const cascade_t &cascade) {
+    Aabb_tree::frustum_t frustum = Aabb_tree::get_frustum(cascade.view_proj);
+    // the near plane, z >= 0, keeps everything
+    frustum.planes[4] = {0, 0, 0, 1};
+    return frustum;
+}
+
+} // namespace shadow_cascades
@@ -0,0 +1,41 @@
+#pragma once
+#include "Aabb_tree.hpp"
+#include "Math.hpp"
+
+// the math of the directional light's cascaded shadow maps, without a GPU
+//
+// the view is cut at distances between the uniform and the logarithmic splits, every slice is
+// wrapped in the smallest sphere around it and looked at along the light by an orthographic
+// projection of the sphere's size: it doesn't change as the camera turns, and its center is
+// moved to whole texels of a grid fixed to the light, so the map's texels stay on the same
+// ground while the camera moves and the shadows' edges don't crawl
+//
+// whatever is between the light and a cascade casts into it, so the casters are culled by the
+// cascade's sides and far plane only, the passes clamp the depth of the ones nearer the light
+namespace shadow_cascades {
+
+struct cascade_t {
+    public:
+        // the view space depths the slice starts and ends at
+        float near_z, far_z;
+        // from the world to the map, untransposed, x and y from -1 to 1 across the map, the
+        // depth from 0 to 1 along the light
+        math::matrix view_proj;
+        // the sphere's radius, and a texel's side in the world
+        float radius, texel_size;
+};
+
+// the far depth of each of count slices from near_z to far_z, splits[count - 1] is far_z,
+// lambda blends the uniform splits at 0 with the logarithmic ones at 1
+void get_splits(float near_z, float far_z, unsigned int count, float lambda, float *splits);
+
+// the cascade of the view's slice from near_z to far_z, proj is like math::perspective_fov_lh()
+// and only its scales are read, light_direction points at the light like the shaders' dirLight,
+// resolution is the map's side in texels
+cascade_t fit(const math::matrix &view, const math::matrix &proj, float near_z, float far_z,
+              math::vector light_direction, unsigned int resolution);
+
+// the cascade's sides and far plane, what its casters are culled with
+Aabb_tree::frustum_t get_caster_frustum(const cascade_t &cascade);
+
+} // namespace shadow_cascades
@@ -0,0 +1,189 @@
+#include "Shadow_cascades_benchmark.hpp"
+#include "Shadow_cascades.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int cascade_count = 4;
+constexpr float near_z = 0.1f, shadow_distance = 60;
+constexpr float split_lambda = 0.8f;
+constexpr unsigned int resolution = 1024;
+constexpr unsigned int frame_count = 200;
+// how far off its map a slice's corner may be, in the map's -1 to 1
+constexpr float cover_tolerance = 1e-4f;
+
+using box_t = Aabb_tree::box_t;
+
+double microseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end_point - start_point).count();
+}
+
+// around a circle on the ground, turning faster than it goes round and nodding
+math::matrix get_view(unsigned int frame) {
+    float t = static_cast<float>(frame);
+    float x = 30 * std::cos(t * 0.01f), z = 30 * std::sin(t * 0.01f);
+    return math::multiply(math::multiply(math::translation(-x, -1.7f, -z),
+                                         math::rotation_y(-0.013f * t)),
+                          math::rotation_x(0.2f * std::sin(0.02f * t)));
+}
+
+math::float4 to_map(const math::float3 &p, const math::matrix &view_proj) {
+    math::vector v = math::transform3(math::set(p.x, p.y, p.z, 1), view_proj);
+    return {math::get_x(v), math::get_y(v), math::get_z(v), math::get_w(v)};
+}
+
+// in the cascade or between it and the light
+bool in_caster_volume(const math::float4 &p) {
+    return std::abs(p.x) <= 1 && std::abs(p.y) <= 1 && p.z <= 1;
+}
+
+// the corners, the edges' middles, the faces' centers and the center
+bool reaches_caster_volume(const box_t &box, const math::matrix &view_proj) {
+    const float xs[3] = {box.min.x, (box.min.x + box.max.x) / 2, box.max.x};
+    const float ys[3] = {box.min.y, (box.min.y + box.max.y) / 2, box.max.y};
+    const float zs[3] = {box.min.z, (box.min.z + box.max.z) / 2, box.max.z};
+    for (float x : xs) {
+        for (float y : ys) {
+            for (float z : zs) {
+                if (in_caster_volume(to_map({x, y, z}, view_proj))) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// where a point falls in its texel along x and y, from 0 to 1
+void get_texel_offsets(const math::float3 &p, const math::matrix &view_proj, float &x,
+                       float &y) {
+    math::float4 map = to_map(p, view_proj);
+    float u = (map.x * 0.5f + 0.5f) * resolution, v = (map.y * 0.5f + 0.5f) * resolution;
+    x = u - std::floor(u);
+    y = v - std::floor(v);
+}
+
+// how far apart two offsets in a texel are, across its sides too
+float offset_distance(float a, float b) {
+    float d = std::abs(a - b);
+    return (std::min)(d, 1 - d);
+}
+} // namespace
+
+std::string benchmark_shadow_cascades(unsigned int box_count) {
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> ground(-100, 100), size(0.5f, 4), tall(0.5f, 12);
+    std::vector<box_t> boxes(box_count);
+    for (box_t &box : boxes) {
+        float x = ground(generator), z = ground(generator), half = size(generator) / 2;
+        box = {{x - half, 0, z - half}, {x + half, tall(generator), z + half}};
+    }
+    const math::float3 grid_points[] = {{0, 0, 0}, {13.7f, 2.5f, -41.2f}, {-27.1f, 0.3f, 8.9f}};
+
+    math::matrix proj = math::perspective_fov_lh(math::pi / 4, 16.0f / 9, near_z, 100);
+    float tan_x = 1 / math::get_x(proj.r[0]), tan_y = 1 / math::get_y(proj.r[1]);
+    math::vector light_direction = math::set(1, 1, 1, 0);
+    float splits[cascade_count];
+    shadow_cascades::get_splits(near_z, shadow_distance, cascade_count, split_lambda, splits);
+    bool increasing = true;
+    for (unsigned int i = 0; i < cascade_count; i++) {
+        increasing = increasing && splits[i] > (i == 0 ? near_z : splits[i - 1]);
+    }
+
+    double fit_microseconds = 0, cull_microseconds = 0;
+    unsigned int corners_off = 0, wrongly_culled = 0;
+    bool same_texels = true;
+    float grid_drift = 0;
+    unsigned int kept[cascade_count] = {}, toward_light[cascade_count] = {};
+    float texel_sizes[cascade_count] = {};
+    float first_offsets[cascade_count][std::size(grid_points)][2] = {};
+    std::vector<char> keep(box_count);
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        math::matrix view = get_view(frame);
+        shadow_cascades::cascade_t cascades[cascade_count];
+        auto start_point = std::chrono::high_resolution_clock::now();
+        for (unsigned int i = 0; i < cascade_count; i++) {
+            cascades[i] = shadow_cascades::fit(view, proj, i == 0 ? near_z : splits[i - 1],
+                                               splits[i], light_direction, resolution);
+        }
+        fit_microseconds += microseconds_since(start_point);
+
+        math::matrix camera = math::inverse(view);
+        for (unsigned int i = 0; i < cascade_count; i++) {
+            const shadow_cascades::cascade_t &cascade = cascades[i];
+            for (unsigned int corner = 0; corner < 8; corner++) {
+                float d = corner & 4 ? cascade.far_z : cascade.near_z;
+                math::vector p = math::transform3(
+                    math::set(corner & 1 ? d * tan_x : -d * tan_x,
+                              corner & 2 ? d * tan_y : -d * tan_y, d, 1),
+                    camera);
+                math::float4 map = to_map({math::get_x(p), math::get_y(p), math::get_z(p)},
+                                          cascade.view_proj);
+                corners_off += std::abs(map.x) > 1 + cover_tolerance
+                               || std::abs(map.y) > 1 + cover_tolerance
+                               || map.z < -cover_tolerance || map.z > 1 + cover_tolerance;
+            }
+            if (frame == 0) {
+                texel_sizes[i] = cascade.texel_size;
+            }
+            same_texels = same_texels && cascade.texel_size == texel_sizes[i];
+            for (std::size_t j = 0; j < std::size(grid_points); j++) {
+                float x, y;
+                get_texel_offsets(grid_points[j], cascade.view_proj, x, y);
+                if (frame == 0) {
+                    first_offsets[i][j][0] = x;
+                    first_offsets[i][j][1] = y;
+                }
+                grid_drift = (std::max)({grid_drift, offset_distance(x, first_offsets[i][j][0]),
+                                         offset_distance(y, first_offsets[i][j][1])});
+            }
+        }
+
+        for (unsigned int i = 0; i < cascade_count; i++) {
+            start_point = std::chrono::high_resolution_clock::now();
+            Aabb_tree::frustum_t casters = shadow_cascades::get_caster_frustum(cascades[i]);
+            for (unsigned int j = 0; j < box_count; j++) {
+                keep[j] = Aabb_tree::intersects(casters, boxes[j]);
+            }
+            cull_microseconds += microseconds_since(start_point);
+
+            Aabb_tree::frustum_t slice = Aabb_tree::get_frustum(cascades[i].view_proj);
+            for (unsigned int j = 0; j < box_count; j++) {
+                kept[i] += keep[j];
+                toward_light[i] += keep[j] && !Aabb_tree::intersects(slice, boxes[j]);
+                wrongly_culled += !keep[j]
+                                  && reaches_caster_volume(boxes[j], cascades[i].view_proj);
+            }
+        }
+    }
+
+    std::stringstream s;
+    s << "shadow cascades: " << cascade_count << " of " << resolution << "x" << resolution
+      << " on " << math::backend << " split at";
+    for (float split : splits) {
+        s << " " << split;
+    }
+    s << (increasing ? "" : " out of order") << ", fitted in "
+      << fit_microseconds / frame_count << " us a frame, " << corners_off
+      << " slice corners off their maps\n";
+    s << "shadow cascades: texels of";
+    for (float texel_size : texel_sizes) {
+        s << " " << texel_size;
+    }
+    s << (same_texels ? " every frame" : " changing") << ", their grid on the ground moved "
+      << grid_drift << " texels over " << frame_count << " frames\n";
+    s << "shadow cascades: of " << box_count << " boxes kept as casters";
+    for (unsigned int i = 0; i < cascade_count; i++) {
+        s << (i == 0 ? " " : ", ") << kept[i] / frame_count << " ("
+          << toward_light[i] / frame_count << " only toward the light)";
+    }
+    s << " a frame, culled in " << cull_microseconds / frame_count << " us, " << wrongly_culled
+      << " culled that reach a cascade\n";
+    return s.str();
+}
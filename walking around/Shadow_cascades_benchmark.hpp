@@ -0,0 +1,9 @@
+#pragma once
+#include <string>
+
+// a camera walking and turning over box_count boxes standing on the ground, with cascades like
+// the game's fitted every frame: the splits, how long the fits take and whether every slice's
+// corners are on its map, whether the texels' size and their grid on the ground stay put,
+// then how many boxes every cascade keeps as casters and how long that takes, counting any
+// culled box part of which is in the cascade or between it and the light, one line each
+std::string benchmark_shadow_cascades(unsigned int box_count);
@@ -0,0 +1,289 @@
+#include "Shadow_maps.hpp"
+#include "Utility.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+D3D12_RESOURCE_BARRIER get_barrier(ID3D12Resource *resource, UINT subresource,
+                                   D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after) {
+    D3D12_RESOURCE_BARRIER barrier = {};
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Transition.pResource = resource;
+    barrier.Transition.Subresource = subresource;
+    barrier.Transition.StateBefore = before;
+    barrier.Transition.StateAfter = after;
+    return barrier;
+}
+
+} // namespace
+
+void Shadow_maps::init(ComPtr<ID3D12Device> &device, ComPtr<ID3D12CommandQueue> &command_queue,
+                       unsigned int frame_count, unsigned int _cascade_count,
+                       unsigned int _resolution, double _budget,
+                       const D3D12_CPU_DESCRIPTOR_HANDLE &srv_handle,
+                       const D3D12_VERTEX_BUFFER_VIEW &identity_instance) {
+    cascade_count = _cascade_count;
+    resolution = _resolution;
+    budget = _budget;
+
+    D3D12_HEAP_PROPERTIES heap_properties = {.Type = D3D12_HEAP_TYPE_DEFAULT,
+                                             .CPUPageProperty =
+                                                 D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
+                                             .MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
+                                             .CreationNodeMask = 1,
+                                             .VisibleNodeMask = 1};
+    // typeless, so the passes write it as depth and the pixel shader reads it as floats
+    D3D12_RESOURCE_DESC desc = {.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+                                .Alignment = 0,
+                                .Width = resolution,
+                                .Height = resolution,
+                                .DepthOrArraySize = static_cast<UINT16>(cascade_count),
+                                .MipLevels = 1,
+                                .Format = DXGI_FORMAT_R32_TYPELESS,
+                                .SampleDesc = {.Count = 1, .Quality = 0},
+                                .Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
+                                .Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL};
+    D3D12_CLEAR_VALUE clear_value = {.Format = DXGI_FORMAT_D32_FLOAT,
+                                     .DepthStencil = {.Depth = 1.0f, .Stencil = 0}};
+    // the slices are read between the passes, which turn their own slice into a depth target
+    check_output(device->CreateCommittedResource(
+        &heap_properties, D3D12_HEAP_FLAG_NONE, &desc,
+        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, &clear_value, IID_PPV_ARGS(&texture)));
+
+    D3D12_DESCRIPTOR_HEAP_DESC heap_desc = {.Type = D3D12_DESCRIPTOR_HEAP_TYPE_DSV,
+                                            .NumDescriptors = cascade_count,
+                                            .Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE,
+                                            .NodeMask = 0};
+    check_output(device->CreateDescriptorHeap(&heap_desc, IID_PPV_ARGS(&dsv_heap)));
+    UINT increment = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
+    views.resize(cascade_count);
+    for (unsigned int i = 0; i < cascade_count; i++) {
+        D3D12_DEPTH_STENCIL_VIEW_DESC view_desc = {
+            .Format = DXGI_FORMAT_D32_FLOAT,
+            .ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2DARRAY,
+            .Flags = D3D12_DSV_FLAG_NONE,
+            .Texture2DArray = {.MipSlice = 0, .FirstArraySlice = i, .ArraySize = 1}};
+        views[i] = dsv_heap->GetCPUDescriptorHandleForHeapStart();
+        views[i].ptr += i * increment;
+        device->CreateDepthStencilView(texture.Get(), &view_desc, views[i]);
+    }
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srv_desc = {
+        .Format = DXGI_FORMAT_R32_FLOAT,
+        .ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY,
+        .Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+        .Texture2DArray = {.MostDetailedMip = 0,
+                           .MipLevels = 1,
+                           .FirstArraySlice = 0,
+                           .ArraySize = cascade_count,
+                           .PlaneSlice = 0,
+                           .ResourceMinLODClamp = 0.0f},
+    };
+    device->CreateShaderResourceView(texture.Get(), &srv_desc, srv_handle);
+
+    D3D12_QUERY_HEAP_DESC query_heap_desc = {.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP,
+                                             .Count = frame_count * timestamps_per_frame,
+                                             .NodeMask = 0};
+    check_output(device->CreateQueryHeap(&query_heap_desc, IID_PPV_ARGS(&query_heap)));
+    heap_properties.Type = D3D12_HEAP_TYPE_READBACK;
+    D3D12_RESOURCE_DESC buffer_desc = {.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+                                       .Alignment = 0,
+                                       .Width = frame_count * timestamps_per_frame
+                                                * sizeof(UINT64),
+                                       .Height = 1,
+                                       .DepthOrArraySize = 1,
+                                       .MipLevels = 1,
+                                       .Format = DXGI_FORMAT_UNKNOWN,
+                                       .SampleDesc = {.Count = 1, .Quality = 0},
+                                       .Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                       .Flags = D3D12_RESOURCE_FLAG_NONE};
+    check_output(device->CreateCommittedResource(
+        &heap_properties, D3D12_HEAP_FLAG_NONE, &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST,
+        nullptr, IID_PPV_ARGS(&readback_buffer)));
+    check_output(command_queue->GetTimestampFrequency(&timestamp_frequency));
+    resolved.assign(frame_count, false);
+
+    cascades.resize(cascade_count);
+    due.assign(cascade_count, true);
+    queues.resize(cascade_count);
+    for (Render_queue &queue : queues) {
+        queue.init(identity_instance);
+    }
+    queue_statistics.resize(cascade_count);
+    recorder.init(device, frame_count, cascade_count);
+    frame = 0;
+    frames_since_change = 0;
+    statistics = {};
+}
+
+void Shadow_maps::update(const math::matrix &view, const math::matrix &proj, float near_z,
+                         float far_z, float split_lambda, math::vector light_direction) {
+    std::vector<float> splits(cascade_count);
+    shadow_cascades::get_splits(near_z, far_z, cascade_count, split_lambda, splits.data());
+    // in turns, so about as many cascades are drawn every frame
+    unsigned int interval = statistics.refresh_interval;
+    for (unsigned int i = 0; i < cascade_count; i++) {
+        due[i] = i < always_drawn || (frame + i) % interval == 0;
+        queues[i].clear();
+        if (due[i]) {
+            cascades[i] = shadow_cascades::fit(view, proj, i == 0 ? near_z : splits[i - 1],
+                                               splits[i], light_direction, resolution);
+        }
+    }
+    frame++;
+}
+
+unsigned int Shadow_maps::get_cascade_count() {
+    return cascade_count;
+}
+
+bool Shadow_maps::is_due(unsigned int cascade) {
+    return due[cascade];
+}
+
+Render_queue &Shadow_maps::get_queue(unsigned int cascade) {
+    return queues[cascade];
+}
+
+Aabb_tree::frustum_t Shadow_maps::get_caster_frustum(unsigned int cascade) {
+    return shadow_cascades::get_caster_frustum(cascades[cascade]);
+}
+
+void Shadow_maps::fill_const_buffer(Shader_const_buffer &buff) {
+    float splits[SHADOW_CASCADE_COUNT] = {}, texel_sizes[SHADOW_CASCADE_COUNT] = {};
+    for (unsigned int i = 0; i < cascade_count; i++) {
+        math::store_column_major(buff.matShadow[i], cascades[i].view_proj);
+        splits[i] = cascades[i].far_z;
+        texel_sizes[i] = cascades[i].texel_size;
+    }
+    std::memcpy(&buff.cascadeSplits, splits, sizeof(splits));
+    std::memcpy(&buff.cascadeTexelSizes, texel_sizes, sizeof(texel_sizes));
+}
+
+void Shadow_maps::record_cascade(ComPtr<ID3D12GraphicsCommandList> &command_list,
+                                 ID3D12PipelineState *pipeline_state, unsigned int cascade,
+                                 unsigned int frame_index) {
+    if (cascade == 0) {
+        command_list->EndQuery(query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
+                               frame_index * timestamps_per_frame);
+    }
+    if (due[cascade]) {
+        D3D12_RESOURCE_BARRIER barrier =
+            get_barrier(texture.Get(), cascade, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                        D3D12_RESOURCE_STATE_DEPTH_WRITE);
+        command_list->ResourceBarrier(1, &barrier);
+        command_list->ClearDepthStencilView(views[cascade], D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0,
+                                            nullptr);
+
+        D3D12_VIEWPORT viewport = {.TopLeftX = 0.0f,
+                                   .TopLeftY = 0.0f,
+                                   .Width = static_cast<float>(resolution),
+                                   .Height = static_cast<float>(resolution),
+                                   .MinDepth = 0.0f,
+                                   .MaxDepth = 1.0f};
+        D3D12_RECT scissor_rect = {.left = 0,
+                                   .top = 0,
+                                   .right = static_cast<LONG>(resolution),
+                                   .bottom = static_cast<LONG>(resolution)};
+        command_list->RSSetViewports(1, &viewport);
+        command_list->RSSetScissorRects(1, &scissor_rect);
+        command_list->OMSetRenderTargets(0, nullptr, FALSE, &views[cascade]);
+        command_list->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        command_list->SetGraphicsRoot32BitConstant(cascade_argument, cascade, 0);
+
+        queues[cascade].record(command_list, pipeline_state, 0, queues[cascade].size(),
+                               queue_statistics[cascade]);
+
+        std::swap(barrier.Transition.StateBefore, barrier.Transition.StateAfter);
+        command_list->ResourceBarrier(1, &barrier);
+    }
+    if (cascade + 1 == cascade_count) {
+        command_list->EndQuery(query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
+                               frame_index * timestamps_per_frame + 1);
+    }
+}
+
+void Shadow_maps::record(Job_system &job_system, unsigned int frame_index,
+                         ID3D12PipelineState *pipeline_state, const set_state_function &set_state,
+                         std::vector<ID3D12CommandList *> &lists) {
+    auto start_point = std::chrono::high_resolution_clock::now();
+    statistics.cascades_drawn = 0;
+    statistics.casters = 0;
+    for (unsigned int i = 0; i < cascade_count; i++) {
+        queues[i].sort();
+        queue_statistics[i] = {};
+        statistics.cascades_drawn += due[i];
+        statistics.casters += queues[i].size();
+    }
+
+    recorder.record(job_system, frame_index, pipeline_state,
+                    [&](ComPtr<ID3D12GraphicsCommandList> &command_list, unsigned int worker,
+                        unsigned int worker_count) {
+                        set_state(command_list);
+                        record_cascade(command_list, pipeline_state, worker, frame_index);
+                    });
+    recorder.append_command_lists(frame_index, lists);
+    statistics.draws = {};
+    for (const Render_queue::statistics_t &queue : queue_statistics) {
+        statistics.draws.add(queue);
+    }
+
+    auto end_point = std::chrono::high_resolution_clock::now();
+    statistics.record_microseconds =
+        std::chrono::duration<double, std::micro>(end_point - start_point).count();
+}
+
+void Shadow_maps::end_frame(ComPtr<ID3D12GraphicsCommandList> &command_list,
+                            unsigned int frame_index) {
+    UINT first = frame_index * timestamps_per_frame;
+    command_list->EndQuery(query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, first + 2);
+    command_list->ResolveQueryData(query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, first,
+                                   timestamps_per_frame, readback_buffer.Get(),
+                                   first * sizeof(UINT64));
+    resolved[frame_index] = true;
+}
+
+void Shadow_maps::finish_frame(unsigned int frame_index) {
+    if (!resolved[frame_index]) {
+        return;
+    }
+    resolved[frame_index] = false;
+    UINT64 timestamps[timestamps_per_frame];
+    SIZE_T first = frame_index * timestamps_per_frame * sizeof(UINT64);
+    D3D12_RANGE read_range = {first, first + sizeof(timestamps)};
+    void *data;
+    check_output(readback_buffer->Map(0, &read_range, &data));
+    std::memcpy(timestamps, static_cast<char *>(data) + first, sizeof(timestamps));
+    D3D12_RANGE written_range = {0, 0};
+    readback_buffer->Unmap(0, &written_range);
+
+    double milliseconds_per_tick = 1'000.0 / timestamp_frequency;
+    statistics.gpu_milliseconds = (timestamps[1] - timestamps[0]) * milliseconds_per_tick;
+    statistics.gpu_frame_milliseconds = (timestamps[2] - timestamps[0]) * milliseconds_per_tick;
+    if (statistics.gpu_frame_milliseconds <= 0) {
+        return;
+    }
+    double share = statistics.gpu_milliseconds / statistics.gpu_frame_milliseconds;
+    statistics.share += (share - statistics.share) * share_smoothing;
+
+    // doubled past the budget, halved again well under it
+    if (++frames_since_change < settle_frames) {
+        return;
+    }
+    unsigned int &interval = statistics.refresh_interval;
+    if (statistics.share > budget && interval < max_refresh_interval) {
+        interval *= 2;
+        frames_since_change = 0;
+    } else if (statistics.share < budget / 2 && interval > 1) {
+        interval /= 2;
+        frames_since_change = 0;
+    }
+}
+
+const Shadow_maps::statistics_t &Shadow_maps::get_statistics() {
+    return statistics;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "Windows_includes.hpp"
+
+#include "Job_system.hpp"
+#include "Parallel_recorder.hpp"
+#include "Render_queue.hpp"
+#include "Shader_const_buffer.hpp"
+#include "Shadow_cascades.hpp"
+
+#include <functional>
+#include <vector>
+
+// the directional light's cascades, every one a slice of a depth texture array drawn from its
+// own queue of the casters culled to it, the passes are recorded at the same time on the job
+// system, a list per cascade, and go ahead of the frame's lists
+//
+// timestamps around the passes and at the end of the frame give the passes' share of the GPU's
+// frame time, past the budget the cascades after the first two are redrawn every other frame,
+// then every fourth, in turns, and keep the matrices they were last drawn with until then
+class Shadow_maps {
+    public:
+        // root parameters, the maps' table at t1 for the pixel shader and the cascade a pass
+        // draws at b3
+        constexpr static UINT shadow_map_argument = 3;
+        constexpr static UINT cascade_argument = 4;
+
+        struct statistics_t {
+            public:
+                // of the last frame
+                unsigned int cascades_drawn = 0;
+                unsigned int casters = 0;
+                // the passes' draws and state changes, summed over the cascades
+                Render_queue::statistics_t draws;
+                double record_microseconds = 0;
+                // of the last frame the GPU finished
+                double gpu_milliseconds = 0;
+                double gpu_frame_milliseconds = 0;
+                // the passes' share of the GPU's frame time, smoothed over the frames
+                double share = 0;
+                unsigned int refresh_interval = 1;
+        };
+
+        // binds the root signature, the descriptor heap and what every list shares
+        using set_state_function = std::function<void(ComPtr<ID3D12GraphicsCommandList> &)>;
+
+    private:
+        // the cascades redrawn every frame however far over the budget the passes are
+        constexpr static unsigned int always_drawn = 2;
+        constexpr static unsigned int max_refresh_interval = 4;
+        // frames between changes of the interval, so a change shows in the share first
+        constexpr static unsigned int settle_frames = 30;
+        constexpr static double share_smoothing = 0.1;
+        // the start of the passes, their end and the end of the frame
+        constexpr static unsigned int timestamps_per_frame = 3;
+
+        unsigned int cascade_count = 0, resolution = 0;
+        double budget = 0;
+
+        ComPtr<ID3D12Resource> texture;
+        ComPtr<ID3D12DescriptorHeap> dsv_heap;
+        std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> views;
+
+        std::vector<shadow_cascades::cascade_t> cascades;
+        std::vector<bool> due;
+        std::vector<Render_queue> queues;
+        std::vector<Render_queue::statistics_t> queue_statistics;
+        Parallel_recorder recorder;
+
+        ComPtr<ID3D12QueryHeap> query_heap;
+        ComPtr<ID3D12Resource> readback_buffer;
+        std::vector<bool> resolved;
+        UINT64 timestamp_frequency = 0;
+
+        unsigned int frame = 0, frames_since_change = 0;
+        statistics_t statistics;
+
+        void record_cascade(ComPtr<ID3D12GraphicsCommandList> &command_list,
+                            ID3D12PipelineState *pipeline_state, unsigned int cascade,
+                            unsigned int frame_index);
+
+    public:
+        // the maps' view is written to srv_handle, budget is the largest share of the GPU's
+        // frame time the passes should take, the queues are given identity_instance
+        void init(ComPtr<ID3D12Device> &device, ComPtr<ID3D12CommandQueue> &command_queue,
+                  unsigned int frame_count, unsigned int _cascade_count,
+                  unsigned int _resolution, double _budget,
+                  const D3D12_CPU_DESCRIPTOR_HANDLE &srv_handle,
+                  const D3D12_VERTEX_BUFFER_VIEW &identity_instance);
+
+        // fits the cascades redrawn this frame to the view's slices out to far_z, and empties
+        // their queues
+        void update(const math::matrix &view, const math::matrix &proj, float near_z,
+                    float far_z, float split_lambda, math::vector light_direction);
+
+        unsigned int get_cascade_count();
+
+        // whether the cascade is redrawn this frame, its queue stays empty otherwise
+        bool is_due(unsigned int cascade);
+
+        // the casters of the cascade, submitted with the shadow passes' pipeline
+        Render_queue &get_queue(unsigned int cascade);
+
+        Aabb_tree::frustum_t get_caster_frustum(unsigned int cascade);
+
+        // the cascades' matrices, where they end and their texels' size, as last drawn
+        void fill_const_buffer(Shader_const_buffer &buff);
+
+        // sorts the queues and records the passes, their lists are appended to lists
+        void record(Job_system &job_system, unsigned int frame_index,
+                    ID3D12PipelineState *pipeline_state, const set_state_function &set_state,
+                    std::vector<ID3D12CommandList *> &lists);
+
+        // the frame's last timestamp, into the last list of the frame before it is closed
+        void end_frame(ComPtr<ID3D12GraphicsCommandList> &command_list, unsigned int frame_index);
+
+        // reads the frame's timestamps once the GPU finished it and moves the interval
+        void finish_frame(unsigned int frame_index);
+
+        const statistics_t &get_statistics();
+};
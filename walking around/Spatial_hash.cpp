@@ -0,0 +1,188 @@
+#include "Spatial_hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+int Spatial_hash::get_cell(float coordinate) const {
+    return static_cast<int>(std::floor(coordinate * inverse_cell_size));
+}
+
+unsigned int Spatial_hash::get_bucket(int cell_x, int cell_z) const {
+    // the primes of Teschner et al., "Optimized Spatial Hashing for Collision Detection of
+    // Deformable Objects"
+    return ((static_cast<unsigned int>(cell_x) * 73856093u)
+            ^ (static_cast<unsigned int>(cell_z) * 19349663u))
+           & bucket_mask;
+}
+
+void Spatial_hash::place(unsigned int item) {
+    item_t &placed = items[item];
+    placed.cell_x = get_cell(placed.circle.x);
+    placed.cell_z = get_cell(placed.circle.z);
+    placed.bucket = get_bucket(placed.cell_x, placed.cell_z);
+    std::vector<unsigned int> &bucket = buckets[placed.bucket];
+    placed.slot = static_cast<unsigned int>(bucket.size());
+    bucket.push_back(item);
+}
+
+void Spatial_hash::unplace(unsigned int item) {
+    item_t &placed = items[item];
+    std::vector<unsigned int> &bucket = buckets[placed.bucket];
+    // the last one takes its slot
+    unsigned int last = bucket.back();
+    bucket[placed.slot] = last;
+    items[last].slot = placed.slot;
+    bucket.pop_back();
+}
+
+template <typename Visit>
+void Spatial_hash::visit_area(float min_x, float min_z, float max_x, float max_z,
+                              Visit visit) const {
+    int first_x = get_cell(min_x - max_radius), last_x = get_cell(max_x + max_radius);
+    int first_z = get_cell(min_z - max_radius), last_z = get_cell(max_z + max_radius);
+    double cell_count = (static_cast<double>(last_x) - first_x + 1) * (last_z - first_z + 1);
+
+    // an area of more cells than items is cheaper to scan item by item
+    if (cell_count > static_cast<double>(count)) {
+        for (unsigned int i = 0; i < items.size(); i++) {
+            if (items[i].bucket != no_item) {
+                visit(i, items[i].circle);
+            }
+        }
+        return;
+    }
+    for (int z = first_z; z <= last_z; z++) {
+        for (int x = first_x; x <= last_x; x++) {
+            for (unsigned int i : buckets[get_bucket(x, z)]) {
+                // other cells can share the bucket, they are visited on their own
+                const item_t &item = items[i];
+                if (item.cell_x == x && item.cell_z == z) {
+                    visit(i, item.circle);
+                }
+            }
+        }
+    }
+}
+
+void Spatial_hash::init(float _cell_size, unsigned int bucket_count) {
+    cell_size = _cell_size;
+    inverse_cell_size = 1 / cell_size;
+    buckets.assign(std::bit_ceil((std::max)(bucket_count, 1u)), {});
+    bucket_mask = static_cast<unsigned int>(buckets.size()) - 1;
+    items.clear();
+    free_items.clear();
+    max_radius = 0;
+    count = 0;
+}
+
+unsigned int Spatial_hash::insert(const circle_t &circle) {
+    unsigned int item;
+    if (!free_items.empty()) {
+        item = free_items.back();
+        free_items.pop_back();
+    } else {
+        item = static_cast<unsigned int>(items.size());
+        items.emplace_back();
+    }
+    items[item].circle = circle;
+    max_radius = (std::max)(max_radius, circle.radius);
+    place(item);
+    count++;
+    return item;
+}
+
+void Spatial_hash::move(unsigned int item, float x, float z) {
+    item_t &moved = items[item];
+    moved.circle.x = x;
+    moved.circle.z = z;
+    if (get_cell(x) != moved.cell_x || get_cell(z) != moved.cell_z) {
+        unplace(item);
+        place(item);
+    }
+}
+
+void Spatial_hash::remove(unsigned int item) {
+    if (item >= items.size() || items[item].bucket == no_item) {
+        throw std::runtime_error("the spatial hash has no such item");
+    }
+    unplace(item);
+    items[item].bucket = no_item;
+    free_items.push_back(item);
+    count--;
+}
+
+void Spatial_hash::query_radius(float x, float z, float radius,
+                                std::vector<unsigned int> &out) const {
+    visit_area(x - radius, z - radius, x + radius, z + radius,
+               [&](unsigned int item, const circle_t &circle) {
+                   float dx = circle.x - x, dz = circle.z - z, reach = circle.radius + radius;
+                   if (dx * dx + dz * dz <= reach * reach) {
+                       out.push_back(item);
+                   }
+               });
+}
+
+void Spatial_hash::query_box(float min_x, float min_z, float max_x, float max_z,
+                             std::vector<unsigned int> &out) const {
+    visit_area(min_x, min_z, max_x, max_z, [&](unsigned int item, const circle_t &circle) {
+        // from the box's closest point
+        float dx = circle.x - (std::clamp)(circle.x, min_x, max_x);
+        float dz = circle.z - (std::clamp)(circle.z, min_z, max_z);
+        if (dx * dx + dz * dz <= circle.radius * circle.radius) {
+            out.push_back(item);
+        }
+    });
+}
+
+void Spatial_hash::rebuild(const std::vector<circle_t> &circles, Job_system *job_system) {
+    unsigned int circle_count = static_cast<unsigned int>(circles.size());
+    items.resize(circle_count);
+    free_items.clear();
+    count = circle_count;
+
+    auto find_cells = [&](unsigned int first, unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            item_t &item = items[i];
+            item.circle = circles[i];
+            item.cell_x = get_cell(item.circle.x);
+            item.cell_z = get_cell(item.circle.z);
+            item.bucket = get_bucket(item.cell_x, item.cell_z);
+        }
+    };
+    // every range of buckets scans the items for its own, so the ranges share nothing and
+    // each bucket keeps the items in id order
+    auto fill_buckets = [&](unsigned int first, unsigned int end) {
+        for (unsigned int b = first; b < end; b++) {
+            buckets[b].clear();
+        }
+        for (unsigned int i = 0; i < circle_count; i++) {
+            item_t &item = items[i];
+            if (item.bucket >= first && item.bucket < end) {
+                item.slot = static_cast<unsigned int>(buckets[item.bucket].size());
+                buckets[item.bucket].push_back(i);
+            }
+        }
+    };
+
+    unsigned int bucket_count = static_cast<unsigned int>(buckets.size());
+    if (job_system) {
+        job_system->parallel_for(0, circle_count, 0, find_cells);
+        unsigned int threads = job_system->get_thread_count();
+        job_system->parallel_for(0, bucket_count, (bucket_count + threads - 1) / threads,
+                                 fill_buckets);
+    } else {
+        find_cells(0, circle_count);
+        fill_buckets(0, bucket_count);
+    }
+
+    max_radius = 0;
+    for (const circle_t &circle : circles) {
+        max_radius = (std::max)(max_radius, circle.radius);
+    }
+}
+
+unsigned int Spatial_hash::get_count() const {
+    return count;
+}
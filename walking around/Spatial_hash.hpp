@@ -0,0 +1,73 @@
+#pragma once
+#include "Job_system.hpp"
+
+#include <vector>
+
+// circles on the ground plane (x, z) in a uniform grid of cells, the cells hashed into a fixed
+// number of buckets so the world needs no bounds, a circle is kept in the cell of its center
+// and queries look max_radius further, so the cells should be about as large as the circles
+// and the query radii
+class Spatial_hash {
+    public:
+        constexpr static unsigned int no_item = ~0u;
+
+        struct circle_t {
+            public:
+                float x, z, radius;
+        };
+
+    private:
+        struct item_t {
+            public:
+                circle_t circle;
+                int cell_x, cell_z;
+                unsigned int bucket = no_item; // no_item once removed
+                unsigned int slot;             // index in the bucket
+        };
+
+        float cell_size = 1, inverse_cell_size = 1;
+        unsigned int bucket_mask = 0;
+        std::vector<std::vector<unsigned int>> buckets;
+        std::vector<item_t> items;
+        std::vector<unsigned int> free_items;
+        // the largest radius inserted since the last rebuild, queries reach this far
+        float max_radius = 0;
+        unsigned int count = 0;
+
+        int get_cell(float coordinate) const;
+
+        unsigned int get_bucket(int cell_x, int cell_z) const;
+
+        void place(unsigned int item);
+
+        void unplace(unsigned int item);
+
+        // calls visit with every item whose cell is within the cells covering the area, each
+        // item once, visit does the exact test
+        template <typename Visit>
+        void visit_area(float min_x, float min_z, float max_x, float max_z, Visit visit) const;
+
+    public:
+        // bucket_count is rounded up to a power of two, about twice the items is plenty
+        void init(float _cell_size, unsigned int bucket_count);
+
+        // returns the item's id, ids of removed items are given out again
+        unsigned int insert(const circle_t &circle);
+
+        // only changes buckets when the center moves to another cell
+        void move(unsigned int item, float x, float z);
+
+        void remove(unsigned int item);
+
+        // the ids of the circles that overlap, appended to out
+        void query_radius(float x, float z, float radius, std::vector<unsigned int> &out) const;
+
+        void query_box(float min_x, float min_z, float max_x, float max_z,
+                       std::vector<unsigned int> &out) const;
+
+        // replaces every item with circles[i] as id i, the buckets are split between the
+        // job system's threads, job_system may be nullptr to rebuild on the calling thread
+        void rebuild(const std::vector<circle_t> &circles, Job_system *job_system);
+
+        unsigned int get_count() const;
+};
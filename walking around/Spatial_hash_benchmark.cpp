@@ -0,0 +1,118 @@
+#include "Spatial_hash_benchmark.hpp"
+#include "Spatial_hash.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr unsigned int repeats = 3;
+constexpr unsigned int move_steps = 10;
+constexpr unsigned int query_count = 10'000;
+constexpr unsigned int checked_queries = 200;
+constexpr float agent_radius = 0.5f;
+constexpr float query_radius = 3;
+constexpr float cell_size = 2;
+// the agents' density, square units per agent
+constexpr float area_per_agent = 16;
+
+double milliseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+           / 1'000'000.0;
+}
+
+template <typename Function> double best_milliseconds(Function function) {
+    double best = 1e30;
+    for (unsigned int i = 0; i < repeats; i++) {
+        auto start_point = std::chrono::high_resolution_clock::now();
+        function();
+        best = (std::min)(best, milliseconds_since(start_point));
+    }
+    return best;
+}
+} // namespace
+
+std::string benchmark_spatial_hash(unsigned int agent_count, Job_system &job_system) {
+    float side = std::sqrt(agent_count * area_per_agent);
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> position(0, side), velocity(-1, 1);
+
+    std::vector<Spatial_hash::circle_t> agents(agent_count);
+    std::vector<float> velocity_x(agent_count), velocity_z(agent_count);
+    for (unsigned int i = 0; i < agent_count; i++) {
+        agents[i] = {position(generator), position(generator), agent_radius};
+        velocity_x[i] = velocity(generator);
+        velocity_z[i] = velocity(generator);
+    }
+
+    Spatial_hash grid;
+    grid.init(cell_size, agent_count * 2);
+    std::stringstream s;
+    s << "spatial hash: " << agent_count << " agents, " << job_system.get_thread_count()
+      << " threads\n";
+
+    double serial_time = best_milliseconds([&] { grid.rebuild(agents, nullptr); });
+    double parallel_time = best_milliseconds([&] { grid.rebuild(agents, &job_system); });
+    s << "rebuild: " << serial_time << " ms on one thread, " << parallel_time
+      << " ms on the job system\n";
+
+    // a tenth of a second of walking per step, bouncing off the square's edges
+    auto start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int step = 0; step < move_steps; step++) {
+        for (unsigned int i = 0; i < agent_count; i++) {
+            Spatial_hash::circle_t &agent = agents[i];
+            agent.x += velocity_x[i] * 0.1f;
+            agent.z += velocity_z[i] * 0.1f;
+            if (agent.x < 0 || agent.x > side) {
+                velocity_x[i] = -velocity_x[i];
+            }
+            if (agent.z < 0 || agent.z > side) {
+                velocity_z[i] = -velocity_z[i];
+            }
+            grid.move(i, agent.x, agent.z);
+        }
+    }
+    s << "move: " << milliseconds_since(start_point) / move_steps << " ms for every agent\n";
+
+    std::vector<unsigned int> results;
+    std::size_t result_count = 0;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int q = 0; q < query_count; q++) {
+        const Spatial_hash::circle_t &agent = agents[q % agent_count];
+        results.clear();
+        grid.query_radius(agent.x, agent.z, query_radius, results);
+        result_count += results.size();
+    }
+    double query_time = milliseconds_since(start_point);
+
+    // the same queries against every agent, checked against the grid's answers
+    unsigned int mismatches = 0;
+    std::vector<unsigned int> expected;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int q = 0; q < checked_queries; q++) {
+        const Spatial_hash::circle_t &agent = agents[q % agent_count];
+        expected.clear();
+        for (unsigned int i = 0; i < agent_count; i++) {
+            float dx = agents[i].x - agent.x, dz = agents[i].z - agent.z;
+            float reach = agents[i].radius + query_radius;
+            if (dx * dx + dz * dz <= reach * reach) {
+                expected.push_back(i);
+            }
+        }
+        results.clear();
+        grid.query_radius(agent.x, agent.z, query_radius, results);
+        std::sort(results.begin(), results.end());
+        mismatches += results != expected;
+    }
+    double brute_force_time = milliseconds_since(start_point);
+
+    s << "radius queries: " << query_time * 1000 / query_count << " us each, "
+      << static_cast<double>(result_count) / query_count << " found on average, brute force "
+      << brute_force_time * 1000 / checked_queries << " us each, " << mismatches
+      << " of " << checked_queries << " differ\n";
+    return s.str();
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "Job_system.hpp"
+
+#include <string>
+
+// agent_count agents walking about: rebuilds on one thread and on the job system, moving them
+// all, radius queries and the same queries by brute force, one line each
+std::string benchmark_spatial_hash(unsigned int agent_count, Job_system &job_system);
@@ -0,0 +1,73 @@
+#pragma once
+#include "Job_system.hpp"
+#include "Upload_batch.hpp"
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <vector>
+
+// a batch of what Terrain_chunks and Cell_streamer stream in: every key's prepared_t is made by
+// its own job, the batch's last job creates the items from them and flushes the upload batch
+// they were created with
+template <typename key_t, typename prepared_t, typename item_t>
+class Streaming_batch {
+    public:
+        std::vector<key_t> keys;
+        // by keys, once the batch is done
+        std::vector<item_t> items;
+        // from the jobs starting to the upload finishing
+        double seconds = 0;
+
+    private:
+        std::vector<prepared_t> prepared;
+        std::chrono::high_resolution_clock::time_point start_point;
+        Job_counter built, uploaded;
+
+    public:
+        // prepare(key) runs on any thread, create(prepared) on the upload job, keys are filled
+        // in before and the batch stays where it is until wait()
+        template <typename prepare_function, typename create_function>
+        void start(Job_system &job_system, Upload_batch &upload_batch, prepare_function prepare,
+                   create_function create) {
+            prepared.resize(keys.size());
+            start_point = std::chrono::high_resolution_clock::now();
+            for (unsigned int i = 0; i < keys.size(); i++) {
+                job_system.run([this, prepare, i] { prepared[i] = prepare(keys[i]); }, built);
+            }
+            job_system.run_after(
+                built,
+                [this, &upload_batch, create] {
+                    for (prepared_t &made : prepared) {
+                        items.push_back(create(made));
+                    }
+                    upload_batch.flush();
+                    prepared.clear();
+                    auto end_point = std::chrono::high_resolution_clock::now();
+                    seconds = std::chrono::duration<double>(end_point - start_point).count();
+                },
+                uploaded);
+        }
+
+        bool done() const {
+            return uploaded.done();
+        }
+
+        // waits for both of batch's counters, drops it and rethrows what its jobs threw
+        static void wait(Job_system &job_system, std::unique_ptr<Streaming_batch> &batch) {
+            std::exception_ptr exception;
+            for (Job_counter *counter : {&batch->built, &batch->uploaded}) {
+                try {
+                    job_system.wait(*counter);
+                } catch (...) {
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if (exception) {
+                batch.reset();
+                std::rethrow_exception(exception);
+            }
+        }
+};
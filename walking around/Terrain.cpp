@@ -0,0 +1,212 @@
+#include "Terrain.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace terrain {
+namespace {
+
+constexpr unsigned int octaves = 5;
+// the largest hills' wavelength, every octave halves it
+constexpr float base_wavelength = 96;
+// how much every octave adds compared to the one before
+constexpr float persistence = 0.45f;
+// where the normals' differences are taken, about the finest quads' size
+constexpr float normal_step = 0.5f;
+// the skirts end this far below the lowest point along their chunk's sides
+constexpr float skirt_drop = 0.1f;
+
+// a hash of the lattice point in [-1, 1]
+float lattice(int x, int z) {
+    std::uint32_t h = static_cast<std::uint32_t>(x) * 0x8da6b343u
+                      ^ static_cast<std::uint32_t>(z) * 0xd8163841u;
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return static_cast<float>(h >> 8) * (2.0f / 16777215.0f) - 1;
+}
+
+float smooth(float t) {
+    return t * t * (3 - 2 * t);
+}
+
+struct wanted_t {
+    public:
+        chunk_key_t key;
+        float distance;
+};
+
+struct selection_t {
+    public:
+        math::float3 camera;
+        const Aabb_tree::frustum_t &frustum;
+        float lod_distance;
+        const std::function<bool(const chunk_key_t &)> &is_ready;
+        std::vector<chunk_key_t> &selected;
+        std::vector<wanted_t> wanted;
+
+        void select(const chunk_key_t &key) {
+            Aabb_tree::box_t box = get_chunk_box(key);
+            if (!Aabb_tree::intersects(frustum, box)) {
+                return;
+            }
+            float distance = Aabb_tree::get_distance(box, camera);
+            if (key.level > 0 && distance < lod_distance * get_chunk_size(key.level)) {
+                chunk_key_t children[4];
+                bool ready = true;
+                for (unsigned int i = 0; i < 4; i++) {
+                    children[i] = {key.level - 1, key.x * 2 + (i & 1), key.z * 2 + (i >> 1)};
+                    if (!is_ready(children[i])) {
+                        wanted.push_back({children[i], distance});
+                        ready = false;
+                    }
+                }
+                if (ready) {
+                    for (const chunk_key_t &child : children) {
+                        select(child);
+                    }
+                    return;
+                }
+            }
+            selected.push_back(key);
+        }
+};
+
+} // namespace
+
+std::uint64_t get_id(const chunk_key_t &key) {
+    return static_cast<std::uint64_t>(key.level) << 58 | static_cast<std::uint64_t>(key.x) << 29
+           | key.z;
+}
+
+float get_chunk_size(unsigned int level) {
+    return size / static_cast<float>(1u << (level_count - 1 - level));
+}
+
+Aabb_tree::box_t get_chunk_box(const chunk_key_t &key) {
+    float chunk_size = get_chunk_size(key.level);
+    float x = -size / 2 + key.x * chunk_size, z = -size / 2 + key.z * chunk_size;
+    return {{x, -max_height - skirt_drop, z}, {x + chunk_size, max_height, z + chunk_size}};
+}
+
+float value_noise(float x, float z) {
+    float floor_x = std::floor(x), floor_z = std::floor(z);
+    int ix = static_cast<int>(floor_x), iz = static_cast<int>(floor_z);
+    float u = smooth(x - floor_x), v = smooth(z - floor_z);
+    float bottom = lattice(ix, iz) + (lattice(ix + 1, iz) - lattice(ix, iz)) * u;
+    float top = lattice(ix, iz + 1) + (lattice(ix + 1, iz + 1) - lattice(ix, iz + 1)) * u;
+    return bottom + (top - bottom) * v;
+}
+
+float get_height(float x, float z) {
+    float sum = 0, amplitude = 1, amplitude_sum = 0, frequency = 1 / base_wavelength;
+    for (unsigned int i = 0; i < octaves; i++) {
+        sum += value_noise(x * frequency, z * frequency) * amplitude;
+        amplitude_sum += amplitude;
+        amplitude *= persistence;
+        frequency *= 2;
+    }
+    float flatness = (std::clamp)((std::sqrt(x * x + z * z) - flat_radius) / flat_blend, 0.0f,
+                                  1.0f);
+    return sum / amplitude_sum * max_height * smooth(flatness);
+}
+
+math::float3 get_normal(float x, float z) {
+    float dx = get_height(x + normal_step, z) - get_height(x - normal_step, z);
+    float dz = get_height(x, z + normal_step) - get_height(x, z - normal_step);
+    math::float3 normal = {-dx, 2 * normal_step, -dz};
+    float length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+    return {normal.x / length, normal.y / length, normal.z / length};
+}
+
+void build_chunk(const chunk_key_t &key, chunk_mesh_t &mesh) {
+    constexpr unsigned int side = grid_quads + 1;
+    float chunk_size = get_chunk_size(key.level), quad_size = chunk_size / grid_quads;
+    Aabb_tree::box_t square = get_chunk_box(key);
+
+    mesh.positions.clear();
+    mesh.normals.clear();
+    mesh.indices.clear();
+    // the heights are found below
+    mesh.box = square;
+    mesh.box.min.y = max_height;
+    mesh.box.max.y = -max_height;
+    for (unsigned int j = 0; j < side; j++) {
+        for (unsigned int i = 0; i < side; i++) {
+            float x = square.min.x + i * quad_size, z = square.min.z + j * quad_size;
+            float y = get_height(x, z);
+            mesh.positions.push_back({x, y, z});
+            mesh.normals.push_back(get_normal(x, z));
+            mesh.box.min.y = (std::min)(mesh.box.min.y, y);
+            mesh.box.max.y = (std::max)(mesh.box.max.y, y);
+        }
+    }
+    for (unsigned int j = 0; j < grid_quads; j++) {
+        for (unsigned int i = 0; i < grid_quads; i++) {
+            unsigned int corner = j * side + i;
+            for (unsigned int index : {corner, corner + side, corner + 1, corner + 1,
+                                       corner + side, corner + side + 1}) {
+                mesh.indices.push_back(index);
+            }
+        }
+    }
+
+    // every level's vertices are among the finest grid's, so no neighbour's edge, coarser or
+    // finer, dips below the lowest height of the finest grid along this chunk's sides, which
+    // is where the skirt ends
+    float finest_step = get_chunk_size(0) / grid_quads, lowest = mesh.box.min.y;
+    unsigned int finest_steps = static_cast<unsigned int>(std::lround(chunk_size / finest_step));
+    for (unsigned int k = 0; k <= finest_steps; k++) {
+        float along = k * finest_step;
+        lowest = (std::min)({lowest, get_height(square.min.x + along, square.min.z),
+                             get_height(square.min.x + along, square.max.z),
+                             get_height(square.min.x, square.min.z + along),
+                             get_height(square.max.x, square.min.z + along)});
+    }
+    float skirt_y = lowest - skirt_drop;
+    mesh.box.min.y = skirt_y;
+    // around the chunk in the order that turns the skirt's front faces outwards
+    std::vector<unsigned int> edge;
+    for (unsigned int i = 0; i < grid_quads; i++) {
+        edge.push_back(i);
+    }
+    for (unsigned int j = 0; j < grid_quads; j++) {
+        edge.push_back(j * side + grid_quads);
+    }
+    for (unsigned int i = grid_quads; i > 0; i--) {
+        edge.push_back(grid_quads * side + i);
+    }
+    for (unsigned int j = grid_quads; j > 0; j--) {
+        edge.push_back(j * side);
+    }
+    unsigned int first_skirt = static_cast<unsigned int>(mesh.positions.size());
+    for (unsigned int top : edge) {
+        mesh.positions.push_back({mesh.positions[top].x, skirt_y, mesh.positions[top].z});
+        mesh.normals.push_back(mesh.normals[top]);
+    }
+    for (unsigned int k = 0; k < edge.size(); k++) {
+        unsigned int next = (k + 1) % edge.size();
+        unsigned int top = edge[k], next_top = edge[next];
+        unsigned int bottom = first_skirt + k, next_bottom = first_skirt + next;
+        for (unsigned int index : {top, next_top, bottom, next_top, next_bottom, bottom}) {
+            mesh.indices.push_back(index);
+        }
+    }
+}
+
+void select_chunks(const math::float3 &camera, const Aabb_tree::frustum_t &frustum,
+                   float lod_distance, const std::function<bool(const chunk_key_t &)> &is_ready,
+                   std::vector<chunk_key_t> &selected, std::vector<chunk_key_t> &wanted) {
+    selected.clear();
+    wanted.clear();
+    selection_t selection = {camera, frustum, lod_distance, is_ready, selected, {}};
+    selection.select({level_count - 1, 0, 0});
+
+    std::stable_sort(selection.wanted.begin(), selection.wanted.end(),
+                     [](const wanted_t &a, const wanted_t &b) { return a.distance < b.distance; });
+    for (const wanted_t &chunk : selection.wanted) {
+        wanted.push_back(chunk.key);
+    }
+}
+
+} // namespace terrain
@@ -0,0 +1,71 @@
+#pragma once
+#include "Aabb_tree.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// a heightfield made on the CPU from noise, cut into a quadtree of square chunks that all have
+// the same grid of quads, so a chunk one level up covers four times the ground as coarsely
+//
+// chunks near the camera are split into their children, which are only drawn once all four are
+// built, and every chunk hangs a skirt down from its sides that covers the gaps to neighbours of
+// other levels
+namespace terrain {
+
+// the square around the origin the terrain covers
+constexpr float size = 512;
+// level 0 chunks are the finest, level_count - 1 is the single chunk covering everything
+constexpr unsigned int level_count = 6;
+constexpr unsigned int grid_quads = 32;
+constexpr float max_height = 12;
+// the ground stays at y = 0 this far from the origin, where the scene stands, and rises to
+// the full height over flat_blend more
+constexpr float flat_radius = 15;
+constexpr float flat_blend = 20;
+
+struct chunk_key_t {
+    public:
+        unsigned int level;
+        // in chunks of the level from the terrain's lowest x, z corner
+        unsigned int x, z;
+
+        bool operator==(const chunk_key_t &) const = default;
+};
+
+struct chunk_mesh_t {
+    public:
+        std::vector<math::float3> positions;
+        std::vector<math::float3> normals;
+        std::vector<unsigned int> indices;
+        Aabb_tree::box_t box;
+};
+
+// unique for every chunk, to keep them in maps
+std::uint64_t get_id(const chunk_key_t &key);
+
+float get_chunk_size(unsigned int level);
+
+// the chunk's square on the ground
+Aabb_tree::box_t get_chunk_box(const chunk_key_t &key);
+
+// a hash of the integer lattice interpolated smoothly between its points, in [-1, 1], what the
+// heights are summed from and anything else that should vary as gently over the ground
+float value_noise(float x, float z);
+
+// of the heightfield itself, what the finest chunks approach
+float get_height(float x, float z);
+
+math::float3 get_normal(float x, float z);
+
+// the chunk's grid and its skirt, runs on any thread
+void build_chunk(const chunk_key_t &key, chunk_mesh_t &mesh);
+
+// the chunks to draw seen from camera: a chunk is split when the camera is closer to it than
+// lod_distance times its size and its four children are ready, the ones that aren't go into
+// wanted, nearest first, the root has to be ready
+void select_chunks(const math::float3 &camera, const Aabb_tree::frustum_t &frustum,
+                   float lod_distance, const std::function<bool(const chunk_key_t &)> &is_ready,
+                   std::vector<chunk_key_t> &selected, std::vector<chunk_key_t> &wanted);
+
+} // namespace terrain
@@ -0,0 +1,169 @@
+#include "Terrain_benchmark.hpp"
+#include "Terrain.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+constexpr unsigned int camera_count = 100;
+constexpr float camera_height = 5;
+constexpr float lod_distance = 2;
+// chunks a frame takes in while streaming, like Terrain_chunks
+constexpr unsigned int batch_chunks = 16;
+// edge points checked per chunk side
+constexpr unsigned int seam_samples = 64;
+
+double seconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end_point - start_point).count();
+}
+
+// the chunk's surface at a point of its square, between its grid's vertices
+float surface_height(const terrain::chunk_key_t &key, float x, float z) {
+    Aabb_tree::box_t box = terrain::get_chunk_box(key);
+    float quad_size = terrain::get_chunk_size(key.level) / terrain::grid_quads;
+    float u = (x - box.min.x) / quad_size, v = (z - box.min.z) / quad_size;
+    float i = (std::min)(std::floor(u), terrain::grid_quads - 1.0f);
+    float j = (std::min)(std::floor(v), terrain::grid_quads - 1.0f);
+    float fu = u - i, fv = v - j;
+    float x0 = box.min.x + i * quad_size, z0 = box.min.z + j * quad_size;
+    // the triangles split every quad from its i + 1, j corner to its i, j + 1 corner
+    float h00 = terrain::get_height(x0, z0);
+    float h10 = terrain::get_height(x0 + quad_size, z0);
+    float h01 = terrain::get_height(x0, z0 + quad_size);
+    float h11 = terrain::get_height(x0 + quad_size, z0 + quad_size);
+    if (fu + fv <= 1) {
+        return h00 + (h10 - h00) * fu + (h01 - h00) * fv;
+    }
+    return h11 + (h01 - h11) * (1 - fu) + (h10 - h11) * (1 - fv);
+}
+} // namespace
+
+std::string benchmark_terrain(unsigned int chunk_count, Job_system &job_system) {
+    constexpr unsigned int side = 1u << (terrain::level_count - 1);
+    std::vector<terrain::chunk_mesh_t> meshes(chunk_count);
+    auto key_of = [](unsigned int i) {
+        return terrain::chunk_key_t{0, i % side, i / side % side};
+    };
+
+    std::stringstream s;
+    s << "terrain: " << chunk_count << " chunks of " << terrain::grid_quads << "x"
+      << terrain::grid_quads << " quads, " << job_system.get_thread_count() << " threads\n";
+    auto start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < chunk_count; i++) {
+        terrain::build_chunk(key_of(i), meshes[i]);
+    }
+    double serial_time = seconds_since(start_point);
+    start_point = std::chrono::high_resolution_clock::now();
+    job_system.parallel_for(0, chunk_count, 1, [&](unsigned int first, unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            terrain::build_chunk(key_of(i), meshes[i]);
+        }
+    });
+    double parallel_time = seconds_since(start_point);
+    s << "generation: " << chunk_count / serial_time << " chunks/s on one thread, "
+      << chunk_count / parallel_time << " chunks/s on the job system\n";
+
+    // cameras walking from one corner to the other looking along the walk, every chunk ready
+    std::vector<terrain::chunk_key_t> selected, wanted;
+    auto always_ready = [](const terrain::chunk_key_t &) { return true; };
+    auto camera_at = [](unsigned int i) {
+        float t = (i + 0.5f) / camera_count * 0.9f - 0.45f;
+        float x = t * terrain::size, z = t * terrain::size * 0.5f;
+        return math::float3{x, terrain::get_height(x, z) + camera_height, z};
+    };
+    auto frustum_at = [](const math::float3 &camera) {
+        math::matrix view = math::multiply(math::translation(-camera.x, -camera.y, -camera.z),
+                                           math::rotation_y(-1.1f));
+        return Aabb_tree::get_frustum(
+            math::multiply(view, math::perspective_fov_lh(0.8f, 1.5f, 0.1f, 100)));
+    };
+    std::size_t selected_count = 0;
+    start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < camera_count; i++) {
+        math::float3 camera = camera_at(i);
+        terrain::select_chunks(camera, frustum_at(camera), lod_distance, always_ready, selected,
+                               wanted);
+        selected_count += selected.size();
+    }
+    s << "selection: " << seconds_since(start_point) * 1'000'000 / camera_count << " us, "
+      << static_cast<double>(selected_count) / camera_count << " chunks on average\n";
+
+    // streaming in from the root alone, a batch a frame, while the camera walks
+    std::unordered_map<std::uint64_t, bool> ready = {
+        {terrain::get_id({terrain::level_count - 1, 0, 0}), true}};
+    auto is_ready = [&ready](const terrain::chunk_key_t &key) {
+        return ready.contains(terrain::get_id(key));
+    };
+    unsigned int frames = 0, waiting_frames = 0;
+    for (unsigned int i = 0; i < camera_count; i++) {
+        math::float3 camera = camera_at(i);
+        do {
+            terrain::select_chunks(camera, frustum_at(camera), lod_distance, is_ready, selected,
+                                   wanted);
+            for (unsigned int j = 0; j < (std::min)(batch_chunks, unsigned(wanted.size())); j++) {
+                ready[terrain::get_id(wanted[j])] = true;
+            }
+            frames++;
+            waiting_frames += !wanted.empty();
+        } while (!wanted.empty());
+    }
+    s << "streaming: " << ready.size() << " chunks built, " << waiting_frames << " of " << frames
+      << " frames coarser than wanted\n";
+
+    // a seam is covered when neither side's edge drops below the other side's skirt
+    unsigned int seams = 0, gaps = 0;
+    for (unsigned int i = 0; i < camera_count; i += 10) {
+        math::float3 camera = camera_at(i);
+        terrain::select_chunks(camera, frustum_at(camera), lod_distance, always_ready, selected,
+                               wanted);
+        std::vector<Aabb_tree::box_t> boxes;
+        std::vector<float> skirt_bottoms;
+        terrain::chunk_mesh_t mesh;
+        for (const terrain::chunk_key_t &key : selected) {
+            boxes.push_back(terrain::get_chunk_box(key));
+            terrain::build_chunk(key, mesh);
+            skirt_bottoms.push_back(mesh.box.min.y);
+        }
+        for (unsigned int a = 0; a < selected.size(); a++) {
+            for (unsigned int b = 0; b < selected.size(); b++) {
+                if (selected[a].level >= selected[b].level) {
+                    continue;
+                }
+                // a finer chunk and a coarser one sharing a side
+                const Aabb_tree::box_t &fine = boxes[a], &coarse = boxes[b];
+                bool along_x = fine.min.z == coarse.max.z || fine.max.z == coarse.min.z;
+                bool along_z = fine.min.x == coarse.max.x || fine.max.x == coarse.min.x;
+                if (along_x && (fine.min.x < coarse.min.x || fine.max.x > coarse.max.x)) {
+                    continue;
+                }
+                if (along_z && (fine.min.z < coarse.min.z || fine.max.z > coarse.max.z)) {
+                    continue;
+                }
+                if (!along_x && !along_z) {
+                    continue;
+                }
+                seams++;
+                for (unsigned int k = 0; k <= seam_samples; k++) {
+                    float t = static_cast<float>(k) / seam_samples;
+                    float x = along_x ? fine.min.x + (fine.max.x - fine.min.x) * t
+                                      : (fine.min.x == coarse.max.x ? fine.min.x : fine.max.x);
+                    float z = along_z ? fine.min.z + (fine.max.z - fine.min.z) * t
+                                      : (fine.min.z == coarse.max.z ? fine.min.z : fine.max.z);
+                    float fine_height = surface_height(selected[a], x, z);
+                    float coarse_height = surface_height(selected[b], x, z);
+                    if (coarse_height < skirt_bottoms[a] || fine_height < skirt_bottoms[b]) {
+                        gaps++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    s << "seams: " << seams << " between levels, " << gaps << " with a gap below a skirt\n";
+    return s.str();
+}
@@ -0,0 +1,9 @@
+#pragma once
+#include "Job_system.hpp"
+
+#include <string>
+
+// chunk_count finest chunks generated on one thread and on the job system, then the selection
+// from cameras walking across the terrain, how many frames of batches streaming it in takes and
+// whether every seam between the selected chunks is covered by a skirt, one line each
+std::string benchmark_terrain(unsigned int chunk_count, Job_system &job_system);
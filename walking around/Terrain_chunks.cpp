@@ -0,0 +1,227 @@
+#include "Terrain_chunks.hpp"
+#include "Shader_const_buffer.hpp"
+#include "Utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+
+Terrain_chunks::prepared_t Terrain_chunks::prepare(const terrain::chunk_key_t &key) {
+    terrain::chunk_mesh_t mesh;
+    terrain::build_chunk(key, mesh);
+
+    // repeated from every chunk's corner, which is a whole number of spans from the others'
+    float span = get_texture_span();
+    bool repeats = span < terrain::size;
+    float origin_x = repeats ? mesh.box.min.x : -terrain::size / 2;
+    float origin_z = repeats ? mesh.box.min.z : -terrain::size / 2;
+
+    prepared_t prepared = {.vertices = std::vector<vertex_t>(mesh.positions.size()),
+                           .indices = std::move(mesh.indices),
+                           .bounds = {},
+                           .box = mesh.box};
+    for (std::size_t i = 0; i < mesh.positions.size(); i++) {
+        const math::float3 &position = mesh.positions[i], &normal = mesh.normals[i];
+        float u = (position.x - origin_x) / span, v = (position.z - origin_z) / span;
+        prepared.vertices[i] = {
+            .position = {position.x, position.y, position.z},
+            .normal = {normal.x, normal.y, normal.z},
+            .tex_coord = {u * placement.scale[0] + (repeats ? 0 : placement.offset[0]),
+                          v * placement.scale[1] + (repeats ? 0 : placement.offset[1])},
+            .mat_index = mat_id | placement.slice << MAT_INDEX_BITS};
+    }
+    prepared.bounds = compute_bounds(prepared.vertices);
+    return prepared;
+}
+
+std::shared_ptr<Terrain_chunks::chunk_t> Terrain_chunks::create(const prepared_t &prepared) {
+    auto chunk = std::make_shared<chunk_t>();
+    chunk->bounds = prepared.bounds;
+    chunk->box = prepared.box;
+#ifdef PACKED_VERTICES
+    chunk->vertex_buffer.init(m_device, upload_batch,
+                              pack_vertices(prepared.vertices, prepared.bounds));
+#else
+    chunk->vertex_buffer.init(m_device, upload_batch, prepared.vertices);
+#endif
+    chunk->index_buffer.init(m_device, upload_batch, prepared.indices);
+    return chunk;
+}
+
+void Terrain_chunks::start_batch(Job_system &job_system) {
+    batch = std::make_unique<batch_t>();
+    unsigned int count = (std::min)(static_cast<unsigned int>(wanted.size()), MaxBatchChunks);
+    batch->keys.assign(wanted.begin(), wanted.begin() + count);
+    batch->start(
+        job_system, upload_batch,
+        [this](const terrain::chunk_key_t &key) { return prepare(key); },
+        [this](const prepared_t &prepared) { return create(prepared); });
+}
+
+void Terrain_chunks::finish_batch(Job_system &job_system) {
+    batch_t::wait(job_system, batch);
+    for (unsigned int i = 0; i < batch->items.size(); i++) {
+        batch->items[i]->last_used_frame = frame;
+        chunks[terrain::get_id(batch->keys[i])] = std::move(batch->items[i]);
+    }
+    statistics.built += static_cast<unsigned int>(batch->keys.size());
+    built_seconds += batch->seconds;
+    batch.reset();
+}
+
+void Terrain_chunks::evict(Retired_resources &retired_resources,
+                           ComPtr<ID3D12CommandQueue> &command_queue) {
+    if (chunks.size() <= MaxCachedChunks) {
+        return;
+    }
+    // the longest unused first, the recently drawn ones may come back any moment
+    std::vector<std::pair<UINT64, std::uint64_t>> unused;
+    for (const auto &[id, chunk] : chunks) {
+        if (chunk->last_used_frame + KeptFrames < frame) {
+            unused.push_back({chunk->last_used_frame, id});
+        }
+    }
+    std::sort(unused.begin(), unused.end());
+    for (const auto &[last_used_frame, id] : unused) {
+        if (chunks.size() <= MaxCachedChunks) {
+            break;
+        }
+        auto chunk = chunks.find(id);
+        retired_resources.retire(command_queue, std::move(chunk->second));
+        chunks.erase(chunk);
+        statistics.evicted++;
+    }
+}
+
+void Terrain_chunks::build_root() {
+    terrain::chunk_key_t root = {terrain::level_count - 1, 0, 0};
+    chunks[terrain::get_id(root)] = create(prepare(root));
+    upload_batch.flush();
+}
+
+void Terrain_chunks::init(ComPtr<ID3D12Device> &device,
+                          const D3D12_GPU_DESCRIPTOR_HANDLE &_texture_handle,
+                          const texture_packer::placement_t &_placement, unsigned int _mat_id) {
+    m_device = device;
+    texture_handle = _texture_handle;
+    placement = _placement;
+    mat_id = _mat_id;
+    if (mat_id >= WORLD_MATRIX_COUNT) {
+        throw std::runtime_error("the terrain's group has no world matrix");
+    }
+    upload_batch.init(m_device);
+    build_root();
+}
+
+void Terrain_chunks::set_placement(Job_system &job_system,
+                                   const texture_packer::placement_t &_placement,
+                                   Retired_resources &retired_resources,
+                                   ComPtr<ID3D12CommandQueue> &command_queue) {
+    if (_placement == placement) {
+        return;
+    }
+    // the batch's chunks were made for the old placement
+    if (batch) {
+        batch_t::wait(job_system, batch);
+        batch.reset();
+    }
+    for (auto &[id, chunk] : chunks) {
+        retired_resources.retire(command_queue, std::move(chunk));
+    }
+    chunks.clear();
+    placement = _placement;
+    build_root();
+}
+
+void Terrain_chunks::update(Job_system &job_system, const math::float3 &camera,
+                            const math::matrix &view_proj, Retired_resources &retired_resources,
+                            ComPtr<ID3D12CommandQueue> &command_queue) {
+    frame++;
+    if (batch && batch->done()) {
+        finish_batch(job_system);
+    }
+
+    terrain::select_chunks(
+        camera, Aabb_tree::get_frustum(view_proj), LodDistance,
+        [this](const terrain::chunk_key_t &key) { return chunks.contains(terrain::get_id(key)); },
+        selected, wanted);
+    // the ancestors are what the chunks merge back into when the camera moves away
+    for (terrain::chunk_key_t key : selected) {
+        for (; key.level < terrain::level_count; key = {key.level + 1, key.x / 2, key.z / 2}) {
+            chunks.at(terrain::get_id(key))->last_used_frame = frame;
+        }
+    }
+
+    if (!batch && !wanted.empty()) {
+        start_batch(job_system);
+    }
+    evict(retired_resources, command_queue);
+}
+
+Render_queue::draw_t Terrain_chunks::get_draw(chunk_t &chunk,
+                                              ID3D12PipelineState *pipeline_state) {
+    Render_queue::draw_t draw = {.pipeline_state = pipeline_state,
+                                 .texture = texture_handle,
+                                 .vertex_buffer = &chunk.vertex_buffer.get_view(),
+                                 .index_buffer = &chunk.index_buffer.get_view(),
+                                 .root_constants = nullptr,
+                                 .root_constant_count = 0,
+                                 .index_count = chunk.index_buffer.get_index_count(),
+                                 .first_index = 0};
+#ifdef PACKED_VERTICES
+    draw.root_constants = &chunk.bounds;
+    draw.root_constant_count = sizeof(mesh_bounds_t) / 4;
+#endif
+    return draw;
+}
+
+void Terrain_chunks::submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                            const math::matrix &view) {
+    statistics.drawn = 0;
+    for (const terrain::chunk_key_t &key : selected) {
+        if (statistics.drawn == MaxDraws) {
+            break;
+        }
+        chunk_t &chunk = *chunks.at(terrain::get_id(key));
+        render_queue.submit(get_draw(chunk, pipeline_state),
+                            Aabb_tree::get_near_depth(chunk.box, view));
+        statistics.drawn++;
+    }
+}
+
+void Terrain_chunks::submit_casters(Render_queue &render_queue,
+                                    ID3D12PipelineState *pipeline_state,
+                                    const Aabb_tree::frustum_t &casters) {
+    for (unsigned int i = 0; i < selected.size() && i < MaxDraws; i++) {
+        chunk_t &chunk = *chunks.at(terrain::get_id(selected[i]));
+        if (Aabb_tree::intersects(casters, chunk.box)) {
+            render_queue.submit(get_draw(chunk, pipeline_state), 0);
+        }
+    }
+}
+
+float Terrain_chunks::get_texture_span() {
+    bool own_slice = placement.scale[0] == 1 && placement.scale[1] == 1
+                     && placement.offset[0] == 0 && placement.offset[1] == 0;
+    return own_slice ? terrain::get_chunk_size(0) : terrain::size;
+}
+
+Terrain_chunks::statistics_t Terrain_chunks::get_statistics() {
+    statistics.cached = static_cast<unsigned int>(chunks.size());
+    statistics.wanted = static_cast<unsigned int>(wanted.size());
+    statistics.chunks_per_second = built_seconds > 0 ? statistics.built / built_seconds : 0;
+    return statistics;
+}
+
+void Terrain_chunks::release(Job_system &job_system) {
+    if (!batch) {
+        return;
+    }
+    try {
+        batch_t::wait(job_system, batch);
+    } catch (const std::exception &) {
+        // nothing is taken in anymore
+    }
+    batch.reset();
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include "Windows_includes.hpp"
+#include "Index_buffer.hpp"
+#include "Job_system.hpp"
+#include "Render_queue.hpp"
+#include "Retired_resources.hpp"
+#include "Streaming_batch.hpp"
+#include "Terrain.hpp"
+#include "Texture_packer.hpp"
+#include "Upload_batch.hpp"
+#include "Vertex.hpp"
+#include "Vertex_buffer.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// the terrain's chunks on the GPU: the chunks the selection wants are built on the job system a
+// batch at a time and uploaded by the batch's last job, the ones that weren't drawn for a while
+// are retired once there are too many, the root is built by init() and always kept
+class Terrain_chunks {
+    public:
+        // the selection stays well below it, the rest would be dropped
+        constexpr static unsigned int MaxDraws = 256;
+
+        struct statistics_t {
+            public:
+                unsigned int cached = 0;
+                unsigned int drawn = 0;
+                unsigned int wanted = 0;
+                unsigned int built = 0;
+                unsigned int evicted = 0;
+                // over every batch, from its jobs starting to its upload finishing
+                double chunks_per_second = 0;
+        };
+
+    private:
+        constexpr static unsigned int MaxBatchChunks = 16;
+        constexpr static unsigned int MaxCachedChunks = 512;
+        // a chunk is split when the camera is closer than this many of its sizes
+        constexpr static float LodDistance = 2;
+        // chunks drawn this few frames ago are never evicted
+        constexpr static UINT64 KeptFrames = 60;
+
+        struct chunk_t {
+            public:
+                Vertex_buffer vertex_buffer;
+                Index_buffer index_buffer;
+                mesh_bounds_t bounds;
+                Aabb_tree::box_t box;
+                UINT64 last_used_frame = 0;
+        };
+
+        // a chunk's vertices made on a worker, waiting for the upload
+        struct prepared_t {
+            public:
+                std::vector<vertex_t> vertices;
+                std::vector<UINT> indices;
+                mesh_bounds_t bounds;
+                Aabb_tree::box_t box;
+        };
+
+        using batch_t = Streaming_batch<terrain::chunk_key_t, prepared_t, std::shared_ptr<chunk_t>>;
+
+        ComPtr<ID3D12Device> m_device;
+        // only used by one batch at a time
+        Upload_batch upload_batch;
+        D3D12_GPU_DESCRIPTOR_HANDLE texture_handle = {};
+        texture_packer::placement_t placement = {};
+        unsigned int mat_id = 0;
+
+        std::unordered_map<std::uint64_t, std::shared_ptr<chunk_t>> chunks;
+        std::unique_ptr<batch_t> batch;
+        std::vector<terrain::chunk_key_t> selected, wanted;
+        UINT64 frame = 0;
+
+        statistics_t statistics;
+        double built_seconds = 0;
+
+        // any thread
+        prepared_t prepare(const terrain::chunk_key_t &key);
+
+        // on the batch's upload job, or the caller's thread when no batch is running
+        std::shared_ptr<chunk_t> create(const prepared_t &prepared);
+
+        void start_batch(Job_system &job_system);
+
+        void finish_batch(Job_system &job_system);
+
+        void evict(Retired_resources &retired_resources,
+                   ComPtr<ID3D12CommandQueue> &command_queue);
+
+        void build_root();
+
+        Render_queue::draw_t get_draw(chunk_t &chunk, ID3D12PipelineState *pipeline_state);
+
+    public:
+        // the ground's image is repeated across the terrain where its placement has the slice
+        // to itself, an atlas cell can't wrap so there it is stretched once over everything
+        void init(ComPtr<ID3D12Device> &device,
+                  const D3D12_GPU_DESCRIPTOR_HANDLE &_texture_handle,
+                  const texture_packer::placement_t &_placement, unsigned int _mat_id);
+
+        // the uvs are baked into the chunks, a new placement builds them all again
+        void set_placement(Job_system &job_system, const texture_packer::placement_t &_placement,
+                           Retired_resources &retired_resources,
+                           ComPtr<ID3D12CommandQueue> &command_queue);
+
+        // selects the frame's chunks, takes in a finished batch and starts the next, view_proj
+        // is untransposed, once a frame before submit()
+        void update(Job_system &job_system, const math::float3 &camera,
+                    const math::matrix &view_proj, Retired_resources &retired_resources,
+                    ComPtr<ID3D12CommandQueue> &command_queue);
+
+        // view is untransposed
+        void submit(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                    const math::matrix &view);
+
+        // the frame's chunks inside casters, a shadow cascade's frustum, unsorted
+        void submit_casters(Render_queue &render_queue, ID3D12PipelineState *pipeline_state,
+                            const Aabb_tree::frustum_t &casters);
+
+        // how far across the ground's image goes once
+        float get_texture_span();
+
+        statistics_t get_statistics();
+
+        // waits for the batch, before job_system is released
+        void release(Job_system &job_system);
+};
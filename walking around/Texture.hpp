@@ -1,6 +1,7 @@
 #pragma once
 #include "Windows_includes.hpp"
 #include "Utility.hpp"
+#include "Upload_batch.hpp"
 
 
 constexpr UINT BMP_PX_SIZE = 4;
@@ -11,11 +12,25 @@ class Texture {
 
         D3D12_GPU_DESCRIPTOR_HANDLE gpu_handle;
 
+        constexpr static DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
+
+        void create_resource(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                             unsigned int width, unsigned int height, unsigned int slice_count,
+                             const BYTE *data);
 
     public:
-        void init(ComPtr<ID3D12Device> &device, unsigned int width, unsigned int height, BYTE *data,
-                  const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
+        // the texture can be used once upload_batch is flushed
+        void init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch, unsigned int width,
+                  unsigned int height, BYTE *data, const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
                   const D3D12_GPU_DESCRIPTOR_HANDLE &_gpu_handle);
 
+        // data holds the slices one after the other, the view is a Texture2DArray
+        void init_array(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                        unsigned int width, unsigned int height, unsigned int slice_count,
+                        const BYTE *data, const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
+                        const D3D12_GPU_DESCRIPTOR_HANDLE &_gpu_handle);
+
         void use(ComPtr<ID3D12GraphicsCommandList> &command_list, unsigned int arg_num);
+
+        const D3D12_GPU_DESCRIPTOR_HANDLE &get_gpu_handle();
 };
\ No newline at end of file
@@ -2,12 +2,17 @@
 
 void Texture_loader::LoadBitmapFromFile(PCWSTR uri, UINT &width, UINT &height, BYTE **ppBits) {
     ComPtr<IWICBitmapDecoder> decoder = nullptr;
-    ComPtr<IWICBitmapFrameDecode> source = nullptr;
-    ComPtr<IWICFormatConverter> converter = nullptr;
 
     check_output(m_wic_factory->CreateDecoderFromFilename(
         uri, nullptr, GENERIC_READ, WICDecodeMetadataCacheOnLoad, decoder.GetAddressOf()));
 
+    copy_pixels(decoder, width, height, ppBits);
+}
+
+void Texture_loader::copy_pixels(ComPtr<IWICBitmapDecoder> &decoder, UINT &width, UINT &height,
+                                 BYTE **ppBits) {
+    ComPtr<IWICBitmapFrameDecode> source = nullptr;
+    ComPtr<IWICFormatConverter> converter = nullptr;
 
     check_output(decoder->GetFrame(0, source.GetAddressOf()));
 
@@ -33,14 +38,48 @@ void Texture_loader::init() {
                                   reinterpret_cast<LPVOID *>(&m_wic_factory)));
 }
 
-Texture Texture_loader::load_texture(ComPtr<ID3D12Device> &device, PCWSTR uri,
-                                     const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
+Texture Texture_loader::load_texture(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                                     PCWSTR uri, const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
                                      const D3D12_GPU_DESCRIPTOR_HANDLE &gpu_handle) {
     UINT m_bmp_width, m_bmp_height;
     BYTE *m_bmp_bits;
     LoadBitmapFromFile(uri, m_bmp_width, m_bmp_height, &m_bmp_bits);
 
     Texture result;
-    result.init(device, m_bmp_width, m_bmp_height, m_bmp_bits, cpu_handle, gpu_handle);
+    result.init(device, upload_batch, m_bmp_width, m_bmp_height, m_bmp_bits, cpu_handle,
+                gpu_handle);
+    delete[] m_bmp_bits; // already copied to the staging buffer
+    return result;
+}
+
+texture_packer::image_t Texture_loader::load_image(PCWSTR uri) {
+    UINT width, height;
+    BYTE *bits;
+    LoadBitmapFromFile(uri, width, height, &bits);
+
+    texture_packer::image_t result = {.width = width, .height = height, .pixels = {}};
+    result.pixels.assign(bits, bits + std::size_t(BMP_PX_SIZE) * width * height);
+    delete[] bits;
+    return result;
+}
+
+texture_packer::image_t Texture_loader::decode_image(const std::vector<char> &contents) {
+    ComPtr<IWICStream> stream = nullptr;
+    ComPtr<IWICBitmapDecoder> decoder = nullptr;
+
+    check_output(m_wic_factory->CreateStream(stream.GetAddressOf()));
+    check_output(stream->InitializeFromMemory(
+        reinterpret_cast<WICInProcPointer>(const_cast<char *>(contents.data())),
+        static_cast<DWORD>(contents.size())));
+    check_output(m_wic_factory->CreateDecoderFromStream(
+        stream.Get(), nullptr, WICDecodeMetadataCacheOnLoad, decoder.GetAddressOf()));
+
+    UINT width, height;
+    BYTE *bits;
+    copy_pixels(decoder, width, height, &bits);
+
+    texture_packer::image_t result = {.width = width, .height = height, .pixels = {}};
+    result.pixels.assign(bits, bits + std::size_t(BMP_PX_SIZE) * width * height);
+    delete[] bits;
     return result;
 }
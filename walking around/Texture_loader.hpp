@@ -1,6 +1,7 @@
 #pragma once
 #include "Windows_includes.hpp"
 #include "Texture.hpp"
+#include "Texture_packer.hpp"
 
 
 class Texture_loader {
@@ -9,10 +10,19 @@ class Texture_loader {
 
         void LoadBitmapFromFile(PCWSTR uri, UINT &width, UINT &height, BYTE **ppBits);
 
+        void copy_pixels(ComPtr<IWICBitmapDecoder> &decoder, UINT &width, UINT &height,
+                         BYTE **ppBits);
+
     public:
         void init();
 
-        Texture load_texture(ComPtr<ID3D12Device> &device, PCWSTR uri,
+        Texture load_texture(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch, PCWSTR uri,
                              const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle,
                              const D3D12_GPU_DESCRIPTOR_HANDLE &gpu_handle);
+
+        // decoded RGBA8 pixels, for packing before the upload
+        texture_packer::image_t load_image(PCWSTR uri);
+
+        // the same from a file already in memory
+        texture_packer::image_t decode_image(const std::vector<char> &contents);
 };
\ No newline at end of file
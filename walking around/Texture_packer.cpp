@@ -0,0 +1,206 @@
+#include "Texture_packer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+namespace texture_packer {
+
+namespace {
+constexpr unsigned int pixel_size = 4;
+
+// a horizontal piece of the packed area's top edge
+struct skyline_node_t {
+    public:
+        unsigned int x, y, width;
+};
+
+// lowest y a width wide rect can have when its left edge is at node first,
+// false when it runs past the right side
+bool fit(const std::vector<skyline_node_t> &skyline, unsigned int first, unsigned int width,
+         unsigned int area_width, unsigned int &y) {
+    unsigned int x = skyline[first].x;
+    if (x + width > area_width) {
+        return false;
+    }
+    y = 0;
+    unsigned int covered = 0;
+    for (unsigned int i = first; covered < width; i++) {
+        y = (std::max)(y, skyline[i].y);
+        covered += skyline[i].width;
+    }
+    return true;
+}
+
+void place(std::vector<skyline_node_t> &skyline, unsigned int first, const rect_t &rect) {
+    skyline.insert(skyline.begin() + first, {rect.x, rect.y + rect.height, rect.width});
+
+    // the nodes under the new one shrink or go away
+    unsigned int right = rect.x + rect.width;
+    unsigned int i = first + 1;
+    while (i < skyline.size() && skyline[i].x < right) {
+        unsigned int node_right = skyline[i].x + skyline[i].width;
+        if (node_right <= right) {
+            skyline.erase(skyline.begin() + i);
+            continue;
+        }
+        skyline[i].width = node_right - right;
+        skyline[i].x = right;
+        break;
+    }
+
+    for (unsigned int j = 0; j + 1 < skyline.size();) {
+        if (skyline[j].y == skyline[j + 1].y) {
+            skyline[j].width += skyline[j + 1].width;
+            skyline.erase(skyline.begin() + j + 1);
+        } else {
+            j++;
+        }
+    }
+}
+
+unsigned int next_power_of_two(unsigned int value) {
+    unsigned int result = 1;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+// copies the image with its edge pixels repeated padding times around it
+void blit_padded(const image_t &image, unsigned int padding, const rect_t &rect,
+                 unsigned int atlas_width, unsigned char *atlas) {
+    for (unsigned int y = 0; y < rect.height; y++) {
+        unsigned int source_y =
+            (std::min)(static_cast<unsigned int>((std::max)(
+                           static_cast<int>(y) - static_cast<int>(padding), 0)),
+                       image.height - 1);
+        const unsigned char *source_row = &image.pixels[source_y * image.width * pixel_size];
+        unsigned char *destination_row =
+            atlas + ((rect.y + y) * atlas_width + rect.x) * pixel_size;
+
+        for (unsigned int x = 0; x < padding; x++) {
+            std::memcpy(destination_row + x * pixel_size, source_row, pixel_size);
+            std::memcpy(destination_row + (padding + image.width + x) * pixel_size,
+                        source_row + (image.width - 1) * pixel_size, pixel_size);
+        }
+        std::memcpy(destination_row + padding * pixel_size, source_row,
+                    image.width * pixel_size);
+    }
+}
+
+packed_t pack_array(const std::vector<image_t> &images) {
+    packed_t result = {.layout = layout_t::texture_array,
+                       .width = images[0].width,
+                       .height = images[0].height,
+                       .slice_count = static_cast<unsigned int>(images.size()),
+                       .pixels = {},
+                       .placements = {}};
+    std::size_t slice_size = std::size_t(result.width) * result.height * pixel_size;
+    result.pixels.resize(slice_size * images.size());
+    for (unsigned int i = 0; i < images.size(); i++) {
+        std::memcpy(result.pixels.data() + slice_size * i, images[i].pixels.data(), slice_size);
+        result.placements.push_back({.slice = i, .scale = {1, 1}, .offset = {0, 0}});
+    }
+    return result;
+}
+
+packed_t pack_atlas(const std::vector<image_t> &images, unsigned int padding,
+                    unsigned int max_size) {
+    std::vector<std::array<unsigned int, 2>> sizes;
+    double area = 0;
+    for (const image_t &image : images) {
+        sizes.push_back({image.width + 2 * padding, image.height + 2 * padding});
+        area += double(sizes.back()[0]) * sizes.back()[1];
+    }
+
+    // the narrowest power of two width that fits, starting from a square of the same area
+    std::vector<rect_t> rects;
+    unsigned int used_height = 0;
+    unsigned int width = next_power_of_two(static_cast<unsigned int>(std::sqrt(area)));
+    for (const std::array<unsigned int, 2> &size : sizes) {
+        width = (std::max)(width, next_power_of_two(size[0]));
+    }
+    while (!pack_skyline(sizes, width, max_size, rects, used_height)) {
+        width *= 2;
+        if (width > max_size) {
+            throw std::runtime_error("the images don't fit in one atlas");
+        }
+    }
+
+    packed_t result = {.layout = layout_t::atlas,
+                       .width = width,
+                       .height = used_height,
+                       .slice_count = 1,
+                       .pixels = std::vector<unsigned char>(
+                           std::size_t(width) * used_height * pixel_size, 0),
+                       .placements = {}};
+    for (unsigned int i = 0; i < images.size(); i++) {
+        blit_padded(images[i], padding, rects[i], width, result.pixels.data());
+        result.placements.push_back(
+            {.slice = 0,
+             .scale = {float(images[i].width) / width, float(images[i].height) / used_height},
+             .offset = {float(rects[i].x + padding) / width,
+                        float(rects[i].y + padding) / used_height}});
+    }
+    return result;
+}
+} // namespace
+
+bool pack_skyline(const std::vector<std::array<unsigned int, 2>> &sizes, unsigned int width,
+                  unsigned int max_height, std::vector<rect_t> &rects, unsigned int &used_height) {
+    // taller rects first leave a flatter skyline for the rest
+    std::vector<unsigned int> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) {
+        return sizes[a][1] > sizes[b][1];
+    });
+
+    std::vector<skyline_node_t> skyline = {{0, 0, width}};
+    rects.assign(sizes.size(), {});
+    used_height = 0;
+
+    for (unsigned int index : order) {
+        unsigned int rect_width = sizes[index][0], rect_height = sizes[index][1];
+        unsigned int best_node = 0, best_top = 0, best_node_width = 0, best_y = 0;
+        bool found = false;
+
+        for (unsigned int i = 0; i < skyline.size(); i++) {
+            unsigned int y;
+            if (!fit(skyline, i, rect_width, width, y)) {
+                continue;
+            }
+            unsigned int top = y + rect_height;
+            if (!found || top < best_top
+                || (top == best_top && skyline[i].width < best_node_width)) {
+                found = true;
+                best_node = i;
+                best_top = top;
+                best_node_width = skyline[i].width;
+                best_y = y;
+            }
+        }
+        if (!found || best_top > max_height) {
+            return false;
+        }
+
+        rects[index] = {skyline[best_node].x, best_y, rect_width, rect_height};
+        place(skyline, best_node, rects[index]);
+        used_height = (std::max)(used_height, best_top);
+    }
+    return true;
+}
+
+packed_t pack(const std::vector<image_t> &images, unsigned int padding, unsigned int max_size) {
+    if (images.empty()) {
+        throw std::runtime_error("no images to pack");
+    }
+    bool same_size = std::all_of(images.begin(), images.end(), [&](const image_t &image) {
+        return image.width == images[0].width && image.height == images[0].height;
+    });
+    return same_size ? pack_array(images) : pack_atlas(images, padding, max_size);
+}
+
+} // namespace texture_packer
@@ -0,0 +1,53 @@
+#pragma once
+#include <array>
+#include <vector>
+
+// combines many images into one texture array or one padded atlas at load time
+namespace texture_packer {
+
+// RGBA8 pixels, rows without padding
+struct image_t {
+    public:
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<unsigned char> pixels;
+};
+
+// where an image ended up, uv in the slice is uv * scale + offset
+struct placement_t {
+    public:
+        unsigned int slice;
+        std::array<float, 2> scale;
+        std::array<float, 2> offset;
+
+        bool operator==(const placement_t &) const = default;
+};
+
+enum class layout_t { texture_array, atlas };
+
+struct packed_t {
+    public:
+        layout_t layout;
+        unsigned int width;
+        unsigned int height;
+        unsigned int slice_count;
+        std::vector<unsigned char> pixels;    // RGBA8, one slice after the other
+        std::vector<placement_t> placements; // in the order of the images
+};
+
+struct rect_t {
+    public:
+        unsigned int x, y, width, height;
+};
+
+// bottom-left skyline packing into an area width wide, rects are in the order of sizes,
+// false when they don't fit under max_height
+bool pack_skyline(const std::vector<std::array<unsigned int, 2>> &sizes, unsigned int width,
+                  unsigned int max_height, std::vector<rect_t> &rects, unsigned int &used_height);
+
+// images of the same size become array slices, others share one atlas where every image
+// is surrounded by padding pixels repeating its edges, throws when the atlas would be
+// larger than max_size on a side
+packed_t pack(const std::vector<image_t> &images, unsigned int padding, unsigned int max_size);
+
+} // namespace texture_packer
@@ -0,0 +1,54 @@
+#include "Texture_packer_benchmark.hpp"
+#include "Texture_packer.hpp"
+
+#include <chrono>
+#include <random>
+#include <sstream>
+
+namespace {
+constexpr unsigned int padding = 4;
+constexpr unsigned int max_atlas_size = 16384;
+constexpr unsigned int min_image_size = 16, max_image_size = 256;
+constexpr unsigned int array_image_size = 128;
+
+double milliseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end_point - start_point).count()
+           / 1'000'000.0;
+}
+
+texture_packer::image_t make_image(unsigned int width, unsigned int height) {
+    texture_packer::image_t image = {.width = width, .height = height, .pixels = {}};
+    image.pixels.resize(std::size_t(width) * height * 4, static_cast<unsigned char>(width));
+    return image;
+}
+} // namespace
+
+std::string benchmark_texture_packer(unsigned int image_count) {
+    std::mt19937 random(image_count); // the same images every run
+    std::uniform_int_distribution<unsigned int> size(min_image_size, max_image_size);
+
+    std::vector<texture_packer::image_t> atlas_images, array_images;
+    double image_area = 0;
+    for (unsigned int i = 0; i < image_count; i++) {
+        atlas_images.push_back(make_image(size(random), size(random)));
+        image_area += double(atlas_images.back().width) * atlas_images.back().height;
+        array_images.push_back(make_image(array_image_size, array_image_size));
+    }
+
+    auto start_point = std::chrono::high_resolution_clock::now();
+    texture_packer::packed_t atlas = texture_packer::pack(atlas_images, padding, max_atlas_size);
+    double atlas_time = milliseconds_since(start_point);
+
+    start_point = std::chrono::high_resolution_clock::now();
+    texture_packer::packed_t array = texture_packer::pack(array_images, padding, max_atlas_size);
+    double array_time = milliseconds_since(start_point);
+
+    std::stringstream s;
+    s << "atlas of " << image_count << " images: " << atlas.width << "x" << atlas.height << ", "
+      << 100 * image_area / (double(atlas.width) * atlas.height) << "% used, " << atlas_time
+      << " ms\n";
+    s << "array of " << image_count << " images: " << array.slice_count << " slices, "
+      << array_time << " ms\n";
+    return s.str();
+}
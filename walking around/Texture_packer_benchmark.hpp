@@ -0,0 +1,6 @@
+#pragma once
+#include <string>
+
+// packs image_count random sized images into an atlas and as many same sized ones into an
+// array, reports the times and how much of the atlas is used
+std::string benchmark_texture_packer(unsigned int image_count);
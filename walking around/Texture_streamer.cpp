@@ -0,0 +1,391 @@
+#include "Texture_streamer.hpp"
+#include "Utility.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr UINT tile_size = D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+
+// the next mip with a 2x2 box filter, odd edges repeat their last pixel
+std::vector<unsigned char> halve(const std::vector<unsigned char> &pixels, unsigned int &width,
+                                 unsigned int &height) {
+    constexpr unsigned int pixel_size = 4;
+    unsigned int half_width = (std::max)(width / 2, 1u);
+    unsigned int half_height = (std::max)(height / 2, 1u);
+    std::vector<unsigned char> result(std::size_t(half_width) * half_height * pixel_size);
+
+    for (unsigned int y = 0; y < half_height; y++) {
+        unsigned int y0 = (std::min)(2 * y, height - 1), y1 = (std::min)(2 * y + 1, height - 1);
+        for (unsigned int x = 0; x < half_width; x++) {
+            unsigned int x0 = (std::min)(2 * x, width - 1), x1 = (std::min)(2 * x + 1, width - 1);
+            for (unsigned int c = 0; c < pixel_size; c++) {
+                unsigned int sum = pixels[(y0 * width + x0) * pixel_size + c]
+                                   + pixels[(y0 * width + x1) * pixel_size + c]
+                                   + pixels[(y1 * width + x0) * pixel_size + c]
+                                   + pixels[(y1 * width + x1) * pixel_size + c];
+                result[(y * half_width + x) * pixel_size + c] =
+                    static_cast<unsigned char>((sum + 2) / 4);
+            }
+        }
+    }
+    width = half_width;
+    height = half_height;
+    return result;
+}
+} // namespace
+
+void Texture_streamer::Tile_heap::init(ComPtr<ID3D12Device> &device, UINT64 budget) {
+    tile_count = static_cast<UINT>(budget / tile_size);
+
+    D3D12_HEAP_DESC heap_desc = {
+        .SizeInBytes = UINT64(tile_count) * tile_size,
+        .Properties = {.Type = D3D12_HEAP_TYPE_DEFAULT,
+                       .CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
+                       .MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
+                       .CreationNodeMask = 1,
+                       .VisibleNodeMask = 1},
+        .Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+        .Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES};
+    check_output(device->CreateHeap(&heap_desc, IID_PPV_ARGS(&heap)));
+
+    // popped from the back, so the first tiles go first
+    free_tiles.resize(tile_count);
+    for (UINT i = 0; i < tile_count; i++) {
+        free_tiles[i] = tile_count - 1 - i;
+    }
+}
+
+bool Texture_streamer::Tile_heap::allocate(unsigned int texture, unsigned int mip,
+                                           std::uint64_t size) {
+    std::size_t needed = static_cast<std::size_t>(size / tile_size);
+    if (needed > free_tiles.size()) {
+        return false;
+    }
+    std::vector<UINT> &tiles = allocations[{texture, mip}];
+    tiles.assign(free_tiles.end() - needed, free_tiles.end());
+    free_tiles.resize(free_tiles.size() - needed);
+    return true;
+}
+
+void Texture_streamer::Tile_heap::release(unsigned int texture, unsigned int mip) {
+    auto it = allocations.find({texture, mip});
+    free_tiles.insert(free_tiles.end(), it->second.rbegin(), it->second.rend());
+    allocations.erase(it);
+}
+
+std::uint64_t Texture_streamer::Tile_heap::get_usage() const {
+    return std::uint64_t(tile_count - free_tiles.size()) * tile_size;
+}
+
+std::uint64_t Texture_streamer::Tile_heap::get_budget() const {
+    return std::uint64_t(tile_count) * tile_size;
+}
+
+const std::vector<UINT> &Texture_streamer::Tile_heap::get_tiles(unsigned int texture,
+                                                                unsigned int mip) {
+    return allocations.at({texture, mip});
+}
+
+ID3D12Heap *Texture_streamer::Tile_heap::get_heap() {
+    return heap.Get();
+}
+
+UINT Texture_streamer::get_subresource(unsigned int slice, unsigned int mip) {
+    return mip + slice * mip_count;
+}
+
+UINT Texture_streamer::get_tile_count(unsigned int mip) {
+    if (mip >= packed_mip_info.NumStandardMips) {
+        return packed_mip_info.NumTilesForPackedMips;
+    }
+    return tilings[mip].WidthInTiles * tilings[mip].HeightInTiles * tilings[mip].DepthInTiles;
+}
+
+void Texture_streamer::update_mapping(ComPtr<ID3D12CommandQueue> &command_queue,
+                                      unsigned int slice, unsigned int mip, bool map) {
+    // packed mips are mapped all at once from their first subresource
+    unsigned int first_mip = (std::min)(mip, packed_mip_info.NumStandardMips);
+    D3D12_TILED_RESOURCE_COORDINATE coordinate = {
+        .X = 0, .Y = 0, .Z = 0, .Subresource = get_subresource(slice, first_mip)};
+    D3D12_TILE_REGION_SIZE region = {
+        .NumTiles = get_tile_count(mip), .UseBox = FALSE, .Width = 0, .Height = 0, .Depth = 0};
+
+    if (!map) {
+        D3D12_TILE_RANGE_FLAGS null_flag = D3D12_TILE_RANGE_FLAG_NULL;
+        command_queue->UpdateTileMappings(texture_resource.Get(), 1, &coordinate, &region,
+                                          nullptr, 1, &null_flag, nullptr, nullptr,
+                                          D3D12_TILE_MAPPING_FLAG_NONE);
+        return;
+    }
+
+    // the tiles don't have to be next to each other in the heap
+    const std::vector<UINT> &tiles = tile_heap.get_tiles(slice, mip);
+    std::vector<UINT> range_tile_counts(tiles.size(), 1);
+    command_queue->UpdateTileMappings(texture_resource.Get(), 1, &coordinate, &region,
+                                      tile_heap.get_heap(), static_cast<UINT>(tiles.size()),
+                                      nullptr, tiles.data(), range_tile_counts.data(),
+                                      D3D12_TILE_MAPPING_FLAG_NONE);
+}
+
+Texture_streamer::load_t Texture_streamer::create_load(unsigned int slice, unsigned int mip,
+                                                       unsigned int last_mip) {
+    load_t load = {.slice = slice,
+                   .mip = mip,
+                   .last_mip = last_mip,
+                   .staging_buffer = nullptr,
+                   .staging_memory = nullptr,
+                   .footprints = {},
+                   .counter = std::make_unique<Job_counter>()};
+    load.footprints.resize(last_mip - mip + 1);
+
+    D3D12_RESOURCE_DESC texture_desc = texture_resource->GetDesc();
+    UINT64 required_size = 0;
+    m_device->GetCopyableFootprints(&texture_desc, get_subresource(slice, mip),
+                                    static_cast<UINT>(load.footprints.size()), 0,
+                                    load.footprints.data(), nullptr, nullptr, &required_size);
+
+    D3D12_HEAP_PROPERTIES heap_properties = {.Type = D3D12_HEAP_TYPE_UPLOAD,
+                                             .CPUPageProperty =
+                                                 D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
+                                             .MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
+                                             .CreationNodeMask = 1,
+                                             .VisibleNodeMask = 1};
+    D3D12_RESOURCE_DESC resource_desc = {.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+                                         .Alignment = 0,
+                                         .Width = required_size,
+                                         .Height = 1,
+                                         .DepthOrArraySize = 1,
+                                         .MipLevels = 1,
+                                         .Format = DXGI_FORMAT_UNKNOWN,
+                                         .SampleDesc = {.Count = 1, .Quality = 0},
+                                         .Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                         .Flags = D3D12_RESOURCE_FLAG_NONE};
+    check_output(m_device->CreateCommittedResource(
+        &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc,
+        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&load.staging_buffer)));
+
+    D3D12_RANGE read_range = {0, 0};
+    check_output(load.staging_buffer->Map(0, &read_range,
+                                          reinterpret_cast<void **>(&load.staging_memory)));
+    return load;
+}
+
+void Texture_streamer::write_mips(const load_t &load) {
+    std::size_t slice_size = std::size_t(width) * height * pixel_size;
+    auto slice_begin = pixels.begin() + slice_size * load.slice;
+    std::vector<unsigned char> mip_pixels(slice_begin, slice_begin + slice_size);
+    unsigned int mip_width = width, mip_height = height;
+
+    for (unsigned int mip = 0; mip <= load.last_mip; mip++) {
+        if (mip >= load.mip) {
+            const D3D12_PLACED_SUBRESOURCE_FOOTPRINT &footprint =
+                load.footprints[mip - load.mip];
+            for (unsigned int y = 0; y < mip_height; y++) {
+                std::memcpy(load.staging_memory + footprint.Offset
+                                + SIZE_T(footprint.Footprint.RowPitch) * y,
+                            &mip_pixels[std::size_t(y) * mip_width * pixel_size],
+                            std::size_t(mip_width) * pixel_size);
+            }
+        }
+        if (mip < load.last_mip) {
+            mip_pixels = halve(mip_pixels, mip_width, mip_height);
+        }
+    }
+}
+
+void Texture_streamer::record_copy(const load_t &load) {
+    for (unsigned int mip = load.mip; mip <= load.last_mip; mip++) {
+        D3D12_TEXTURE_COPY_LOCATION Dst = {.pResource = texture_resource.Get(),
+                                           .Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX,
+                                           .SubresourceIndex = get_subresource(load.slice, mip)};
+        D3D12_TEXTURE_COPY_LOCATION Src = {.pResource = load.staging_buffer.Get(),
+                                           .Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT,
+                                           .PlacedFootprint = load.footprints[mip - load.mip]};
+        m_commandList->CopyTextureRegion(&Dst, 0, 0, 0, &Src, nullptr);
+    }
+}
+
+void Texture_streamer::transition(unsigned int slice, unsigned int mip,
+                                  D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after) {
+    D3D12_RESOURCE_BARRIER barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {.pResource = texture_resource.Get(),
+                       .Subresource = get_subresource(slice, mip),
+                       .StateBefore = before,
+                       .StateAfter = after},
+    };
+    m_commandList->ResourceBarrier(1, &barrier);
+}
+
+bool Texture_streamer::is_supported(ComPtr<ID3D12Device> &device) {
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options,
+                                           sizeof(options)))) {
+        return false;
+    }
+    return options.TiledResourcesTier >= D3D12_TILED_RESOURCES_TIER_2;
+}
+
+void Texture_streamer::init(ComPtr<ID3D12Device> &device,
+                            ComPtr<ID3D12CommandQueue> &command_queue, unsigned int _width,
+                            unsigned int _height, unsigned int _slice_count,
+                            std::vector<unsigned char> _pixels, UINT64 budget,
+                            const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle) {
+    m_device = device;
+    width = _width;
+    height = _height;
+    slice_count = _slice_count;
+    pixels = std::move(_pixels);
+
+    mip_count = 1;
+    while ((width >> mip_count) > 0 || (height >> mip_count) > 0) {
+        mip_count++;
+    }
+
+    D3D12_RESOURCE_DESC resource_desc = {
+        .Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+        .Alignment = 0,
+        .Width = width,
+        .Height = height,
+        .DepthOrArraySize = static_cast<UINT16>(slice_count),
+        .MipLevels = static_cast<UINT16>(mip_count),
+        .Format = format,
+        .SampleDesc = {.Count = 1, .Quality = 0},
+        .Layout = D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE,
+        .Flags = D3D12_RESOURCE_FLAG_NONE
+    };
+    check_output(device->CreateReservedResource(&resource_desc, D3D12_RESOURCE_STATE_COPY_DEST,
+                                                nullptr, IID_PPV_ARGS(&texture_resource)));
+
+    UINT total_tiles = 0, subresource_count = mip_count;
+    D3D12_TILE_SHAPE tile_shape = {};
+    tilings.resize(mip_count);
+    device->GetResourceTiling(texture_resource.Get(), &total_tiles, &packed_mip_info,
+                              &tile_shape, &subresource_count, 0, tilings.data());
+    tail_mip = packed_mip_info.NumPackedMips > 0 ? packed_mip_info.NumStandardMips
+                                                 : mip_count - 1;
+
+    tile_heap.init(device, budget);
+    Mip_residency::texture_desc_t desc = {.mip_sizes = {}, .tail_mip = tail_mip};
+    for (unsigned int mip = 0; mip <= tail_mip; mip++) {
+        desc.mip_sizes.push_back(std::uint64_t(get_tile_count(mip)) * tile_size);
+    }
+    residency.init(tile_heap, std::vector<Mip_residency::texture_desc_t>(slice_count, desc),
+                   MaxLoadsInFlight);
+
+    check_output(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                                IID_PPV_ARGS(&m_commandAllocator)));
+    check_output(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                           m_commandAllocator.Get(), nullptr,
+                                           IID_PPV_ARGS(&m_commandList)));
+    gpu_waiter.init(device);
+
+    // every slice can be sampled from the start, at its tail
+    std::vector<load_t> tails;
+    for (unsigned int slice = 0; slice < slice_count; slice++) {
+        update_mapping(command_queue, slice, tail_mip, true);
+        tails.push_back(create_load(slice, tail_mip, mip_count - 1));
+        write_mips(tails.back());
+        record_copy(tails.back());
+    }
+    D3D12_RESOURCE_BARRIER barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {.pResource = texture_resource.Get(),
+                       .Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+                       .StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
+                       .StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE},
+    };
+    m_commandList->ResourceBarrier(1, &barrier);
+    check_output(m_commandList->Close());
+
+    ID3D12CommandList *command_list = m_commandList.Get();
+    command_queue->ExecuteCommandLists(1, &command_list);
+    gpu_waiter.wait(command_queue);
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srv_desc = {
+        .Format = format,
+        .ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY,
+        .Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+        .Texture2DArray = {.MostDetailedMip = 0,
+                           .MipLevels = mip_count,
+                           .FirstArraySlice = 0,
+                           .ArraySize = slice_count,
+                           .PlaneSlice = 0,
+                           .ResourceMinLODClamp = 0.0f},
+    };
+    device->CreateShaderResourceView(texture_resource.Get(), &srv_desc, cpu_handle);
+}
+
+void Texture_streamer::want(unsigned int slice, float lod, float priority) {
+    residency.want(slice, lod, priority);
+}
+
+void Texture_streamer::update(Job_system &job_system,
+                              ComPtr<ID3D12CommandQueue> &command_queue) {
+    // finished loads are copied before this frame draws, so their mips can be sampled
+    std::vector<load_t> copied;
+    for (auto it = loads.begin(); it != loads.end();) {
+        if (!it->counter->done()) {
+            ++it;
+            continue;
+        }
+        job_system.wait(*it->counter);
+
+        if (copied.empty()) {
+            check_output(m_commandAllocator->Reset());
+            check_output(m_commandList->Reset(m_commandAllocator.Get(), nullptr));
+        }
+        update_mapping(command_queue, it->slice, it->mip, true);
+        transition(it->slice, it->mip, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                   D3D12_RESOURCE_STATE_COPY_DEST);
+        record_copy(*it);
+        transition(it->slice, it->mip, D3D12_RESOURCE_STATE_COPY_DEST,
+                   D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+        residency.finish_load(it->slice);
+
+        copied.push_back(std::move(*it));
+        it = loads.erase(it);
+    }
+    if (!copied.empty()) {
+        check_output(m_commandList->Close());
+        ID3D12CommandList *command_list = m_commandList.Get();
+        command_queue->ExecuteCommandLists(1, &command_list);
+        // the staging buffers go away with copied
+        gpu_waiter.wait(command_queue);
+    }
+
+    Mip_residency::changes_t changes = residency.update();
+    // get_min_lod() already excludes them, so this frame doesn't sample them
+    for (const Mip_residency::mip_t &eviction : changes.evictions) {
+        update_mapping(command_queue, eviction.texture, eviction.mip, false);
+    }
+    for (const Mip_residency::mip_t &request : changes.loads) {
+        loads.push_back(create_load(request.texture, request.mip, request.mip));
+        load_t &load = loads.back();
+        job_system.run([this, &load] { write_mips(load); }, *load.counter);
+    }
+}
+
+float Texture_streamer::get_min_lod(unsigned int slice) {
+    return static_cast<float>(residency.get_resident_mip(slice));
+}
+
+unsigned int Texture_streamer::get_slice_count() {
+    return slice_count;
+}
+
+Texture_streamer::statistics_t Texture_streamer::get_statistics() {
+    return {.usage = tile_heap.get_usage(),
+            .budget = tile_heap.get_budget(),
+            .residency = residency.get_statistics()};
+}
+
+void Texture_streamer::release(Job_system &job_system) {
+    for (load_t &load : loads) {
+        job_system.wait(*load.counter);
+    }
+    loads.clear();
+}
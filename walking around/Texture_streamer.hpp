@@ -0,0 +1,129 @@
+#pragma once
+#include "Windows_includes.hpp"
+#include "GPU_waiter.hpp"
+#include "Job_system.hpp"
+#include "Mip_residency.hpp"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+// a texture array in a reserved resource, the mip tails are loaded by init() and the finer
+// mips on the job system as Mip_residency asks for them, all backed by tiles of one heap
+// the size of the budget
+class Texture_streamer {
+    public:
+        struct statistics_t {
+            public:
+                UINT64 usage;
+                UINT64 budget;
+                Mip_residency::statistics_t residency;
+        };
+
+    private:
+        constexpr static DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        constexpr static unsigned int pixel_size = 4;
+        constexpr static unsigned int MaxLoadsInFlight = 4;
+
+        // hands out the heap's tiles, textures are slices here
+        class Tile_heap : public Gpu_memory {
+            private:
+                ComPtr<ID3D12Heap> heap;
+                UINT tile_count = 0;
+                std::vector<UINT> free_tiles;
+                std::map<std::pair<unsigned int, unsigned int>, std::vector<UINT>> allocations;
+
+            public:
+                void init(ComPtr<ID3D12Device> &device, UINT64 budget);
+
+                bool allocate(unsigned int texture, unsigned int mip, std::uint64_t size) override;
+
+                void release(unsigned int texture, unsigned int mip) override;
+
+                std::uint64_t get_usage() const override;
+
+                std::uint64_t get_budget() const override;
+
+                const std::vector<UINT> &get_tiles(unsigned int texture, unsigned int mip);
+
+                ID3D12Heap *get_heap();
+        };
+
+        // mips [mip, last_mip] of one slice on their way through a staging buffer
+        struct load_t {
+            public:
+                unsigned int slice;
+                unsigned int mip;
+                unsigned int last_mip;
+                ComPtr<ID3D12Resource> staging_buffer;
+                BYTE *staging_memory;
+                std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints;
+                std::unique_ptr<Job_counter> counter;
+        };
+
+        ComPtr<ID3D12Device> m_device;
+        ComPtr<ID3D12Resource> texture_resource;
+        ComPtr<ID3D12CommandAllocator> m_commandAllocator;
+        ComPtr<ID3D12GraphicsCommandList> m_commandList;
+        GPU_waiter gpu_waiter;
+
+        unsigned int width = 0, height = 0, slice_count = 0, mip_count = 0;
+        D3D12_PACKED_MIP_INFO packed_mip_info = {};
+        // of the first slice, the others are the same
+        std::vector<D3D12_SUBRESOURCE_TILING> tilings;
+        // the first mip that is always resident, the packed mips when there are any
+        unsigned int tail_mip = 0;
+
+        // mip 0 of every slice, the loads read it like they would a file
+        std::vector<unsigned char> pixels;
+
+        Tile_heap tile_heap;
+        Mip_residency residency;
+        std::list<load_t> loads;
+
+        UINT get_subresource(unsigned int slice, unsigned int mip);
+
+        UINT get_tile_count(unsigned int mip);
+
+        // maps the mip's tiles from tile_heap, or unmaps them, the tail maps the packed mips
+        void update_mapping(ComPtr<ID3D12CommandQueue> &command_queue, unsigned int slice,
+                            unsigned int mip, bool map);
+
+        load_t create_load(unsigned int slice, unsigned int mip, unsigned int last_mip);
+
+        // downsamples the slice into the staging buffer, runs on any thread
+        void write_mips(const load_t &load);
+
+        void record_copy(const load_t &load);
+
+        void transition(unsigned int slice, unsigned int mip, D3D12_RESOURCE_STATES before,
+                        D3D12_RESOURCE_STATES after);
+
+    public:
+        // false without tiled resources tier 2, which packed mips of arrays need
+        static bool is_supported(ComPtr<ID3D12Device> &device);
+
+        // _pixels holds slice_count RGBA8 slices one after the other, waits for the tails
+        void init(ComPtr<ID3D12Device> &device, ComPtr<ID3D12CommandQueue> &command_queue,
+                  unsigned int _width, unsigned int _height, unsigned int _slice_count,
+                  std::vector<unsigned char> _pixels, UINT64 budget,
+                  const D3D12_CPU_DESCRIPTOR_HANDLE &cpu_handle);
+
+        // lod is log2 of texels per screen pixel, priority is the size on screen
+        void want(unsigned int slice, float lod, float priority);
+
+        // finished loads become resident and new ones start, call it after the frame's
+        // want() calls and before drawing, while the GPU isn't using the texture
+        void update(Job_system &job_system, ComPtr<ID3D12CommandQueue> &command_queue);
+
+        // the finest mip the slice may be sampled at
+        float get_min_lod(unsigned int slice);
+
+        unsigned int get_slice_count();
+
+        statistics_t get_statistics();
+
+        // waits for the loads, before job_system is released
+        void release(Job_system &job_system);
+};
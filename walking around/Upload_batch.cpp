@@ -0,0 +1,127 @@
+#include "Upload_batch.hpp"
+#include "Utility.hpp"
+
+ComPtr<ID3D12Resource> Upload_batch::create_staging_buffer(UINT64 size) {
+    D3D12_HEAP_PROPERTIES upload_heap_prop = {.Type = D3D12_HEAP_TYPE_UPLOAD,
+                                              .CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
+                                              .MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
+                                              .CreationNodeMask = 1,
+                                              .VisibleNodeMask = 1};
+    D3D12_RESOURCE_DESC upload_resource_desc = {
+        .Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+        .Alignment = 0,
+        .Width = size,
+        .Height = 1,
+        .DepthOrArraySize = 1,
+        .MipLevels = 1,
+        .Format = DXGI_FORMAT_UNKNOWN,
+        .SampleDesc = {.Count = 1, .Quality = 0},
+        .Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+        .Flags = D3D12_RESOURCE_FLAG_NONE
+    };
+
+    ComPtr<ID3D12Resource> staging_buffer;
+    check_output(m_device->CreateCommittedResource(
+        &upload_heap_prop, D3D12_HEAP_FLAG_NONE, &upload_resource_desc,
+        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&staging_buffer)));
+    staging_buffers.push_back(staging_buffer);
+    return staging_buffer;
+}
+
+void Upload_batch::transition(ID3D12Resource *resource, D3D12_RESOURCE_STATES state_after) {
+    D3D12_RESOURCE_BARRIER barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {.pResource = resource,
+                       .Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+                       .StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
+                       .StateAfter = state_after},
+    };
+    m_commandList->ResourceBarrier(1, &barrier);
+}
+
+void Upload_batch::init(ComPtr<ID3D12Device> &device) {
+    m_device = device;
+
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+    check_output(m_device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&m_commandQueue)));
+
+    check_output(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                                  IID_PPV_ARGS(&m_commandAllocator)));
+    check_output(m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                             m_commandAllocator.Get(), nullptr,
+                                             IID_PPV_ARGS(&m_commandList)));
+
+    gpu_waiter.init(m_device);
+}
+
+void Upload_batch::upload_buffer(ID3D12Resource *destination, const void *data, UINT64 size,
+                                 D3D12_RESOURCE_STATES state_after) {
+    ComPtr<ID3D12Resource> staging_buffer = create_staging_buffer(size);
+
+    void *staging_memory;
+    D3D12_RANGE zero_range = {.Begin = 0, .End = 0};
+    check_output(staging_buffer->Map(0, &zero_range, &staging_memory));
+    std::memcpy(staging_memory, data, size);
+    staging_buffer->Unmap(0, nullptr);
+
+    m_commandList->CopyBufferRegion(destination, 0, staging_buffer.Get(), 0, size);
+    transition(destination, state_after);
+}
+
+void Upload_batch::upload_texture(ID3D12Resource *destination, const BYTE *data, UINT row_pitch,
+                                  D3D12_RESOURCE_STATES state_after) {
+    // one subresource per array slice, all of them in one staging buffer
+    D3D12_RESOURCE_DESC resource_desc = destination->GetDesc();
+    UINT subresource_count = resource_desc.DepthOrArraySize;
+    std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts(subresource_count);
+    std::vector<UINT> num_rows(subresource_count);
+    std::vector<UINT64> row_sizes_in_bytes(subresource_count);
+    UINT64 required_size = 0;
+    m_device->GetCopyableFootprints(&resource_desc, 0, subresource_count, 0, layouts.data(),
+                                    num_rows.data(), row_sizes_in_bytes.data(), &required_size);
+
+    ComPtr<ID3D12Resource> staging_buffer = create_staging_buffer(required_size);
+
+    // copying texture data to buffer
+    UINT8 *map_tex_data = nullptr;
+    check_output(staging_buffer->Map(0, nullptr, reinterpret_cast<void **>(&map_tex_data)));
+    const BYTE *source = data;
+    for (UINT i = 0; i < subresource_count; i++) {
+        const D3D12_PLACED_SUBRESOURCE_FOOTPRINT &layout = layouts[i];
+        for (UINT y = 0; y < num_rows[i]; ++y) {
+            memcpy(map_tex_data + layout.Offset + SIZE_T(layout.Footprint.RowPitch) * y,
+                   source + SIZE_T(row_pitch) * y, static_cast<SIZE_T>(row_sizes_in_bytes[i]));
+        }
+        source += SIZE_T(row_pitch) * num_rows[i];
+    }
+    staging_buffer->Unmap(0, nullptr);
+
+    // copying from staging buffer to texture
+    for (UINT i = 0; i < subresource_count; i++) {
+        D3D12_TEXTURE_COPY_LOCATION Dst = {.pResource = destination,
+                                           .Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX,
+                                           .SubresourceIndex = i};
+        D3D12_TEXTURE_COPY_LOCATION Src = {.pResource = staging_buffer.Get(),
+                                           .Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT,
+                                           .PlacedFootprint = layouts[i]};
+        m_commandList->CopyTextureRegion(&Dst, 0, 0, 0, &Src, nullptr);
+    }
+    transition(destination, state_after);
+}
+
+void Upload_batch::flush() {
+    check_output(m_commandList->Close());
+
+    ID3D12CommandList *cmd_list = m_commandList.Get();
+    m_commandQueue->ExecuteCommandLists(1, &cmd_list);
+    gpu_waiter.wait(m_commandQueue);
+
+    staging_buffers.clear();
+
+    check_output(m_commandAllocator->Reset());
+    check_output(m_commandList->Reset(m_commandAllocator.Get(), nullptr));
+}
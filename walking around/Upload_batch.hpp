@@ -0,0 +1,39 @@
+#pragma once
+#include "Windows_includes.hpp"
+#include "GPU_waiter.hpp"
+
+#include <vector>
+
+// records copies from upload heap staging buffers into default heap resources,
+// all of them are submitted together by flush()
+class Upload_batch {
+    private:
+        ComPtr<ID3D12Device> m_device;
+        ComPtr<ID3D12CommandQueue> m_commandQueue;
+        ComPtr<ID3D12CommandAllocator> m_commandAllocator;
+        ComPtr<ID3D12GraphicsCommandList> m_commandList;
+
+        GPU_waiter gpu_waiter;
+
+        // staging buffers have to live until the copies are done
+        std::vector<ComPtr<ID3D12Resource>> staging_buffers;
+
+        ComPtr<ID3D12Resource> create_staging_buffer(UINT64 size);
+
+        void transition(ID3D12Resource *resource, D3D12_RESOURCE_STATES state_after);
+
+    public:
+        void init(ComPtr<ID3D12Device> &device);
+
+        // destination must be in D3D12_RESOURCE_STATE_COPY_DEST
+        void upload_buffer(ID3D12Resource *destination, const void *data, UINT64 size,
+                           D3D12_RESOURCE_STATES state_after);
+
+        // destination must be in D3D12_RESOURCE_STATE_COPY_DEST, data holds every array slice
+        // one after the other
+        void upload_texture(ID3D12Resource *destination, const BYTE *data, UINT row_pitch,
+                            D3D12_RESOURCE_STATES state_after);
+
+        // executes all recorded copies and waits for them to finish
+        void flush();
+};
@@ -0,0 +1,119 @@
+#include "Vertex.hpp"
+
+using namespace DirectX;
+using namespace DirectX::PackedVector;
+
+namespace {
+constexpr float min_extent = 1e-6f; // flat meshes like the ground have zero height
+
+XMVECTOR load_position(const vertex_t &vertex) {
+    return XMLoadFloat3(reinterpret_cast<const XMFLOAT3 *>(vertex.position));
+}
+
+// maps the unit sphere onto the [-1, 1] square, lower hemisphere folded onto the corners
+XMVECTOR octahedral_encode(FXMVECTOR normal) {
+    XMVECTOR zero = XMVectorZero();
+    XMVECTOR projected =
+        XMVectorDivide(normal, XMVector3Dot(XMVectorAbs(normal), XMVectorSplatOne()));
+    XMVECTOR sign = XMVectorSelect(XMVectorNegate(XMVectorSplatOne()), XMVectorSplatOne(),
+                                   XMVectorGreaterOrEqual(projected, zero));
+    XMVECTOR folded = XMVectorMultiply(
+        XMVectorSubtract(XMVectorSplatOne(),
+                         XMVectorAbs(XMVectorSwizzle<1, 0, 2, 3>(projected))),
+        sign);
+    return XMVectorSelect(projected, folded, XMVectorLess(XMVectorSplatZ(projected), zero));
+}
+
+XMVECTOR octahedral_decode(FXMVECTOR encoded) {
+    XMVECTOR abs_encoded = XMVectorAbs(encoded);
+    XMVECTOR z = XMVectorSubtract(
+        XMVectorSubtract(XMVectorSplatOne(), XMVectorSplatX(abs_encoded)),
+        XMVectorSplatY(abs_encoded));
+    XMVECTOR t = XMVectorSaturate(XMVectorNegate(z));
+    XMVECTOR unfolded = XMVectorSelect(t, XMVectorNegate(t),
+                                       XMVectorGreaterOrEqual(encoded, XMVectorZero()));
+    XMVECTOR normal = XMVectorSelect(XMVectorAdd(encoded, unfolded), z,
+                                     XMVectorSelectControl(0, 0, 1, 1));
+    return XMVector3Normalize(normal);
+}
+} // namespace
+
+mesh_bounds_t compute_bounds(const std::vector<vertex_t> &vertices) {
+    mesh_bounds_t bounds = {};
+    if (vertices.empty()) {
+        return bounds;
+    }
+    XMVECTOR min = load_position(vertices[0]);
+    XMVECTOR max = min;
+    for (const vertex_t &vertex : vertices) {
+        XMVECTOR position = load_position(vertex);
+        min = XMVectorMin(min, position);
+        max = XMVectorMax(max, position);
+    }
+    XMVECTOR extent = XMVectorMax(XMVectorSubtract(max, min), XMVectorReplicate(min_extent));
+    XMStoreFloat4(&bounds.min, min);
+    XMStoreFloat4(&bounds.extent, extent);
+    return bounds;
+}
+
+std::vector<packed_vertex_t> pack_vertices(const std::vector<vertex_t> &vertices,
+                                           const mesh_bounds_t &bounds) {
+    XMVECTOR min = XMLoadFloat4(&bounds.min);
+    XMVECTOR scale = XMVectorDivide(XMVectorReplicate(65535.0f), XMLoadFloat4(&bounds.extent));
+
+    std::vector<packed_vertex_t> packed_vertices(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        const vertex_t &vertex = vertices[i];
+        packed_vertex_t &packed = packed_vertices[i];
+
+        XMVECTOR quantized =
+            XMVectorRound(XMVectorMultiply(XMVectorSubtract(load_position(vertex), min), scale));
+        quantized = XMVectorSetW(quantized, static_cast<float>(vertex.mat_index));
+        XMUSHORT4 position;
+        XMStoreUShort4(&position, quantized);
+        packed.position[0] = position.x;
+        packed.position[1] = position.y;
+        packed.position[2] = position.z;
+        packed.mat_index = position.w;
+
+        XMSHORTN2 normal;
+        XMStoreShortN2(&normal, octahedral_encode(XMLoadFloat3(
+                                    reinterpret_cast<const XMFLOAT3 *>(vertex.normal))));
+        packed.normal[0] = normal.x;
+        packed.normal[1] = normal.y;
+
+        XMHALF2 tex_coord;
+        XMStoreHalf2(&tex_coord,
+                     XMLoadFloat2(reinterpret_cast<const XMFLOAT2 *>(vertex.tex_coord)));
+        packed.tex_coord[0] = tex_coord.x;
+        packed.tex_coord[1] = tex_coord.y;
+    }
+    return packed_vertices;
+}
+
+std::vector<vertex_t> unpack_vertices(const std::vector<packed_vertex_t> &packed_vertices,
+                                      const mesh_bounds_t &bounds) {
+    XMVECTOR min = XMLoadFloat4(&bounds.min);
+    XMVECTOR scale = XMVectorDivide(XMLoadFloat4(&bounds.extent), XMVectorReplicate(65535.0f));
+
+    std::vector<vertex_t> vertices(packed_vertices.size());
+    for (size_t i = 0; i < packed_vertices.size(); i++) {
+        const packed_vertex_t &packed = packed_vertices[i];
+        vertex_t &vertex = vertices[i];
+
+        XMUSHORT4 position(packed.position[0], packed.position[1], packed.position[2],
+                           packed.mat_index);
+        XMVECTOR quantized = XMLoadUShort4(&position);
+        XMStoreFloat3(reinterpret_cast<XMFLOAT3 *>(vertex.position),
+                      XMVectorMultiplyAdd(quantized, scale, min));
+        vertex.mat_index = packed.mat_index;
+
+        XMSHORTN2 normal(packed.normal[0], packed.normal[1]);
+        XMStoreFloat3(reinterpret_cast<XMFLOAT3 *>(vertex.normal),
+                      octahedral_decode(XMLoadShortN2(&normal)));
+
+        XMHALF2 tex_coord(packed.tex_coord[0], packed.tex_coord[1]);
+        XMStoreFloat2(reinterpret_cast<XMFLOAT2 *>(vertex.tex_coord), XMLoadHalf2(&tex_coord));
+    }
+    return vertices;
+}
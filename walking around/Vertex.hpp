@@ -0,0 +1,42 @@
+#pragma once
+#include "Windows_includes.hpp"
+#include "Vertex_format.h"
+
+#include <DirectXPackedVector.h>
+#include <vector>
+
+// vertex as read from .wobj
+struct vertex_t {
+    public:
+        FLOAT position[3];
+        FLOAT normal[3];
+        FLOAT tex_coord[2];
+        UINT mat_index;
+};
+
+// 16 byte vertex: position normalized against the mesh bounds,
+// octahedral normal, half float uv and 16-bit mat_index in the position's w
+struct packed_vertex_t {
+    public:
+        UINT16 position[3];
+        UINT16 mat_index;
+        INT16 normal[2];
+        DirectX::PackedVector::HALF tex_coord[2];
+};
+
+static_assert(sizeof(packed_vertex_t) == 16);
+
+// laid out as the root constants read by VertexShader.hlsl
+struct mesh_bounds_t {
+    public:
+        DirectX::XMFLOAT4 min;
+        DirectX::XMFLOAT4 extent;
+};
+
+mesh_bounds_t compute_bounds(const std::vector<vertex_t> &vertices);
+
+std::vector<packed_vertex_t> pack_vertices(const std::vector<vertex_t> &vertices,
+                                           const mesh_bounds_t &bounds);
+
+std::vector<vertex_t> unpack_vertices(const std::vector<packed_vertex_t> &packed_vertices,
+                                      const mesh_bounds_t &bounds);
@@ -1,3 +1,5 @@
+#include "Vertex_format.h"
+
 cbuffer vs_const_buffer_t
 {
     float4x4 matWorld[10];
@@ -13,20 +15,70 @@ struct vs_output_t
     float4 viewer : VIEWER;
     float2 tex : TEXCOORD;
     float3 norm : NORMAL_PS;
+    nointerpolation uint slice : SLICE;
+    float3 world : WORLD;
+};
+
+// a draw's instance, a math::affine's rows from the second vertex buffer, placed before matWorld
+struct instance_t
+{
+    float3 row0 : INSTANCE0;
+    float3 row1 : INSTANCE1;
+    float3 row2 : INSTANCE2;
+    float3 row3 : INSTANCE3;
+};
+
+float4x3 get_transform(instance_t instance)
+{
+    return float4x3(instance.row0, instance.row1, instance.row2, instance.row3);
+}
+
+#ifdef PACKED_VERTICES
+cbuffer mesh_bounds_t : register(b1)
+{
+    float4 bounds_min;
+    float4 bounds_extent;
 };
 
+float3 octahedral_decode(float2 encoded)
+{
+    float3 normal = float3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+    float t = saturate(-normal.z);
+    normal.xy += (normal.xy >= 0.0f) ? -t : t;
+    return normalize(normal);
+}
+
+vs_output_t main(
+        uint4 packed_pos : POSITION,
+        float2 packed_norm : NORMAL,
+        float2 tex : TEXCOORD,
+        instance_t instance)
+{
+    float3 pos = bounds_min.xyz + packed_pos.xyz * (bounds_extent.xyz / 65535.0f);
+    float3 norm = octahedral_decode(packed_norm);
+    uint packed_index = packed_pos.w;
+#else
 vs_output_t main(
  		float3 pos : POSITION,
  		float3 norm : NORMAL,
         float2 tex : TEXCOORD,
-        uint mat_index : MAT_INDEX)
+        uint packed_index : MAT_INDEX,
+        instance_t instance)
 {
+#endif
+    uint mat_index = packed_index & ((1 << MAT_INDEX_BITS) - 1);
     vs_output_t result;
-    float4 normal_vec = mul(mul(float4(norm, 0.0f), matWorld[mat_index]), matView);
-    result.viewer = -mul(mul(float4(pos, 1.0f), matWorld[mat_index]), matView);
-    result.position = mul(mul(mul(float4(pos, 1.0f), matWorld[mat_index]), matView), matProj);
+    float4x3 placement = get_transform(instance);
+    float3 placed_norm = mul(float4(norm, 0.0f), placement);
+    float3 placed_pos = mul(float4(pos, 1.0f), placement);
+    float4 normal_vec = mul(mul(float4(placed_norm, 0.0f), matWorld[mat_index]), matView);
+    float4 world = mul(float4(placed_pos, 1.0f), matWorld[mat_index]);
+    result.viewer = -mul(world, matView);
+    result.position = mul(mul(world, matView), matProj);
+    result.world = world.xyz;
     result.tex = tex;
     result.norm = normalize(normal_vec);
+    result.slice = packed_index >> MAT_INDEX_BITS;
 
     return result;
 }
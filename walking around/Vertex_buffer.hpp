@@ -2,6 +2,7 @@
 #include "Windows_includes.hpp"
 
 #include "Utility.hpp"
+#include "Upload_batch.hpp"
 #include <vector>
 
 class Vertex_buffer {
@@ -10,14 +11,10 @@ class Vertex_buffer {
         D3D12_VERTEX_BUFFER_VIEW m_vertexBufferView;
         unsigned int m_vertex_count = 0;
 
-    public:
-        template <typename VERTEX_TYPE>
-        void init(ComPtr<ID3D12Device> &device, const std::vector<VERTEX_TYPE> &vertex_data) {
-            m_vertex_count = vertex_data.size();
-            unsigned int data_size = sizeof(VERTEX_TYPE) * m_vertex_count;
-            // inits m_vertexBuffer and m_vertexBufferView
+        void create_resource(ComPtr<ID3D12Device> &device, D3D12_HEAP_TYPE heap_type,
+                             unsigned int data_size, D3D12_RESOURCE_STATES initial_state) {
             D3D12_HEAP_PROPERTIES heapProps = {
-                .Type = D3D12_HEAP_TYPE_UPLOAD,
+                .Type = heap_type,
                 .CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
                 .MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
                 .CreationNodeMask = 1,
@@ -38,25 +35,67 @@ class Vertex_buffer {
             };
 
             check_output(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc,
-                                                         D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
+                                                         initial_state, nullptr,
                                                          IID_PPV_ARGS(&m_vertexBuffer)));
+        }
+
+        void init_view(unsigned int stride, unsigned int data_size) {
+            m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
+            m_vertexBufferView.StrideInBytes = stride;
+            m_vertexBufferView.SizeInBytes = data_size;
+        }
+
+    public:
+        // static mesh, copied once into a default heap resource,
+        // can be drawn after upload_batch is flushed
+        template <typename VERTEX_TYPE>
+        void init(ComPtr<ID3D12Device> &device, Upload_batch &upload_batch,
+                  const std::vector<VERTEX_TYPE> &vertex_data) {
+            m_vertex_count = vertex_data.size();
+            unsigned int data_size = sizeof(VERTEX_TYPE) * m_vertex_count;
 
+            create_resource(device, D3D12_HEAP_TYPE_DEFAULT, data_size,
+                            D3D12_RESOURCE_STATE_COPY_DEST);
+            upload_batch.upload_buffer(m_vertexBuffer.Get(), vertex_data.data(), data_size,
+                                       D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+
+            init_view(sizeof(VERTEX_TYPE), data_size);
+        }
+
+        // dynamic mesh, stays in the upload heap so it can be rewritten with update()
+        template <typename VERTEX_TYPE>
+        void init_dynamic(ComPtr<ID3D12Device> &device,
+                          const std::vector<VERTEX_TYPE> &vertex_data) {
+            m_vertex_count = vertex_data.size();
+            unsigned int data_size = sizeof(VERTEX_TYPE) * m_vertex_count;
+
+            create_resource(device, D3D12_HEAP_TYPE_UPLOAD, data_size,
+                            D3D12_RESOURCE_STATE_GENERIC_READ);
+            update(vertex_data);
+
+            init_view(sizeof(VERTEX_TYPE), data_size);
+        }
+
+        // only for buffers made with init_dynamic, vertex_data must not be larger than initially
+        template <typename VERTEX_TYPE>
+        void update(const std::vector<VERTEX_TYPE> &vertex_data) {
             void *vertex_memory;
             D3D12_RANGE zero_range = {.Begin = 0, .End = 0};
             check_output(m_vertexBuffer->Map(0, &zero_range, &vertex_memory));
-            std::memcpy(vertex_memory, vertex_data.data(), data_size);
+            std::memcpy(vertex_memory, vertex_data.data(),
+                        sizeof(VERTEX_TYPE) * vertex_data.size());
             m_vertexBuffer->Unmap(0, nullptr);
-
-            m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
-            m_vertexBufferView.StrideInBytes = sizeof(VERTEX_TYPE);
-            m_vertexBufferView.SizeInBytes = data_size;
         }
 
         D3D12_VERTEX_BUFFER_VIEW &get_view() {
             return m_vertexBufferView;
         }
 
+        const D3D12_VERTEX_BUFFER_VIEW &get_view() const {
+            return m_vertexBufferView;
+        }
+
         unsigned int get_vertex_count() {
             return m_vertex_count;
         }
-};
\ No newline at end of file
+};
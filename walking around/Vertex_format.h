@@ -0,0 +1,5 @@
+// shared between C++ and HLSL, comment out to go back to the 36 byte float vertex layout
+#define PACKED_VERTICES
+
+// mat_index keeps the texture array slice above its low MAT_INDEX_BITS bits
+#define MAT_INDEX_BITS 8
@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+// bounded Chase-Lev deque, the owner pushes and pops at the bottom, other threads steal the top
+// (memory orders from Le, Pop, Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing for
+// Weak Memory Models")
+template <typename T> class Work_stealing_deque {
+    private:
+        std::atomic<long long> top = 0, bottom = 0;
+        std::unique_ptr<std::atomic<T *>[]> buffer;
+        long long mask;
+
+    public:
+        // capacity must be a power of two
+        explicit Work_stealing_deque(std::size_t capacity)
+            : buffer(new std::atomic<T *>[capacity]), mask(capacity - 1) {}
+
+        // owner only, false when the deque is full
+        bool push(T *item) {
+            long long b = bottom.load(std::memory_order_relaxed);
+            long long t = top.load(std::memory_order_acquire);
+            if (b - t > mask) {
+                return false;
+            }
+            buffer[b & mask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // owner only, nullptr when empty or the last item was stolen
+        T *pop() {
+            long long b = bottom.load(std::memory_order_relaxed) - 1;
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            long long t = top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            T *item = buffer[b & mask].load(std::memory_order_relaxed);
+            if (t == b) {
+                // last item, race the thieves for it
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                 std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // any thread, nullptr when empty or another thread won the item
+        T *steal() {
+            long long t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            long long b = bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return nullptr;
+            }
+            T *item = buffer[t & mask].load(std::memory_order_relaxed);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return item;
+        }
+};
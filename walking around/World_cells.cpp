@@ -0,0 +1,136 @@
+#include "World_cells.hpp"
+#include "Terrain.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace world_cells {
+namespace {
+
+constexpr std::uint64_t world_seed = 0x5ca77e2b0b5e6a1dull;
+// no layer places anything this close to the terrain's edge
+constexpr float edge_margin = 8;
+// the ground around a house the other layers keep off
+constexpr float yard_radius = 4;
+// the forest's patches, and the slopes too steep for houses and trees
+constexpr float forest_wavelength = 40;
+constexpr float house_max_slope = 0.03f;
+constexpr float tree_max_slope = 0.3f;
+
+struct kind_desc_t {
+    public:
+        // how close two of the kind can be, half of it is kept inside the cell, which covers
+        // a prop's footprint and clearance and a neighbour's footprint, as the layers only
+        // see each other within the cell
+        float spacing;
+        float min_scale, max_scale;
+        // how far from its center a prop of scale 1 touches the ground
+        float footprint;
+        // what the other layers keep clear beyond the footprint
+        float clearance;
+};
+
+constexpr kind_desc_t kind_descs[kind_count] = {{16.0f, 1.0f, 1.5f, 1.4f, yard_radius},
+                                                {4.0f, 0.6f, 1.6f, 0.9f, 0},
+                                                {3.0f, 0.8f, 1.3f, 0.5f, 0}};
+
+float smoothstep(float low, float high, float value) {
+    float t = (std::clamp)((value - low) / (high - low), 0.0f, 1.0f);
+    return t * t * (3 - 2 * t);
+}
+
+float get_slope(float x, float z) {
+    return 1 - terrain::get_normal(x, z).y;
+}
+
+// in [0, 1], the patches trees grow in
+float get_forest(float x, float z) {
+    // moved off the heights' lattice, so the patches don't follow the hills
+    float noise =
+        terrain::value_noise(x / forest_wavelength + 37.5f, z / forest_wavelength - 11.25f);
+    return smoothstep(-0.2f, 0.5f, noise);
+}
+
+// the density maps, the chance a layer's point at x, z is kept, the slope's four heights are
+// only taken where the cheaper forest leaves a chance
+float get_density(unsigned int kind, float x, float z) {
+    switch (kind) {
+    case house: {
+        float open = 1 - get_forest(x, z);
+        return open > 0 && get_slope(x, z) < house_max_slope ? 0.2f * open : 0;
+    }
+    case stone:
+        return 0.1f + 0.5f * smoothstep(0.1f, 0.3f, get_slope(x, z));
+    default: {
+        float forest = get_forest(x, z);
+        return forest > 0 ? 0.9f * forest * (1 - smoothstep(0.15f, tree_max_slope,
+                                                            get_slope(x, z)))
+                          : 0;
+    }
+    }
+}
+
+} // namespace
+
+std::size_t get_count(const placements_t &placements) {
+    std::size_t count = 0;
+    for (const std::vector<math::affine> &transforms : placements.transforms) {
+        count += transforms.size();
+    }
+    return count;
+}
+
+math::float3 get_position(const math::affine &transform) {
+    return {transform.m[3][0], transform.m[3][1], transform.m[3][2]};
+}
+
+float get_scale(const math::affine &transform) {
+    const float(&row)[3] = transform.m[0];
+    return std::sqrt(row[0] * row[0] + row[1] * row[1] + row[2] * row[2]);
+}
+
+void get_placements(const Cell_residency::cell_t &cell,
+                    const std::vector<scatter::circle_t> &exclusions, placements_t &placements) {
+    float min_x = cell.x * cell_size, min_z = cell.z * cell_size;
+    float reach = terrain::size / 2 - edge_margin;
+    if ((std::max)(std::abs(min_x), std::abs(min_x + cell_size)) > reach
+        || (std::max)(std::abs(min_z), std::abs(min_z + cell_size)) > reach) {
+        return;
+    }
+
+    std::uint64_t cell_seed = scatter::hash(world_seed, Cell_residency::get_id(cell));
+    // the exclusions, then every placed prop's footprint and clearance
+    std::vector<scatter::circle_t> occupied = exclusions;
+    std::vector<scatter::point_t> points;
+    for (unsigned int kind = 0; kind < kind_count; kind++) {
+        const kind_desc_t &desc = kind_descs[kind];
+        scatter::layer_t layer = {desc.spacing, desc.footprint * desc.max_scale,
+                                  [kind](float x, float z) { return get_density(kind, x, z); }};
+        std::uint64_t seed = scatter::hash(cell_seed, kind);
+        points.clear();
+        scatter::sample(layer, seed, min_x, min_z, cell_size, occupied, points);
+
+        for (std::size_t i = 0; i < points.size(); i++) {
+            float x = points[i].x, z = points[i].z;
+            scatter::random_t random = {scatter::hash(seed, i + 1)};
+            float angle = random.next_unit() * math::two_pi;
+            float scale = desc.min_scale + random.next_unit() * (desc.max_scale - desc.min_scale);
+            // sunk to the lowest ground under it, so nothing hangs over a slope
+            float footprint = desc.footprint * scale, y = terrain::get_height(x, z);
+            const float offsets[4][2] = {
+                {footprint, 0}, {-footprint, 0}, {0, footprint}, {0, -footprint}};
+            for (const float(&offset)[2] : offsets) {
+                y = (std::min)(y, terrain::get_height(x + offset[0], z + offset[1]));
+            }
+
+            math::affine transform =
+                math::then_scaling(math::affine_identity(), scale, scale, scale);
+            transform = math::then_rotation_y(transform, angle);
+            placements.transforms[kind].push_back(math::then_translation(transform, x, y, z));
+            occupied.push_back({x, z, footprint + desc.clearance});
+        }
+    }
+}
+
+} // namespace world_cells
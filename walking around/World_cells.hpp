@@ -0,0 +1,43 @@
+#pragma once
+#include "Affine.hpp"
+#include "Cell_residency.hpp"
+#include "Scatter.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// what stands in the world's cells, made from the cell's coordinates alone so a cell that is
+// unloaded and loaded again gets the same props, every prop stands on the terrain and the cells
+// past its edge are empty
+//
+// every kind is a scatter layer with its own density map, houses first on flat open ground,
+// stones more on slopes, trees in patches of forest, each kept off the ones placed before it
+// and off the circles it is given around the hand placed scene; the layers' spacings keep
+// the props of neighbouring cells apart too, so a cell needs nothing of its neighbours
+namespace world_cells {
+
+constexpr float cell_size = 32;
+
+// the kinds of props, in the order of the meshes the streamer is given and the layers are
+// placed in
+enum kinds { house, stone, tree, kind_count };
+
+// a cell's props by kind as transforms from the mesh to the world, scaled, turned about y,
+// then moved onto the ground, what the meshes are copied through
+struct placements_t {
+    public:
+        std::vector<math::affine> transforms[kind_count];
+};
+
+std::size_t get_count(const placements_t &placements);
+
+// where a transform of placements_t puts the mesh's origin, and its scale
+math::float3 get_position(const math::affine &transform);
+float get_scale(const math::affine &transform);
+
+// appends the cell's props to placements, nothing is placed in the exclusions, runs on any
+// thread
+void get_placements(const Cell_residency::cell_t &cell,
+                    const std::vector<scatter::circle_t> &exclusions, placements_t &placements);
+
+} // namespace world_cells
@@ -0,0 +1,150 @@
+#include "World_streaming_benchmark.hpp"
+#include "Cell_residency.hpp"
+#include "World_cells.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr float load_radius = 80, unload_radius = 112;
+constexpr unsigned int max_loads_in_flight = 8;
+// a loaded cell's size, about what a prop's copied vertices and indices take on the GPU, most
+// of the props are trees
+constexpr std::uint64_t cell_bytes = 1 << 10, prop_bytes = 16 << 10;
+// the budget holds fewer cells than the load radius covers, so the walk has to evict
+constexpr std::uint64_t budget = 4 << 20;
+constexpr unsigned int load_frames = 3;
+constexpr float walk_speed = 0.5f, walk_start = -240, walk_z = 10;
+constexpr unsigned int border_frames = 600;
+// the walk over a border goes this far to either side of it
+constexpr float border_reach = 2;
+
+double microseconds_since(std::chrono::high_resolution_clock::time_point start_point) {
+    auto end_point = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end_point - start_point).count();
+}
+
+struct walk_t {
+    public:
+        unsigned int max_resident = 0;
+        std::uint64_t max_usage = 0;
+        double total_microseconds = 0, max_microseconds = 0;
+        Cell_residency::statistics_t statistics;
+};
+
+// every frame's loads finish load_frames later, sized by their props
+walk_t walk(Cell_residency &residency, unsigned int frame_count,
+            float (*position)(unsigned int frame)) {
+    struct load_t {
+        public:
+            Cell_residency::cell_t cell;
+            unsigned int done_frame;
+    };
+    std::deque<load_t> loads;
+    std::vector<Cell_residency::cell_t> unloads;
+    walk_t result;
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        auto start_point = std::chrono::high_resolution_clock::now();
+        for (; !loads.empty() && loads.front().done_frame <= frame; loads.pop_front()) {
+            world_cells::placements_t placements;
+            world_cells::get_placements(loads.front().cell, {}, placements);
+            residency.finish_load(loads.front().cell,
+                                  cell_bytes + world_cells::get_count(placements) * prop_bytes,
+                                  unloads);
+        }
+        Cell_residency::changes_t changes = residency.update(position(frame), walk_z);
+        double microseconds = microseconds_since(start_point);
+        for (const Cell_residency::cell_t &cell : changes.loads) {
+            loads.push_back({cell, frame + load_frames});
+        }
+        result.total_microseconds += microseconds;
+        result.max_microseconds = (std::max)(result.max_microseconds, microseconds);
+        const Cell_residency::statistics_t &statistics = residency.get_statistics();
+        result.max_resident = (std::max)(result.max_resident, statistics.resident);
+        result.max_usage = (std::max)(result.max_usage, statistics.usage);
+    }
+    result.statistics = residency.get_statistics();
+    return result;
+}
+} // namespace
+
+std::string benchmark_world_streaming(unsigned int cell_count, unsigned int frame_count,
+                                      Job_system &job_system) {
+    // the cells of a square around the origin
+    unsigned int side = 1;
+    while (side * side < cell_count) {
+        side++;
+    }
+    auto cell_of = [side](unsigned int i) {
+        return Cell_residency::cell_t{static_cast<int>(i % side) - static_cast<int>(side / 2),
+                                      static_cast<int>(i / side) - static_cast<int>(side / 2)};
+    };
+    std::vector<world_cells::placements_t> placements(cell_count);
+    auto start_point = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < cell_count; i++) {
+        world_cells::get_placements(cell_of(i), {}, placements[i]);
+    }
+    double serial_microseconds = microseconds_since(start_point);
+    std::size_t prop_count = 0;
+    for (const world_cells::placements_t &cell_placements : placements) {
+        prop_count += world_cells::get_count(cell_placements);
+    }
+
+    std::vector<world_cells::placements_t> parallel_placements(cell_count);
+    start_point = std::chrono::high_resolution_clock::now();
+    job_system.parallel_for(0, cell_count, 16, [&](unsigned int first, unsigned int end) {
+        for (unsigned int i = first; i < end; i++) {
+            world_cells::get_placements(cell_of(i), {}, parallel_placements[i]);
+        }
+    });
+    double parallel_microseconds = microseconds_since(start_point);
+    unsigned int differing = 0;
+    for (unsigned int i = 0; i < cell_count; i++) {
+        bool differs = false;
+        for (unsigned int kind = 0; kind < world_cells::kind_count; kind++) {
+            const std::vector<math::affine> &a = placements[i].transforms[kind];
+            const std::vector<math::affine> &b = parallel_placements[i].transforms[kind];
+            differs = differs || a.size() != b.size()
+                      || (!a.empty()
+                          && std::memcmp(a.data(), b.data(), a.size() * sizeof(math::affine)));
+        }
+        differing += differs;
+    }
+
+    std::stringstream s;
+    s << "world streaming: " << cell_count << " cells, " << prop_count << " props, "
+      << cell_count / serial_microseconds * 1e6 << " cells/s on one thread, "
+      << cell_count / parallel_microseconds * 1e6 << " cells/s on "
+      << job_system.get_thread_count() << " threads, " << differing << " cells differ\n";
+
+    Cell_residency residency;
+    residency.init(world_cells::cell_size, load_radius, unload_radius, budget,
+                   max_loads_in_flight);
+    walk_t across = walk(residency, frame_count,
+                         [](unsigned int frame) { return walk_start + frame * walk_speed; });
+    s << "world streaming: " << frame_count << " frames walking at " << walk_speed
+      << " a frame, " << across.statistics.loads << " loads, " << across.statistics.unloads
+      << " unloads, " << across.statistics.refused << " loads refused, at most "
+      << across.max_resident << " resident, " << (across.max_usage >> 10) << " of "
+      << (budget >> 10) << " KB" << (across.max_usage > budget ? ", FAILED over the budget" : "")
+      << ", update " << across.total_microseconds / frame_count << " us mean, "
+      << across.max_microseconds << " us max\n";
+
+    // back and forth over the border at x = 0 every 20 frames
+    auto over_border = [](unsigned int frame) {
+        return frame / 20 % 2 ? border_reach : -border_reach;
+    };
+    s << "world streaming: " << border_frames << " frames over a cell border,";
+    for (float unload : {unload_radius, load_radius}) {
+        residency.init(world_cells::cell_size, load_radius, unload, ~0ull, max_loads_in_flight);
+        walk_t border = walk(residency, border_frames, over_border);
+        s << (unload > load_radius ? " with" : " without") << " hysteresis "
+          << border.statistics.loads << " loads, " << border.statistics.unloads << " unloads"
+          << (unload > load_radius ? "," : "\n");
+    }
+    return s.str();
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "Job_system.hpp"
+
+#include <string>
+
+// the props of cell_count cells made on one thread and on the job system, then frame_count
+// frames of a walk across the world under a memory budget, with the loads finishing a few
+// frames after they start, failed when the resident cells ever take more than the budget, and
+// a walk back and forth over a cell border with and without the unload radius' hysteresis, one
+// line each
+std::string benchmark_world_streaming(unsigned int cell_count, unsigned int frame_count,
+                                      Job_system &job_system);
@@ -1,3229 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Buffer Definitions: 
-//
-// cbuffer vs_const_buffer_t
-// {
-//
-//   float4x4 matWorld[10];             // Offset:    0 Size:   640
-//   float4x4 matView;                  // Offset:  640 Size:    64
-//   float4x4 matProj;                  // Offset:  704 Size:    64
-//   float4 colLight;                   // Offset:  768 Size:    16 [unused]
-//   float4 dirLight;                   // Offset:  784 Size:    16 [unused]
-//
-// }
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- ------- -------------- ------
-// vs_const_buffer_t                 cbuffer      NA          NA     CB0            cb0      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// POSITION                 0   xyz         0     NONE   float   xyz 
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// TEXCOORD                 0   xy          2     NONE   float   xy  
-// MAT_INDEX                0   x           3     NONE    uint   x   
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_POSITION              0   xyzw        0      POS   float   xyzw
-// VIEWER                   0   xyzw        1     NONE   float   xyzw
-// TEXCOORD                 0   xy          2     NONE   float   xy  
-// NORMAL_PS                0   xyz         3     NONE   float   xyz 
-//
-vs_5_1
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_constantbuffer CB0[0:0][48], dynamicIndexed, space=0
-dcl_input v0.xyz
-dcl_input v1.xyz
-dcl_input v2.xy
-dcl_input v3.x
-dcl_output_siv o0.xyzw, position
-dcl_output o1.xyzw
-dcl_output o2.xy
-dcl_output o3.xyz
-dcl_temps 5
-//
-// Initial variable locations:
-//   v0.x <- pos.x; v0.y <- pos.y; v0.z <- pos.z; 
-//   v1.x <- norm.x; v1.y <- norm.y; v1.z <- norm.z; 
-//   v2.x <- tex.x; v2.y <- tex.y; 
-//   v3.x <- mat_index; 
-//   o3.x <- <main return value>.norm.x; o3.y <- <main return value>.norm.y; o3.z <- <main return value>.norm.z; 
-//   o2.x <- <main return value>.tex.x; o2.y <- <main return value>.tex.y; 
-//   o1.x <- <main return value>.viewer.x; o1.y <- <main return value>.viewer.y; o1.z <- <main return value>.viewer.z; o1.w <- <main return value>.viewer.w; 
-//   o0.x <- <main return value>.position.x; o0.y <- <main return value>.position.y; o0.z <- <main return value>.position.z; o0.w <- <main return value>.position.w
-//
-#line 25 "C:\Users\user157\source\repos\walking around\walking around\VertexShader.hlsl"
-imul null, r0.x, v3.x, l(4)
-mov r1.xyz, v1.xyzx
-mov r1.w, l(0)
-dp4 r2.x, r1.xyzw, CB0[0][r0.x + 0].xyzw
-dp4 r2.y, r1.xyzw, CB0[0][r0.x + 1].xyzw
-dp4 r2.z, r1.xyzw, CB0[0][r0.x + 2].xyzw
-dp4 r2.w, r1.xyzw, CB0[0][r0.x + 3].xyzw
-dp4 r0.x, r2.xyzw, CB0[0][40].xyzw  // r0.x <- normal_vec.x
-dp4 r0.y, r2.xyzw, CB0[0][41].xyzw  // r0.y <- normal_vec.y
-dp4 r0.z, r2.xyzw, CB0[0][42].xyzw  // r0.z <- normal_vec.z
-dp4 r0.w, r2.xyzw, CB0[0][43].xyzw  // r0.w <- normal_vec.w
-
-#line 26
-imul null, r1.x, v3.x, l(4)
-mov r2.xyz, v0.xyzx
-mov r2.w, l(1.000000)
-dp4 r3.x, r2.xyzw, CB0[0][r1.x + 0].xyzw
-dp4 r3.y, r2.xyzw, CB0[0][r1.x + 1].xyzw
-dp4 r3.z, r2.xyzw, CB0[0][r1.x + 2].xyzw
-dp4 r3.w, r2.xyzw, CB0[0][r1.x + 3].xyzw
-dp4 r1.x, r3.xyzw, CB0[0][40].xyzw
-dp4 r1.y, r3.xyzw, CB0[0][41].xyzw
-dp4 r1.z, r3.xyzw, CB0[0][42].xyzw
-dp4 r1.w, r3.xyzw, CB0[0][43].xyzw
-mov r1.xyzw, -r1.xyzw  // r1.x <- result.viewer.x; r1.y <- result.viewer.y; r1.z <- result.viewer.z; r1.w <- result.viewer.w
-
-#line 27
-imul null, r3.x, v3.x, l(4)
-dp4 r4.x, r2.xyzw, CB0[0][r3.x + 0].xyzw
-dp4 r4.y, r2.xyzw, CB0[0][r3.x + 1].xyzw
-dp4 r4.z, r2.xyzw, CB0[0][r3.x + 2].xyzw
-dp4 r4.w, r2.xyzw, CB0[0][r3.x + 3].xyzw
-dp4 r2.x, r4.xyzw, CB0[0][40].xyzw
-dp4 r2.y, r4.xyzw, CB0[0][41].xyzw
-dp4 r2.z, r4.xyzw, CB0[0][42].xyzw
-dp4 r2.w, r4.xyzw, CB0[0][43].xyzw
-dp4 r3.x, r2.xyzw, CB0[0][44].xyzw  // r3.x <- result.position.x
-dp4 r3.y, r2.xyzw, CB0[0][45].xyzw  // r3.y <- result.position.y
-dp4 r3.z, r2.xyzw, CB0[0][46].xyzw  // r3.z <- result.position.z
-dp4 r3.w, r2.xyzw, CB0[0][47].xyzw  // r3.w <- result.position.w
-
-#line 28
-mov r2.xy, v2.xyxx  // r2.x <- result.tex.x; r2.y <- result.tex.y
-
-#line 29
-dp4 r0.w, r0.xyzw, r0.xyzw
-rsq r0.w, r0.w
-mul r0.xyz, r0.wwww, r0.xyzx  // r0.x <- result.norm.x; r0.y <- result.norm.y; r0.z <- result.norm.z
-
-#line 31
-mov o0.xyzw, r3.xyzw
-mov o1.xyzw, r1.xyzw
-mov o3.xyz, r0.xyzx
-mov o2.xy, r2.xyxx
-ret 
-// Approximately 45 instruction slots used
-#endif
-
-const BYTE vs_main[] =
-{
-     68,  88,  66,  67, 148, 188, 
-     75, 202,  50, 243,  81,  38, 
-     45, 111,  74, 204, 107, 246, 
-    139, 168,   1,   0,   0,   0, 
-    152,  72,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-    108,   2,   0,   0,   0,   3, 
-      0,   0, 152,   3,   0,   0, 
-    244,   9,   0,   0, 144,  10, 
-      0,   0,  82,  68,  69,  70, 
-     44,   2,   0,   0,   1,   0, 
-      0,   0, 120,   0,   0,   0, 
-      1,   0,   0,   0,  60,   0, 
-      0,   0,   1,   5, 254, 255, 
-      5,   5,   0,   0,   1,   2, 
-      0,   0,  19,  19,  68,  37, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  40,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 100,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 118, 115,  95,  99, 
-    111, 110, 115, 116,  95,  98, 
-    117, 102, 102, 101, 114,  95, 
-    116,   0, 171, 171, 100,   0, 
-      0,   0,   5,   0,   0,   0, 
-    144,   0,   0,   0,  32,   3, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   0,   0,   0, 
-    128,   2,   0,   0,   2,   0, 
-      0,   0, 108,   1,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 144,   1,   0,   0, 
-    128,   2,   0,   0,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-    152,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    188,   1,   0,   0, 192,   2, 
-      0,   0,  64,   0,   0,   0, 
-      2,   0,   0,   0, 152,   1, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 196,   1, 
-      0,   0,   0,   3,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0, 212,   1,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 248,   1,   0,   0, 
-     16,   3,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-    212,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    109,  97, 116,  87, 111, 114, 
-    108, 100,   0, 102, 108, 111, 
-     97, 116,  52, 120,  52,   0, 
-    171, 171,   3,   0,   3,   0, 
-      4,   0,   4,   0,  10,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  97,   1, 
-      0,   0, 109,  97, 116,  86, 
-    105, 101, 119,   0,   3,   0, 
-      3,   0,   4,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     97,   1,   0,   0, 109,  97, 
-    116,  80, 114, 111, 106,   0, 
-     99, 111, 108,  76, 105, 103, 
-    104, 116,   0, 102, 108, 111, 
-     97, 116,  52,   0,   1,   0, 
-      3,   0,   1,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    205,   1,   0,   0, 100, 105, 
-    114,  76, 105, 103, 104, 116, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     49,  48,  46,  49,   0, 171, 
-    171, 171,  73,  83,  71,  78, 
-    140,   0,   0,   0,   4,   0, 
-      0,   0,   8,   0,   0,   0, 
-    104,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   7,   7,   0,   0, 
-    113,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   1,   0, 
-      0,   0,   7,   7,   0,   0, 
-    120,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   2,   0, 
-      0,   0,   3,   3,   0,   0, 
-    129,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   3,   0, 
-      0,   0,   1,   1,   0,   0, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,   0,  78,  79,  82, 
-     77,  65,  76,   0,  84,  69, 
-     88,  67,  79,  79,  82,  68, 
-      0,  77,  65,  84,  95,  73, 
-     78,  68,  69,  88,   0, 171, 
-     79,  83,  71,  78, 144,   0, 
-      0,   0,   4,   0,   0,   0, 
-      8,   0,   0,   0, 104,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-     15,   0,   0,   0, 116,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-     15,   0,   0,   0, 123,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   2,   0,   0,   0, 
-      3,  12,   0,   0, 132,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   3,   0,   0,   0, 
-      7,   8,   0,   0,  83,  86, 
-     95,  80,  79,  83,  73,  84, 
-     73,  79,  78,   0,  86,  73, 
-     69,  87,  69,  82,   0,  84, 
-     69,  88,  67,  79,  79,  82, 
-     68,   0,  78,  79,  82,  77, 
-     65,  76,  95,  80,  83,   0, 
-    171, 171,  83,  72,  69,  88, 
-     84,   6,   0,   0,  81,   0, 
-      1,   0, 149,   1,   0,   0, 
-    106, 136,   0,   1,  89,   8, 
-      0,   7,  70, 142,  48,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     48,   0,   0,   0,   0,   0, 
-      0,   0,  95,   0,   0,   3, 
-    114,  16,  16,   0,   0,   0, 
-      0,   0,  95,   0,   0,   3, 
-    114,  16,  16,   0,   1,   0, 
-      0,   0,  95,   0,   0,   3, 
-     50,  16,  16,   0,   2,   0, 
-      0,   0,  95,   0,   0,   3, 
-     18,  16,  16,   0,   3,   0, 
-      0,   0, 103,   0,   0,   4, 
-    242,  32,  16,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-    101,   0,   0,   3, 242,  32, 
-     16,   0,   1,   0,   0,   0, 
-    101,   0,   0,   3,  50,  32, 
-     16,   0,   2,   0,   0,   0, 
-    101,   0,   0,   3, 114,  32, 
-     16,   0,   3,   0,   0,   0, 
-    104,   0,   0,   2,   5,   0, 
-      0,   0,  38,   0,   0,   8, 
-      0, 208,   0,   0,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,  16,  16,   0,   3,   0, 
-      0,   0,   1,  64,   0,   0, 
-      4,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      1,   0,   0,   0,  70,  18, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  17,   0,   0,  10, 
-     18,   0,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  70, 142, 
-     48,  32,   0,   0,   0,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     17,   0,   0,  11,  34,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,  70, 142,  48,  48, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  17,   0,   0,  11, 
-     66,   0,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  70, 142, 
-     48,  48,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,  11, 130,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   1,   0,   0,   0, 
-     70, 142,  48,  48,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     17,   0,   0,   9,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  40,   0,   0,   0, 
-     17,   0,   0,   9,  34,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  41,   0,   0,   0, 
-     17,   0,   0,   9,  66,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  42,   0,   0,   0, 
-     17,   0,   0,   9, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  43,   0,   0,   0, 
-     38,   0,   0,   8,   0, 208, 
-      0,   0,  18,   0,  16,   0, 
-      1,   0,   0,   0,  10,  16, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   4,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   2,   0, 
-      0,   0,  70,  18,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     17,   0,   0,  10,  18,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,  32, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  17,   0, 
-      0,  11,  34,   0,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  48,  48,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     17,   0,   0,  11,  66,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,  48, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  17,   0,   0,  11, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     48,  48,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  17,   0, 
-      0,   9,  18,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0,  17,   0, 
-      0,   9,  34,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     41,   0,   0,   0,  17,   0, 
-      0,   9,  66,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     42,   0,   0,   0,  17,   0, 
-      0,   9, 130,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     43,   0,   0,   0,  54,   0, 
-      0,   6, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16, 128,  65,   0,   0,   0, 
-      1,   0,   0,   0,  38,   0, 
-      0,   8,   0, 208,   0,   0, 
-     18,   0,  16,   0,   3,   0, 
-      0,   0,  10,  16,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0,   4,   0,   0,   0, 
-     17,   0,   0,  10,  18,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,  32, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      3,   0,   0,   0,  17,   0, 
-      0,  11,  34,   0,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  48,  48,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     17,   0,   0,  11,  66,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  48,  48, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
-      0,   0,  17,   0,   0,  11, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     48,  48,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,  10,   0,  16,   0, 
-      3,   0,   0,   0,  17,   0, 
-      0,   9,  18,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0,  17,   0, 
-      0,   9,  34,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     41,   0,   0,   0,  17,   0, 
-      0,   9,  66,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     42,   0,   0,   0,  17,   0, 
-      0,   9, 130,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     43,   0,   0,   0,  17,   0, 
-      0,   9,  18,   0,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     44,   0,   0,   0,  17,   0, 
-      0,   9,  34,   0,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     45,   0,   0,   0,  17,   0, 
-      0,   9,  66,   0,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     46,   0,   0,   0,  17,   0, 
-      0,   9, 130,   0,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     47,   0,   0,   0,  54,   0, 
-      0,   5,  50,   0,  16,   0, 
-      2,   0,   0,   0,  70,  16, 
-     16,   0,   2,   0,   0,   0, 
-     17,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-    246,  15,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 242,  32,  16,   0, 
-      0,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5, 242,  32, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,  32,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  50,  32,  16,   0, 
-      2,   0,   0,   0,  70,   0, 
-     16,   0,   2,   0,   0,   0, 
-     62,   0,   0,   1,  83,  84, 
-     65,  84, 148,   0,   0,   0, 
-     45,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      8,   0,   0,   0,  32,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   9,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  83,  80, 
-     68,  66,   0,  62,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  67,  47, 
-     67,  43,  43,  32,  77,  83, 
-     70,  32,  55,  46,  48,  48, 
-     13,  10,  26,  68,  83,   0, 
-      0,   0,   0,   2,   0,   0, 
-      2,   0,   0,   0,  31,   0, 
-      0,   0, 160,   0,   0,   0, 
-      0,   0,   0,   0,  29,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 192, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,  56,   0, 
-      0, 192, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-      5,   0,   0,   0,  32,   0, 
-      0,   0,  60,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      6,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1, 145,  49, 169, 103, 
-      1,   0,   0,   0, 107, 246, 
-    116,  23, 190,  81, 167,  68, 
-    129,  94, 183, 231,  74, 253, 
-    112, 177,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     79,  83,  73,  84,  73,  79, 
-     78,  44,  13,  10,  32,   9, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 110, 111, 114, 109, 
-     32,  58,  32,  78,  79,  82, 
-     77,  65,  76,  44,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 116, 101, 120, 
-     32,  58,  32,  84,  69,  88, 
-     67,  79,  79,  82,  68,  44, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 117, 105, 
-    110, 116,  32, 109,  97, 116, 
-     95, 105, 110, 100, 101, 120, 
-     32,  58,  32,  77,  65,  84, 
-     95,  73,  78,  68,  69,  88, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 118, 115, 
-     95, 111, 117, 116, 112, 117, 
-    116,  95, 116,  32, 114, 101, 
-    115, 117, 108, 116,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    110, 111, 114, 109,  97, 108, 
-     95, 118, 101,  99,  32,  61, 
-     32, 109, 117, 108,  40, 109, 
-    117, 108,  40, 102, 108, 111, 
-     97, 116,  52,  40, 110, 111, 
-    114, 109,  44,  32,  48,  46, 
-     48, 102,  41,  44,  32, 109, 
-     97, 116,  87, 111, 114, 108, 
-    100,  91, 109,  97, 116,  95, 
-    105, 110, 100, 101, 120,  93, 
-     41,  44,  32, 109,  97, 116, 
-     86, 105, 101, 119,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 115, 117, 108, 116, 
-     46, 118, 105, 101, 119, 101, 
-    114,  32,  61,  32,  45, 109, 
-    117, 108,  40, 109, 117, 108, 
-     40, 102, 108, 111,  97, 116, 
-     52,  40, 112, 111, 115,  44, 
-     32,  49,  46,  48, 102,  41, 
-     44,  32, 109,  97, 116,  87, 
-    111, 114, 108, 100,  91, 109, 
-     97, 116,  95, 105, 110, 100, 
-    101, 120,  93,  41,  44,  32, 
-    109,  97, 116,  86, 105, 101, 
-    119,  41,  59,  13,  10,  32, 
-     32,  32,  32, 114, 101, 115, 
-    117, 108, 116,  46, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-     32,  61,  32, 109, 117, 108, 
-     40, 109, 117, 108,  40, 109, 
-    117, 108,  40, 102, 108, 111, 
-     97, 116,  52,  40, 112, 111, 
-    115,  44,  32,  49,  46,  48, 
-    102,  41,  44,  32, 109,  97, 
-    116,  87, 111, 114, 108, 100, 
-     91, 109,  97, 116,  95, 105, 
-    110, 100, 101, 120,  93,  41, 
-     44,  32, 109,  97, 116,  86, 
-    105, 101, 119,  41,  44,  32, 
-    109,  97, 116,  80, 114, 111, 
-    106,  41,  59,  13,  10,  32, 
-     32,  32,  32, 114, 101, 115, 
-    117, 108, 116,  46, 116, 101, 
-    120,  32,  61,  32, 116, 101, 
-    120,  59,  13,  10,  32,  32, 
-     32,  32, 114, 101, 115, 117, 
-    108, 116,  46, 110, 111, 114, 
-    109,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40, 110, 111, 114, 109, 
-     97, 108,  95, 118, 101,  99, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 114, 
-    101, 115, 117, 108, 116,  59, 
-     13,  10, 125,  13,  10,   0, 
-      7,   0,   0,   0, 158,   0, 
-      0,   0,  79,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,  80,   0,   0,   0, 
-      0,   0,  76, 232,   3,   0, 
-    117, 131,   1,   0,  75,  47, 
-      2,   0, 198,  90,   0,   0, 
-     72,  69,   2,   0, 110,  22, 
-      0,   0, 109,  24,   1,   0, 
-     40, 110,   3,   0, 103, 159, 
-      1,   0, 125,  10,   2,   0, 
-    147, 164,   3,   0, 206,  21, 
-      0,   0, 153, 189,   3,   0, 
-    125, 181,   2,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-    118, 115,  95,  99, 111, 110, 
-    115, 116,  95,  98, 117, 102, 
-    102, 101, 114,  95, 116,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52, 120,  52,  32, 109, 
-     97, 116,  87, 111, 114, 108, 
-    100,  91,  49,  48,  93,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-    120,  52,  32, 109,  97, 116, 
-     86, 105, 101, 119,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52, 120, 
-     52,  32, 109,  97, 116,  80, 
-    114, 111, 106,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-    111, 108,  76, 105, 103, 104, 
-    116,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 100, 105, 114, 
-     76, 105, 103, 104, 116,  59, 
-     13,  10, 125,  59,  13,  10, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32, 118, 115,  95, 
-    111, 117, 116, 112, 117, 116, 
-     95, 116,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  58,  32,  83, 
-     86,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    118, 105, 101, 119, 101, 114, 
-     32,  58,  32,  86,  73,  69, 
-     87,  69,  82,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32, 116, 
-    101, 120,  32,  58,  32,  84, 
-     69,  88,  67,  79,  79,  82, 
-     68,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 110, 111, 114, 
-    109,  32,  58,  32,  78,  79, 
-     82,  77,  65,  76,  95,  80, 
-     83,  59,  13,  10, 125,  59, 
-     13,  10,  13,  10, 118, 115, 
-     95, 111, 117, 116, 112, 117, 
-    116,  95, 116,  32, 109,  97, 
-    105, 110,  40,  13,  10,  32, 
-      9,   9, 102, 108, 111,  97, 
-    116,  51,  32, 112, 111, 115, 
-     32,  58,  32,  80,  79,  83, 
-     73,  84,  73,  79,  78,  44, 
-     13,  10,  32,   9,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-    110, 111, 114, 109,  32,  58, 
-     32,  78,  79,  82,  77,  65, 
-     76,  44,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  50, 
-     32, 116, 101, 120,  32,  58, 
-     32,  84,  69,  88,  67,  79, 
-     79,  82,  68,  44,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 117, 105, 110, 116, 
-     32, 109,  97, 116,  95, 105, 
-    110, 100, 101, 120,  32,  58, 
-     32,  77,  65,  84,  95,  73, 
-     78,  68,  69,  88,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 118, 115,  95, 111, 
-    117, 116, 112, 117, 116,  95, 
-    116,  32, 114, 101, 115, 117, 
-    108, 116,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32, 110, 111, 
-    114, 109,  97, 108,  95, 118, 
-    101,  99,  32,  61,  32, 109, 
-    117, 108,  40, 109, 117, 108, 
-     40, 102, 108, 111,  97, 116, 
-     52,  40, 110, 111, 114, 109, 
-     44,  32,  48,  46,  48, 102, 
-     41,  44,  32, 109,  97, 116, 
-     87, 111, 114, 108, 100,  91, 
-    109,  97, 116,  95, 105, 110, 
-    100, 101, 120,  93,  41,  44, 
-     32, 109,  97, 116,  86, 105, 
-    101, 119,  41,  59,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    115, 117, 108, 116,  46, 118, 
-    105, 101, 119, 101, 114,  32, 
-     61,  32,  45, 109, 117, 108, 
-     40, 109, 117, 108,  40, 102, 
-    108, 111,  97, 116,  52,  40, 
-    112, 111, 115,  44,  32,  49, 
-     46,  48, 102,  41,  44,  32, 
-    109,  97, 116,  87, 111, 114, 
-    108, 100,  91, 109,  97, 116, 
-     95, 105, 110, 100, 101, 120, 
-     93,  41,  44,  32, 109,  97, 
-    116,  86, 105, 101, 119,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 114, 101, 115, 117, 108, 
-    116,  46, 112, 111, 115, 105, 
-    116, 105, 111, 110,  32,  61, 
-     32, 109, 117, 108,  40, 109, 
-    117, 108,  40, 109, 117, 108, 
-     40, 102, 108, 111,  97, 116, 
-     52,  40, 112, 111, 115,  44, 
-     32,  49,  46,  48, 102,  41, 
-     44,  32, 109,  97, 116,  87, 
-    111, 114, 108, 100,  91, 109, 
-     97, 116,  95, 105, 110, 100, 
-    101, 120,  93,  41,  44,  32, 
-    109,  97, 116,  86, 105, 101, 
-    119,  41,  44,  32, 109,  97, 
-    116,  80, 114, 111, 106,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 114, 101, 115, 117, 108, 
-    116,  46, 116, 101, 120,  32, 
-     61,  32, 116, 101, 120,  59, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 115, 117, 108, 116, 
-     46, 110, 111, 114, 109,  32, 
-     61,  32, 110, 111, 114, 109, 
-     97, 108, 105, 122, 101,  40, 
-    110, 111, 114, 109,  97, 108, 
-     95, 118, 101,  99,  41,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 114, 101, 115, 
-    117, 108, 116,  59,  13,  10, 
-    125,  13,  10,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 254, 239, 254, 239, 
-      1,   0,   0,   0, 218,   3, 
-      0,   0,   0,  67,  58,  92, 
-     85, 115, 101, 114, 115,  92, 
-    117, 115, 101, 114,  49,  53, 
-     55,  92, 115, 111, 117, 114, 
-     99, 101,  92, 114, 101, 112, 
-    111, 115,  92, 119,  97, 108, 
-    107, 105, 110, 103,  32,  97, 
-    114, 111, 117, 110, 100,  92, 
-    119,  97, 108, 107, 105, 110, 
-    103,  32,  97, 114, 111, 117, 
-    110, 100,  92,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  46, 104, 108, 
-    115, 108,   0,   0,  99,  58, 
-     92, 117, 115, 101, 114, 115, 
-     92, 117, 115, 101, 114,  49, 
-     53,  55,  92, 115, 111, 117, 
-    114,  99, 101,  92, 114, 101, 
-    112, 111, 115,  92, 119,  97, 
-    108, 107, 105, 110, 103,  32, 
-     97, 114, 111, 117, 110, 100, 
-     92, 119,  97, 108, 107, 105, 
-    110, 103,  32,  97, 114, 111, 
-    117, 110, 100,  92, 118, 101, 
-    114, 116, 101, 120, 115, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-    118, 115,  95,  99, 111, 110, 
-    115, 116,  95,  98, 117, 102, 
-    102, 101, 114,  95, 116,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52, 120,  52,  32, 109, 
-     97, 116,  87, 111, 114, 108, 
-    100,  91,  49,  48,  93,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-    120,  52,  32, 109,  97, 116, 
-     86, 105, 101, 119,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52, 120, 
-     52,  32, 109,  97, 116,  80, 
-    114, 111, 106,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-    111, 108,  76, 105, 103, 104, 
-    116,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 100, 105, 114, 
-     76, 105, 103, 104, 116,  59, 
-     13,  10, 125,  59,  13,  10, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32, 118, 115,  95, 
-    111, 117, 116, 112, 117, 116, 
-     95, 116,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  58,  32,  83, 
-     86,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    118, 105, 101, 119, 101, 114, 
-     32,  58,  32,  86,  73,  69, 
-     87,  69,  82,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32, 116, 
-    101, 120,  32,  58,  32,  84, 
-     69,  88,  67,  79,  79,  82, 
-     68,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 110, 111, 114, 
-    109,  32,  58,  32,  78,  79, 
-     82,  77,  65,  76,  95,  80, 
-     83,  59,  13,  10, 125,  59, 
-     13,  10,  13,  10, 118, 115, 
-     95, 111, 117, 116, 112, 117, 
-    116,  95, 116,  32, 109,  97, 
-    105, 110,  40,  13,  10,  32, 
-      9,   9, 102, 108, 111,  97, 
-    116,  51,  32, 112, 111, 115, 
-     32,  58,  32,  80,  27, 226, 
-     48,   1, 128,   0,   0,   0, 
-     85,  93,  27,  59,  69, 123, 
-    219,   1,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      2,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,  80,   0, 
-      0,   0,  40,   0,   0,   0, 
-     27, 226,  48,   1, 241, 101, 
-    139, 223,  59,   3,   0,   0, 
-      1,   0,   0,   0,  79,   0, 
-      0,   0,  80,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      4,   0,   0,   0,  66,   0, 
-     60,  17,  16,   1,   0,   0, 
-      0,   1,  10,   0,   1,   0, 
-    161,  12,  93,  88,  10,   0, 
-      1,   0, 161,  12,  93,  88, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  40,  82, 
-     41,  32,  72,  76,  83,  76, 
-     32,  83, 104,  97, 100, 101, 
-    114,  32,  67, 111, 109, 112, 
-    105, 108, 101, 114,  32,  49, 
-     48,  46,  49,   0,   0,   0, 
-     54,   0,  61,  17,   1, 104, 
-    108, 115, 108,  70, 108,  97, 
-    103, 115,   0,  48, 120,  53, 
-      0, 104, 108, 115, 108,  84, 
-     97, 114, 103, 101, 116,   0, 
-    118, 115,  95,  53,  95,  49, 
-      0, 104, 108, 115, 108,  69, 
-    110, 116, 114, 121,   0, 109, 
-     97, 105, 110,   0,   0,   0, 
-      0,   0,  42,   0,  16,  17, 
-      0,   0,   0,   0, 172,   5, 
-      0,   0,   0,   0,   0,   0, 
-    192,   5,   0,   0,   0,   0, 
-      0,   0, 192,   5,   0,   0, 
-      7,  16,   0,   0, 148,   0, 
-      0,   0,   1,   0, 160, 109, 
-     97, 105, 110,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0, 112, 111, 115,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   0,   0,   4,   0, 
-    148,   0,   0,   0,   1,   0, 
-    192,   5,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   4,   0,   4,   0, 
-    148,   0,   0,   0,   1,   0, 
-    192,   5,   4,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   8,   0,   4,   0, 
-    148,   0,   0,   0,   1,   0, 
-    192,   5,   8,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   9,   0, 110, 111, 
-    114, 109,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   0,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   4,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   8,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  24,   0, 
-      0,   0,  42,   0,  62,  17, 
-      1,  16,   0,   0,   9,   0, 
-    116, 101, 120,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      0,   0,   4,   0, 148,   0, 
-      0,   0,   1,   0, 192,   5, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      4,   0,   4,   0, 148,   0, 
-      0,   0,   1,   0, 192,   5, 
-     36,   0,   0,   0,  50,   0, 
-     62,  17, 117,   0,   0,   0, 
-      1,   0, 109,  97, 116,  95, 
-    105, 110, 100, 101, 120,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   1,   0,   0,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  48,   0, 
-      0,   0,  58,   0,  62,  17, 
-      6,  16,   0,   0, 136,   0, 
-     60, 109,  97, 105, 110,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  40,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  48,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  44,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  48,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  56,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  32,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  32,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  36,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  36,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  16,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  20,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  24,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  28,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  28,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   0,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   4,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   8,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  12,   0, 
-      4,   0, 148,   0,   0,   0, 
-      1,   0, 192,   5,  12,   0, 
-      0,   0,  46,   0,  62,  17, 
-      5,  16,   0,   0,   8,   0, 
-    114, 101, 115, 117, 108, 116, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  16,   0, 
-      4,   0, 180,   3,   0,   0, 
-      1,   0, 160,   2,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  20,   0, 
-      4,   0, 180,   3,   0,   0, 
-      1,   0, 160,   2,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  24,   0, 
-      4,   0, 180,   3,   0,   0, 
-      1,   0, 160,   2,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  28,   0, 
-      4,   0, 180,   3,   0,   0, 
-      1,   0, 160,   2,  28,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  52,   5,   0,   0, 
-      1,   0,  32,   1,  48,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  88,   5,   0,   0, 
-      1,   0, 252,   0,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 124,   5,   0,   0, 
-      1,   0, 216,   0,  56,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0, 160,   5,   0,   0, 
-      1,   0, 180,   0,  60,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  32,   0, 
-      4,   0, 180,   5,   0,   0, 
-      1,   0, 160,   0,  32,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  36,   0, 
-      4,   0, 180,   5,   0,   0, 
-      1,   0, 160,   0,  36,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  40,   0, 
-      4,   0,   0,   6,   0,   0, 
-      1,   0,  84,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  44,   0, 
-      4,   0,   0,   6,   0,   0, 
-      1,   0,  84,   0,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  48,   0, 
-      4,   0,   0,   6,   0,   0, 
-      1,   0,  84,   0,   8,   0, 
-      0,   0,  50,   0,  62,  17, 
-      3,  16,   0,   0,   8,   0, 
-    110, 111, 114, 109,  97, 108, 
-     95, 118, 101,  99,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    172,   1,   0,   0,   1,   0, 
-     84,   4,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    208,   1,   0,   0,   1,   0, 
-     48,   4,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    244,   1,   0,   0,   1,   0, 
-     12,   4,   8,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  12,   0,   4,   0, 
-     24,   2,   0,   0,   1,   0, 
-    184,   3,  12,   0,   0,   0, 
-      2,   0,   6,   0, 244,   0, 
-      0,   0,  24,   0,   0,   0, 
-      1,   0,   0,   0,  16,   1, 
-    241, 172, 125, 226,  11,  33, 
-    180, 120, 245,  84, 133, 136, 
-     75, 121, 140, 204,   0,   0, 
-    242,   0,   0,   0,  80,   4, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   1,   0,  84,   6, 
-      0,   0,   0,   0,   0,   0, 
-     90,   0,   0,   0,  68,   4, 
-      0,   0, 148,   0,   0,   0, 
-     25,   0,   0, 128, 148,   0, 
-      0,   0,  25,   0,   0,   0, 
-    180,   0,   0,   0,  25,   0, 
-      0, 128, 180,   0,   0,   0, 
-     25,   0,   0,   0, 200,   0, 
-      0,   0,  25,   0,   0, 128, 
-    200,   0,   0,   0,  25,   0, 
-      0,   0, 220,   0,   0,   0, 
-     25,   0,   0, 128, 220,   0, 
-      0,   0,  25,   0,   0,   0, 
-      4,   1,   0,   0,  25,   0, 
-      0, 128,   4,   1,   0,   0, 
-     25,   0,   0,   0,  48,   1, 
-      0,   0,  25,   0,   0, 128, 
-     48,   1,   0,   0,  25,   0, 
-      0,   0,  92,   1,   0,   0, 
-     25,   0,   0, 128,  92,   1, 
-      0,   0,  25,   0,   0,   0, 
-    136,   1,   0,   0,  25,   0, 
-      0, 128, 136,   1,   0,   0, 
-     25,   0,   0,   0, 172,   1, 
-      0,   0,  25,   0,   0, 128, 
-    172,   1,   0,   0,  25,   0, 
-      0,   0, 208,   1,   0,   0, 
-     25,   0,   0, 128, 208,   1, 
-      0,   0,  25,   0,   0,   0, 
-    244,   1,   0,   0,  25,   0, 
-      0, 128, 244,   1,   0,   0, 
-     25,   0,   0,   0,  24,   2, 
-      0,   0,  26,   0,   0, 128, 
-     24,   2,   0,   0,  26,   0, 
-      0,   0,  56,   2,   0,   0, 
-     26,   0,   0, 128,  56,   2, 
-      0,   0,  26,   0,   0,   0, 
-     76,   2,   0,   0,  26,   0, 
-      0, 128,  76,   2,   0,   0, 
-     26,   0,   0,   0,  96,   2, 
-      0,   0,  26,   0,   0, 128, 
-     96,   2,   0,   0,  26,   0, 
-      0,   0, 136,   2,   0,   0, 
-     26,   0,   0, 128, 136,   2, 
-      0,   0,  26,   0,   0,   0, 
-    180,   2,   0,   0,  26,   0, 
-      0, 128, 180,   2,   0,   0, 
-     26,   0,   0,   0, 224,   2, 
-      0,   0,  26,   0,   0, 128, 
-    224,   2,   0,   0,  26,   0, 
-      0,   0,  12,   3,   0,   0, 
-     26,   0,   0, 128,  12,   3, 
-      0,   0,  26,   0,   0,   0, 
-     48,   3,   0,   0,  26,   0, 
-      0, 128,  48,   3,   0,   0, 
-     26,   0,   0,   0,  84,   3, 
-      0,   0,  26,   0,   0, 128, 
-     84,   3,   0,   0,  26,   0, 
-      0,   0, 120,   3,   0,   0, 
-     26,   0,   0, 128, 120,   3, 
-      0,   0,  26,   0,   0,   0, 
-    156,   3,   0,   0,  26,   0, 
-      0, 128, 156,   3,   0,   0, 
-     26,   0,   0,   0, 180,   3, 
-      0,   0,  27,   0,   0, 128, 
-    180,   3,   0,   0,  27,   0, 
-      0,   0, 212,   3,   0,   0, 
-     27,   0,   0, 128, 212,   3, 
-      0,   0,  27,   0,   0,   0, 
-    252,   3,   0,   0,  27,   0, 
-      0, 128, 252,   3,   0,   0, 
-     27,   0,   0,   0,  40,   4, 
-      0,   0,  27,   0,   0, 128, 
-     40,   4,   0,   0,  27,   0, 
-      0,   0,  84,   4,   0,   0, 
-     27,   0,   0, 128,  84,   4, 
-      0,   0,  27,   0,   0,   0, 
-    128,   4,   0,   0,  27,   0, 
-      0, 128, 128,   4,   0,   0, 
-     27,   0,   0,   0, 164,   4, 
-      0,   0,  27,   0,   0, 128, 
-    164,   4,   0,   0,  27,   0, 
-      0,   0, 200,   4,   0,   0, 
-     27,   0,   0, 128, 200,   4, 
-      0,   0,  27,   0,   0,   0, 
-    236,   4,   0,   0,  27,   0, 
-      0, 128, 236,   4,   0,   0, 
-     27,   0,   0,   0,  16,   5, 
-      0,   0,  27,   0,   0, 128, 
-     16,   5,   0,   0,  27,   0, 
-      0,   0,  52,   5,   0,   0, 
-     27,   0,   0, 128,  52,   5, 
-      0,   0,  27,   0,   0,   0, 
-     88,   5,   0,   0,  27,   0, 
-      0, 128,  88,   5,   0,   0, 
-     27,   0,   0,   0, 124,   5, 
-      0,   0,  27,   0,   0, 128, 
-    124,   5,   0,   0,  27,   0, 
-      0,   0, 160,   5,   0,   0, 
-     28,   0,   0, 128, 160,   5, 
-      0,   0,  28,   0,   0,   0, 
-    180,   5,   0,   0,  29,   0, 
-      0, 128, 180,   5,   0,   0, 
-     29,   0,   0,   0, 208,   5, 
-      0,   0,  29,   0,   0, 128, 
-    208,   5,   0,   0,  29,   0, 
-      0,   0, 228,   5,   0,   0, 
-     29,   0,   0, 128, 228,   5, 
-      0,   0,  29,   0,   0,   0, 
-      0,   6,   0,   0,  31,   0, 
-      0, 128,   0,   6,   0,   0, 
-     31,   0,   0,   0,  20,   6, 
-      0,   0,  31,   0,   0, 128, 
-     20,   6,   0,   0,  31,   0, 
-      0,   0,  40,   6,   0,   0, 
-     31,   0,   0, 128,  40,   6, 
-      0,   0,  31,   0,   0,   0, 
-     60,   6,   0,   0,  31,   0, 
-      0, 128,  60,   6,   0,   0, 
-     31,   0,   0,   0,  80,   6, 
-      0,   0,  31,   0,   0, 128, 
-     80,   6,   0,   0,  31,   0, 
-      0,   0,   5,   0,  83,   0, 
-     53,   0,  71,   0,   5,   0, 
-     83,   0,  29,   0,  72,   0, 
-      5,   0,  83,   0,  29,   0, 
-     72,   0,   5,   0,  83,   0, 
-     29,   0,  72,   0,   5,   0, 
-     83,   0,  29,   0,  72,   0, 
-      5,   0,  83,   0,  29,   0, 
-     72,   0,   5,   0,  83,   0, 
-     29,   0,  72,   0,   5,   0, 
-     83,   0,  25,   0,  82,   0, 
-      5,   0,  83,   0,  25,   0, 
-     82,   0,   5,   0,  83,   0, 
-     25,   0,  82,   0,   5,   0, 
-     83,   0,  25,   0,  82,   0, 
-      5,   0,  79,   0,  49,   0, 
-     67,   0,   5,   0,  79,   0, 
-     26,   0,  68,   0,   5,   0, 
-     79,   0,  26,   0,  68,   0, 
-      5,   0,  79,   0,  26,   0, 
-     68,   0,   5,   0,  79,   0, 
-     26,   0,  68,   0,   5,   0, 
-     79,   0,  26,   0,  68,   0, 
-      5,   0,  79,   0,  26,   0, 
-     68,   0,   5,   0,  79,   0, 
-     22,   0,  78,   0,   5,   0, 
-     79,   0,  22,   0,  78,   0, 
-      5,   0,  79,   0,  22,   0, 
-     78,   0,   5,   0,  79,   0, 
-     22,   0,  78,   0,   5,   0, 
-     79,   0,  21,   0,  78,   0, 
-      5,   0,  94,   0,  54,   0, 
-     72,   0,   5,   0,  94,   0, 
-     31,   0,  73,   0,   5,   0, 
-     94,   0,  31,   0,  73,   0, 
-      5,   0,  94,   0,  31,   0, 
-     73,   0,   5,   0,  94,   0, 
-     31,   0,  73,   0,   5,   0, 
-     94,   0,  27,   0,  83,   0, 
-      5,   0,  94,   0,  27,   0, 
-     83,   0,   5,   0,  94,   0, 
-     27,   0,  83,   0,   5,   0, 
-     94,   0,  27,   0,  83,   0, 
-      5,   0,  94,   0,  23,   0, 
-     93,   0,   5,   0,  94,   0, 
-     23,   0,  93,   0,   5,   0, 
-     94,   0,  23,   0,  93,   0, 
-      5,   0,  94,   0,  23,   0, 
-     93,   0,   5,   0,  21,   0, 
-      5,   0,  20,   0,   5,   0, 
-     40,   0,  19,   0,  39,   0, 
-      5,   0,  40,   0,  19,   0, 
-     39,   0,   5,   0,  40,   0, 
-     19,   0,  39,   0,   5,   0, 
-     18,   0,   5,   0,  18,   0, 
-      5,   0,  18,   0,   5,   0, 
-     18,   0,   5,   0,  18,   0, 
-      5,   0,  18,   0,   5,   0, 
-     18,   0,   5,   0,  18,   0, 
-      5,   0,  18,   0,   5,   0, 
-     18,   0, 246,   0,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,  20,   0, 
-      0,   0,  56,   0,   0,   0, 
-     92,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     11, 202,  49,   1,  56,   0, 
-      0,   0,   0,  16,   0,   0, 
-     14,  16,   0,   0,  84,   1, 
-      0,   0,  10,   0, 255, 255, 
-      4,   0,   0,   0, 255, 255, 
-      3,   0,   0,   0,   0,   0, 
-     56,   0,   0,   0,  56,   0, 
-      0,   0,   8,   0,   0,   0, 
-     64,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  27,  21, 
-     64,   0,   0,   0,   3,   0, 
-      0,   0,  12,   0, 102, 108, 
-    111,  97, 116,  51,   0, 243, 
-    242, 241,  22,   0,  27,  21, 
-     64,   0,   0,   0,   2,   0, 
-      0,   0,   8,   0, 102, 108, 
-    111,  97, 116,  50,   0, 243, 
-    242, 241,  22,   0,   1,  18, 
-      4,   0,   0,   0,   0,  16, 
-      0,   0,   0,  16,   0,   0, 
-      1,  16,   0,   0, 117,   0, 
-      0,   0,  22,   0,  27,  21, 
-     64,   0,   0,   0,   4,   0, 
-      0,   0,  16,   0, 102, 108, 
-    111,  97, 116,  52,   0, 243, 
-    242, 241,  74,   0,   3,  18, 
-     13,  21,   3,   0,   3,  16, 
-      0,   0,   0,   0, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-      0, 241,  13,  21,   3,   0, 
-      3,  16,   0,   0,  16,   0, 
-    118, 105, 101, 119, 101, 114, 
-      0, 243, 242, 241,  13,  21, 
-      3,   0,   1,  16,   0,   0, 
-     32,   0, 116, 101, 120,   0, 
-    242, 241,  13,  21,   3,   0, 
-      0,  16,   0,   0,  40,   0, 
-    110, 111, 114, 109,   0, 241, 
-     34,   0,   5,  21,   4,   0, 
-      0,   0,   4,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  52,   0, 118, 115, 
-     95, 111, 117, 116, 112, 117, 
-    116,  95, 116,   0, 242, 241, 
-     10,   0,  24,  21,   5,  16, 
-      0,   0,   1,   0,   1,   0, 
-     14,   0,   8,  16,   6,  16, 
-      0,   0,  23,   0,   4,   0, 
-      2,  16,   0,   0,  30,   0, 
-     28,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,   4,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,  64,   0, 102, 108, 111, 
-     97, 116,  52, 120,  52,   0, 
-     10,   0,  24,  21,   8,  16, 
-      0,   0,   1,   0,   1,   0, 
-     14,   0,  23,  21,   9,  16, 
-      0,   0,  36,   2,  16,  24, 
-      0,   0, 242, 241,  18,   0, 
-     22,  21,  10,  16,   0,   0, 
-     34,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0, 241, 
-     10,   0,  24,  21,  11,  16, 
-      0,   0,   1,   0,   0,   2, 
-     10,   0,  24,  21,   9,  16, 
-      0,   0,   1,   0,   0,   2, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,   0,  16,   0,   0, 
-      0,   0,   0,   0,  11,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     68,  51,  68,  83,  72,  68, 
-     82,   0,  84,   6,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,  32,   0, 
-      0,   0,  20,   2,   0,   0, 
-     93,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  21,   0, 
-      0,   0,   1,   0,   0,   0, 
-     57,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   4,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   4,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,  32,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0,   0,   0,  24,   0, 
-      0,   0,  36,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     18,   0,  37,  17,   0,   0, 
-      0,   0, 128,   0,   0,   0, 
-      1,   0, 109,  97, 105, 110, 
-      0,   0,  34,   0, 100,  17, 
-     12,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   8,   0, 109,  97, 
-    116,  87, 111, 114, 108, 100, 
-      0,   0,  34,   0, 100,  17, 
-     13,  16,   0,   0,   0,   0, 
-      0,   0, 128,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   8,   0, 109,  97, 
-    116,  86, 105, 101, 119,   0, 
-      0,   0,  34,   0, 100,  17, 
-     13,  16,   0,   0,   0,   0, 
-      0,   0, 192,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   8,   0, 109,  97, 
-    116,  80, 114, 111, 106,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255, 119,   9,  49,   1, 
-      1,   0,   0,   0,  13,   0, 
-     20, 142,  14,   0,  20, 107, 
-     15,   0,   1,   0,  76,   0, 
-      0,   0,  32,   0,   0,   0, 
-     44,   0,   0,   0,  92,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-      0,   0,  25,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  84,   6,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      9,   0, 176,   5,   0,   0, 
-      0,   0,   0,   0, 132,   4, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    109,  97, 105, 110,   0, 110, 
-    111, 110, 101,   0,   0,   0, 
-     45, 186,  46, 241,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     84,   6,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   2,   0, 
-      7,   0,   0,   0,   0,   0, 
-      1,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  84,   6, 
-      0,   0,   8,   2,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,  67,  58, 
-     92,  85, 115, 101, 114, 115, 
-     92, 117, 115, 101, 114,  49, 
-     53,  55,  92, 115, 111, 117, 
-    114,  99, 101,  92, 114, 101, 
-    112, 111, 115,  92, 119,  97, 
-    108, 107, 105, 110, 103,  32, 
-     97, 114, 111, 117, 110, 100, 
-     92, 119,  97, 108, 107, 105, 
-    110, 103,  32,  97, 114, 111, 
-    117, 110, 100,  92,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  12, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    148,  46,  49,   1, 145,  49, 
-    169, 103,   1,   0,   0,   0, 
-    107, 246, 116,  23, 190,  81, 
-    167,  68, 129,  94, 183, 231, 
-     74, 253, 112, 177, 123,   0, 
-      0,   0,  47,  76, 105, 110, 
-    107,  73, 110, 102, 111,   0, 
-     47, 110,  97, 109, 101, 115, 
-      0,  47, 115, 114,  99,  47, 
-    104, 101,  97, 100, 101, 114, 
-     98, 108, 111,  99, 107,   0, 
-     47, 115, 114,  99,  47, 102, 
-    105, 108, 101, 115,  47,  99, 
-     58,  92, 117, 115, 101, 114, 
-    115,  92, 117, 115, 101, 114, 
-     49,  53,  55,  92, 115, 111, 
-    117, 114,  99, 101,  92, 114, 
-    101, 112, 111, 115,  92, 119, 
-     97, 108, 107, 105, 110, 103, 
-     32,  97, 114, 111, 117, 110, 
-    100,  92, 119,  97, 108, 107, 
-    105, 110, 103,  32,  97, 114, 
-    111, 117, 110, 100,  92, 118, 
-    101, 114, 116, 101, 120, 115, 
-    104,  97, 100, 101, 114,  46, 
-    104, 108, 115, 108,   0,   4, 
-      0,   0,   0,   6,   0,   0, 
-      0,   1,   0,   0,   0,  58, 
-      0,   0,   0,   0,   0,   0, 
-      0,  17,   0,   0,   0,   7, 
-      0,   0,   0,  10,   0,   0, 
-      0,   6,   0,   0,   0,   0, 
-      0,   0,   0,   5,   0,   0, 
-      0,  34,   0,   0,   0,   8, 
-      0,   0,   0,   0,   0,   0, 
-      0, 220,  81,  51,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-     32,   0,   0,   0, 215,   0, 
-      0,   0, 140,   1,   0,   0, 
-     99,   1,   0,   0,  56,   0, 
-      0,   0,   0,   0,   0,   0, 
-     10,   4,   0,   0, 128,   0, 
-      0,   0,  59,   3,   0,   0, 
-     72,  10,   0,   0,  64,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0,  68,   2, 
-      0,   0,  44,   0,   0,   0, 
-    128,   0,   0,   0,   3,   0, 
-      0,   0,  27,   0,   0,   0, 
-     18,   0,   0,   0,  26,   0, 
-      0,   0,  19,   0,   0,   0, 
-     10,   0,   0,   0,   6,   0, 
-      0,   0,  20,   0,   0,   0, 
-     11,   0,   0,   0,   8,   0, 
-      0,   0,   9,   0,   0,   0, 
-     12,   0,   0,   0,  13,   0, 
-      0,   0,  14,   0,   0,   0, 
-     15,   0,   0,   0,  16,   0, 
-      0,   0,  17,   0,   0,   0, 
-      7,   0,   0,   0,  21,   0, 
-      0,   0,  22,   0,   0,   0, 
-     23,   0,   0,   0,  25,   0, 
-      0,   0,  24,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  28,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0
-};